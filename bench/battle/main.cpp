@@ -0,0 +1,458 @@
+#include "Battle/Battle.h"
+#include "Battle/BattleObserver.h"
+#include "Battle/RandomPlayerDecision.h"
+#include "Entities/NPC/NPCCollection.h"
+#include "Entities/NPC/NPCGenerator.h"
+#include "Entities/Player.h"
+#include "Misc/Histogram.h"
+#include "Misc/RNG.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Balance simulator
+ * Runs Player-vs-NPC battles with a random player policy for every pairing of player level,
+ * enemy level and enemy type, and reports win rate, turns-to-kill and HP-remaining distributions.
+ * Every pairing is simulated on one thread with its own RNG seed derived from the base seed,
+ * so the results for a given seed do not depend on the thread count.
+ */
+namespace BenchBattle
+{
+
+static const std::string Usage = "Usage: bench-battle [options]\n"
+                                 "  --battles N            battles per pairing (default: 100)\n"
+                                 "  --threads N            worker threads (default: all cores)\n"
+                                 "  --player-levels LO-HI  player level range (default: 1-100)\n"
+                                 "  --enemy-levels LO-HI   enemy level range (default: 1-100)\n"
+                                 "  --enemies N            enemies fought at once (default: 1)\n"
+                                 "  --format csv|json      output format (default: csv)\n"
+                                 "  --seed N               base seed for reproducible runs (default: random)\n"
+                                 "  -h, --help             show this help\n";
+
+/**
+ * @brief Player turns after which a battle is abandoned as a stalemate
+ */
+constexpr static const int MaxPlayerTurns = 1000;
+
+/**
+ * @brief Enemy types to simulate along with their names
+ */
+static const std::vector<std::pair<Entities::NPCCollection::Type, std::string>> EnemyTypes {
+    { Entities::NPCCollection::Type::FadingSpirit, "FadingSpirit" },
+    { Entities::NPCCollection::Type::Rat, "Rat" }
+};
+
+/**
+ * @brief Command line options
+ */
+struct Options
+{
+    int Battles         = 100;
+    int Threads         = std::max(1u, std::thread::hardware_concurrency());
+    int PlayerLevelLow  = 1;
+    int PlayerLevelHigh = Entities::LevelCap;
+    int EnemyLevelLow   = 1;
+    int EnemyLevelHigh  = Entities::LevelCap;
+    int Enemies         = 1;
+    bool Json           = false;
+    uint64_t Seed       = std::random_device {}();
+    bool ShowUsage      = false;
+};
+
+/**
+ * @brief Summary numbers of a distribution, all 0 if there were no samples
+ */
+struct DistributionSummary
+{
+    double Mean  = 0;
+    uint64_t P10 = 0;
+    uint64_t P50 = 0;
+    uint64_t P90 = 0;
+    uint64_t Max = 0;
+};
+
+/**
+ * @brief One simulated combination of player level, enemy type and enemy level
+ * Distributions are only kept as histograms while the pairing is simulated, so a pairing stays small
+ * however many of them there are.
+ */
+struct Pairing
+{
+    int EnemyTypeIndex = 0;
+    int EnemyLevel     = 0;
+    int PlayerLevel    = 0;
+    int Victories      = 0;
+    int GameOvers      = 0;
+    int Stalemates     = 0;
+
+    /**
+     * @brief Player turns needed to win, over victories
+     */
+    DistributionSummary TurnsToKill;
+
+    /**
+     * @brief Percentage of player max HP remaining, over victories
+     */
+    DistributionSummary HPRemaining;
+};
+
+/**
+ * @brief Random player policy which gives up once the battle has dragged on for too long
+ */
+class SimulatedPlayer : public Battle::RandomPlayerDecision, public Battle::BattleObserver
+{
+public:
+    /**
+     * @brief Prepare for the next battle
+     */
+    void Reset()
+    {
+        m_Turns = 0;
+    }
+
+    /**
+     * @brief Get the number of skills the player has used
+     *
+     * @return int player turns
+     */
+    int GetTurns() const
+    {
+        return m_Turns;
+    }
+
+    virtual Battle::Skill* ChooseSkill(const Battle::Battle& battle) override
+    {
+        if (m_Turns >= MaxPlayerTurns)
+            return nullptr;
+        return RandomPlayerDecision::ChooseSkill(battle);
+    }
+
+    virtual void OnSkillChosen(const Battle::Skill& skill, size_t user) override
+    {
+        if (user == Battle::Battle::PlayerIndex)
+            m_Turns++;
+    }
+
+private:
+    int m_Turns = 0;
+};
+
+/**
+ * @brief Mix the base seed with a stream index into an independent 32-bit seed (SplitMix64)
+ *
+ * @param seed base seed
+ * @param stream stream index
+ * @return unsigned int stream seed
+ */
+static unsigned int StreamSeed(uint64_t seed, uint64_t stream)
+{
+    uint64_t z = seed + (stream + 1) * 0x9E3779B97F4A7C15ull;
+    z          = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z          = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return static_cast<unsigned int>((z ^ (z >> 31)) >> 32);
+}
+
+/**
+ * @brief Get the mean of the histogram samples
+ *
+ * @param histogram histogram
+ * @return double mean, 0 if empty
+ */
+static double Mean(const Histogram& histogram)
+{
+    return histogram.Count() ? static_cast<double>(histogram.Sum()) / histogram.Count() : 0.;
+}
+
+/**
+ * @brief Reduce a histogram to the numbers reported
+ *
+ * @param histogram histogram
+ * @return DistributionSummary summary
+ */
+static DistributionSummary Summarize(const Histogram& histogram)
+{
+    DistributionSummary summary;
+    summary.Mean = Mean(histogram);
+    summary.P10  = histogram.Percentile(0.1);
+    summary.P50  = histogram.Percentile(0.5);
+    summary.P90  = histogram.Percentile(0.9);
+    summary.Max  = histogram.Max();
+    return summary;
+}
+
+/**
+ * @brief Simulate all battles of a pairing on the calling thread
+ *
+ * @param pairing pairing to fill in
+ * @param battles number of battles
+ * @param enemyCount enemies fought at once
+ */
+static void Simulate(Pairing& pairing, int battles, int enemyCount)
+{
+    Entities::Player player("Bench");
+    player.SetLevel(pairing.PlayerLevel);
+    std::vector<std::unique_ptr<Entities::Character>> enemies;
+    std::vector<Entities::Character*> enemyPointers;
+    for (int i = 0; i < enemyCount; i++)
+    {
+        enemies.push_back(Entities::NPC::NPCGenerator::CreateEnemy(EnemyTypes[pairing.EnemyTypeIndex].first,
+                                                                   pairing.EnemyLevel));
+        enemyPointers.push_back(enemies.back().get());
+    }
+    SimulatedPlayer simulatedPlayer;
+    Histogram turnsToKill;
+    Histogram hpRemaining;
+    int maxHealth = player.GetStats().MaxHealth;
+
+    for (int i = 0; i < battles; i++)
+    {
+        player.SetHealth(maxHealth);
+        player.SetMana(player.GetStats().MaxMana);
+        simulatedPlayer.Reset();
+
+        Battle::Battle battle(player, enemyPointers);
+        battle.SetPlayerDecision(&simulatedPlayer);
+        battle.SetObserver(&simulatedPlayer);
+
+        switch (battle.DoBattle())
+        {
+        case Battle::Battle::Result::Victory:
+            pairing.Victories++;
+            turnsToKill.Record(simulatedPlayer.GetTurns());
+            hpRemaining.Record(std::max(0, player.GetStats().Health) * 100 / maxHealth);
+            break;
+        case Battle::Battle::Result::GameOver:
+            pairing.GameOvers++;
+            break;
+        default:
+            pairing.Stalemates++;
+            break;
+        }
+    }
+
+    pairing.TurnsToKill = Summarize(turnsToKill);
+    pairing.HPRemaining = Summarize(hpRemaining);
+}
+
+/**
+ * @brief Parse a level range in the form LO-HI
+ *
+ * @param value argument value
+ * @param low parsed lower bound
+ * @param high parsed upper bound
+ * @return bool true if the range is valid
+ */
+static bool ParseLevelRange(const std::string& value, int& low, int& high)
+{
+    size_t separator = value.find('-');
+    try
+    {
+        low  = std::stoi(value.substr(0, separator));
+        high = separator == std::string::npos ? low : std::stoi(value.substr(separator + 1));
+    }
+    catch (std::exception&)
+    {
+        return false;
+    }
+    return 1 <= low && low <= high && high <= Entities::LevelCap;
+}
+
+/**
+ * @brief Parse the command line
+ *
+ * @param argc argument count
+ * @param argv argument values
+ * @param options parsed options
+ * @return bool true on success
+ */
+static bool ParseOptions(int argc, char* argv[], Options& options)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        if (arg == "-h" || arg == "--help")
+        {
+            options.ShowUsage = true;
+            continue;
+        }
+        if (i + 1 >= argc)
+        {
+            std::cerr << "Missing value for argument: " << arg << "\n";
+            return false;
+        }
+
+        std::string value = argv[++i];
+        try
+        {
+            if (arg == "--battles" && (options.Battles = std::stoi(value)) > 0)
+                continue;
+            if (arg == "--threads" && (options.Threads = std::stoi(value)) > 0)
+                continue;
+            if (arg == "--enemies" && (options.Enemies = std::stoi(value)) > 0)
+                continue;
+            if (arg == "--seed")
+            {
+                options.Seed = std::stoull(value);
+                continue;
+            }
+        }
+        catch (std::exception&)
+        {
+        }
+        if (arg == "--player-levels" && ParseLevelRange(value, options.PlayerLevelLow, options.PlayerLevelHigh))
+            continue;
+        if (arg == "--enemy-levels" && ParseLevelRange(value, options.EnemyLevelLow, options.EnemyLevelHigh))
+            continue;
+        if (arg == "--format" && (value == "csv" || value == "json"))
+        {
+            options.Json = value == "json";
+            continue;
+        }
+
+        std::cerr << "Invalid argument: " << arg << " " << value << "\n";
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Write the results as CSV
+ *
+ * @param pairings simulated pairings
+ * @param battles battles per pairing
+ */
+static void WriteCsv(const std::vector<Pairing>& pairings, int battles)
+{
+    std::cout << "enemy,enemy_level,player_level,battles,win_rate,loss_rate,stalemate_rate,"
+                 "turns_mean,turns_p50,turns_p90,turns_max,hp_left_pct_mean,hp_left_pct_p10,hp_left_pct_p50,"
+                 "hp_left_pct_p90\n";
+    for (const auto& pairing : pairings)
+    {
+        std::cout << EnemyTypes[pairing.EnemyTypeIndex].second << "," << pairing.EnemyLevel << ","
+                  << pairing.PlayerLevel << "," << battles << ","
+                  << static_cast<double>(pairing.Victories) / battles << ","
+                  << static_cast<double>(pairing.GameOvers) / battles << ","
+                  << static_cast<double>(pairing.Stalemates) / battles << "," << pairing.TurnsToKill.Mean << ","
+                  << pairing.TurnsToKill.P50 << "," << pairing.TurnsToKill.P90 << "," << pairing.TurnsToKill.Max << ","
+                  << pairing.HPRemaining.Mean << "," << pairing.HPRemaining.P10 << "," << pairing.HPRemaining.P50 << ","
+                  << pairing.HPRemaining.P90 << "\n";
+    }
+}
+
+/**
+ * @brief Write the results as JSON
+ *
+ * @param pairings simulated pairings
+ * @param options options used
+ * @param battlesPerSecond measured throughput
+ */
+static void WriteJson(const std::vector<Pairing>& pairings, const Options& options, double battlesPerSecond)
+{
+    std::cout << "{\n  \"seed\": " << options.Seed << ",\n  \"battles_per_pairing\": " << options.Battles
+              << ",\n  \"threads\": " << options.Threads << ",\n  \"battles_per_second\": " << battlesPerSecond
+              << ",\n  \"pairings\": [\n";
+    for (size_t i = 0; i < pairings.size(); i++)
+    {
+        const auto& pairing = pairings[i];
+        std::cout << "    {\"enemy\": \"" << EnemyTypes[pairing.EnemyTypeIndex].second
+                  << "\", \"enemy_level\": " << pairing.EnemyLevel << ", \"player_level\": " << pairing.PlayerLevel
+                  << ", \"win_rate\": " << static_cast<double>(pairing.Victories) / options.Battles
+                  << ", \"loss_rate\": " << static_cast<double>(pairing.GameOvers) / options.Battles
+                  << ", \"stalemate_rate\": " << static_cast<double>(pairing.Stalemates) / options.Battles
+                  << ", \"turns\": {\"mean\": " << pairing.TurnsToKill.Mean << ", \"p50\": " << pairing.TurnsToKill.P50
+                  << ", \"p90\": " << pairing.TurnsToKill.P90 << ", \"max\": " << pairing.TurnsToKill.Max
+                  << "}, \"hp_left_pct\": {\"mean\": " << pairing.HPRemaining.Mean
+                  << ", \"p10\": " << pairing.HPRemaining.P10 << ", \"p50\": " << pairing.HPRemaining.P50
+                  << ", \"p90\": " << pairing.HPRemaining.P90 << "}}"
+                  << (i + 1 < pairings.size() ? ",\n" : "\n");
+    }
+    std::cout << "  ]\n}\n";
+}
+
+} /* namespace BenchBattle */
+
+/**
+ * @brief Main function
+ *
+ * @param argc argument count
+ * @param argv argument values
+ * @return int exit code
+ */
+int main(int argc, char* argv[])
+{
+    using namespace BenchBattle;
+
+    Options options;
+    if (!ParseOptions(argc, argv, options))
+    {
+        std::cerr << Usage;
+        return 1;
+    }
+    if (options.ShowUsage)
+    {
+        std::cout << Usage;
+        return 0;
+    }
+
+    std::vector<Pairing> pairings;
+    pairings.reserve(EnemyTypes.size() * (options.EnemyLevelHigh - options.EnemyLevelLow + 1)
+                     * (options.PlayerLevelHigh - options.PlayerLevelLow + 1));
+    for (int typeIndex = 0; typeIndex < static_cast<int>(EnemyTypes.size()); typeIndex++)
+    {
+        for (int enemyLevel = options.EnemyLevelLow; enemyLevel <= options.EnemyLevelHigh; enemyLevel++)
+        {
+            for (int playerLevel = options.PlayerLevelLow; playerLevel <= options.PlayerLevelHigh; playerLevel++)
+            {
+                Pairing& pairing       = pairings.emplace_back();
+                pairing.EnemyTypeIndex = typeIndex;
+                pairing.EnemyLevel     = enemyLevel;
+                pairing.PlayerLevel    = playerLevel;
+            }
+        }
+    }
+
+    // Workers pull pairings off a shared counter, each pairing is written by exactly one thread
+    std::atomic<size_t> nextPairing(0);
+    auto worker = [&]() {
+        for (size_t i = nextPairing++; i < pairings.size(); i = nextPairing++)
+        {
+            RNG::Seed(StreamSeed(options.Seed, i));
+            Simulate(pairings[i], options.Battles, options.Enemies);
+        }
+    };
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (int i = 0; i < options.Threads; i++)
+    {
+        threads.emplace_back(worker);
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    double totalBattles     = static_cast<double>(pairings.size()) * options.Battles;
+    double battlesPerSecond = totalBattles / std::max(elapsed.count(), 1e-9);
+    std::cerr << std::fixed << std::setprecision(0) << "Simulated " << totalBattles << " battles over "
+              << pairings.size() << " pairings in " << std::setprecision(2) << elapsed.count() << " s on "
+              << options.Threads << " threads (" << std::setprecision(0) << battlesPerSecond
+              << " battles/s, seed " << options.Seed << ")\n";
+
+    if (options.Json)
+        WriteJson(pairings, options, battlesPerSecond);
+    else
+        WriteCsv(pairings, options.Battles);
+    return 0;
+}
@@ -0,0 +1,322 @@
+#include "Misc/RNG.h"
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Random number generator benchmark
+ * Measures draws per second of the RNG functions against the previous implementation, a thread-local mt19937
+ * with a distribution constructed on every call, for the kinds of draws the game makes.
+ */
+namespace BenchRNG
+{
+
+static const std::string Usage = "Usage: bench-rng [options]\n"
+                                 "  --draws N              draws per measurement (default: 50000000)\n"
+                                 "  --seed N               seed (default: 1)\n"
+                                 "  -h, --help             show this help\n";
+
+/**
+ * @brief Command line options
+ */
+struct Options
+{
+    long long Draws = 50000000;
+    unsigned Seed   = 1;
+    bool ShowUsage  = false;
+};
+
+/**
+ * @brief Previous implementation, kept here as the point of comparison
+ */
+namespace Legacy
+{
+
+static thread_local std::mt19937 engine;
+
+static int RandomInt(int low, int high)
+{
+    std::uniform_int_distribution<int> distribution(low, high - 1);
+    return distribution(engine);
+}
+
+static double RandomDouble()
+{
+    std::uniform_real_distribution<double> distribution(0., 1.);
+    return distribution(engine);
+}
+
+static bool Chance(double threshold)
+{
+    return RandomDouble() < threshold;
+}
+
+} /* namespace Legacy */
+
+/**
+ * @brief Kind of draw to measure
+ */
+struct Measurement
+{
+    std::string Name;
+    double (*Legacy)(long long);
+    double (*Current)(long long);
+};
+
+/**
+ * @brief Sums draws so the compiler cannot drop them
+ */
+static volatile double sink;
+
+static const std::vector<Measurement> Measurements {
+    { "RandomInt(0, 6)",
+      [](long long n) {
+          long long sum = 0;
+          for (long long i = 0; i < n; i++)
+              sum += Legacy::RandomInt(0, 6);
+          return static_cast<double>(sum);
+      },
+      [](long long n) {
+          long long sum = 0;
+          for (long long i = 0; i < n; i++)
+              sum += RNG::RandomInt(0, 6);
+          return static_cast<double>(sum);
+      } },
+    { "RandomInt(-1, 2)",
+      [](long long n) {
+          long long sum = 0;
+          for (long long i = 0; i < n; i++)
+              sum += Legacy::RandomInt(-1, 2);
+          return static_cast<double>(sum);
+      },
+      [](long long n) {
+          long long sum = 0;
+          for (long long i = 0; i < n; i++)
+              sum += RNG::RandomInt(-1, 2);
+          return static_cast<double>(sum);
+      } },
+    { "RandomInt(0, 1000000)",
+      [](long long n) {
+          long long sum = 0;
+          for (long long i = 0; i < n; i++)
+              sum += Legacy::RandomInt(0, 1000000);
+          return static_cast<double>(sum);
+      },
+      [](long long n) {
+          long long sum = 0;
+          for (long long i = 0; i < n; i++)
+              sum += RNG::RandomInt(0, 1000000);
+          return static_cast<double>(sum);
+      } },
+    { "RandomDouble()",
+      [](long long n) {
+          double sum = 0;
+          for (long long i = 0; i < n; i++)
+              sum += Legacy::RandomDouble();
+          return sum;
+      },
+      [](long long n) {
+          double sum = 0;
+          for (long long i = 0; i < n; i++)
+              sum += RNG::RandomDouble();
+          return sum;
+      } },
+    { "Chance(0.3)",
+      [](long long n) {
+          long long sum = 0;
+          for (long long i = 0; i < n; i++)
+              sum += Legacy::Chance(.3);
+          return static_cast<double>(sum);
+      },
+      [](long long n) {
+          long long sum = 0;
+          for (long long i = 0; i < n; i++)
+              sum += RNG::Chance(.3);
+          return static_cast<double>(sum);
+      } }
+};
+
+/**
+ * @brief Values drawn per call of a bulk function
+ */
+constexpr static const long long BulkSize = 4096;
+
+/**
+ * @brief Bulk buffers, sized BulkSize
+ */
+static std::vector<int> bulkInts(BulkSize);
+static std::vector<double> bulkDoubles(BulkSize);
+static std::vector<uint8_t> bulkChances(BulkSize);
+
+/**
+ * @brief Single-value functions called in a loop against the bulk functions
+ */
+static const std::vector<Measurement> BulkMeasurements {
+    { "FillRandomInt(0, 6)",
+      [](long long n) {
+          long long sum = 0;
+          for (long long i = 0; i < n; i += BulkSize)
+              for (long long j = 0; j < BulkSize; j++)
+                  sum += bulkInts[j] = RNG::RandomInt(0, 6);
+          return static_cast<double>(sum);
+      },
+      [](long long n) {
+          long long sum = 0;
+          for (long long i = 0; i < n; i += BulkSize)
+          {
+              RNG::FillRandomInt(bulkInts.data(), BulkSize, 0, 6);
+              sum += bulkInts[0];
+          }
+          return static_cast<double>(sum);
+      } },
+    { "FillRandomDouble()",
+      [](long long n) {
+          double sum = 0;
+          for (long long i = 0; i < n; i += BulkSize)
+              for (long long j = 0; j < BulkSize; j++)
+                  sum += bulkDoubles[j] = RNG::RandomDouble();
+          return sum;
+      },
+      [](long long n) {
+          double sum = 0;
+          for (long long i = 0; i < n; i += BulkSize)
+          {
+              RNG::FillRandomDouble(bulkDoubles.data(), BulkSize);
+              sum += bulkDoubles[0];
+          }
+          return sum;
+      } },
+    { "FillChance(0.3)",
+      [](long long n) {
+          long long sum = 0;
+          for (long long i = 0; i < n; i += BulkSize)
+              for (long long j = 0; j < BulkSize; j++)
+                  sum += bulkChances[j] = RNG::Chance(.3);
+          return static_cast<double>(sum);
+      },
+      [](long long n) {
+          long long sum = 0;
+          for (long long i = 0; i < n; i += BulkSize)
+          {
+              RNG::FillChance(bulkChances.data(), BulkSize, .3);
+              sum += bulkChances[0];
+          }
+          return static_cast<double>(sum);
+      } }
+};
+
+/**
+ * @brief Time a measurement
+ *
+ * @param function measured function
+ * @param draws number of draws
+ * @return double draws per second
+ */
+static double DrawsPerSecond(double (*function)(long long), long long draws)
+{
+    auto start = std::chrono::steady_clock::now();
+    sink       = function(draws);
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return draws / std::max(elapsed.count(), 1e-9);
+}
+
+/**
+ * @brief Time both sides of every measurement and write a CSV row for each
+ *
+ * @param measurements measurements
+ * @param draws number of draws per side
+ */
+static void WriteMeasurements(const std::vector<Measurement>& measurements, long long draws)
+{
+    for (const auto& measurement : measurements)
+    {
+        double legacy  = DrawsPerSecond(measurement.Legacy, draws);
+        double current = DrawsPerSecond(measurement.Current, draws);
+        std::cout << std::fixed << std::setprecision(0) << "\"" << measurement.Name << "\"," << legacy << ","
+                  << current << "," << std::setprecision(2) << current / legacy << "\n";
+    }
+}
+
+/**
+ * @brief Parse the command line
+ *
+ * @param argc argument count
+ * @param argv argument values
+ * @param options parsed options
+ * @return bool true on success
+ */
+static bool ParseOptions(int argc, char* argv[], Options& options)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        if (arg == "-h" || arg == "--help")
+        {
+            options.ShowUsage = true;
+            continue;
+        }
+        if (i + 1 >= argc)
+        {
+            std::cerr << "Missing value for argument: " << arg << "\n";
+            return false;
+        }
+
+        std::string value = argv[++i];
+        try
+        {
+            if (arg == "--draws" && (options.Draws = std::stoll(value)) > 0)
+                continue;
+            if (arg == "--seed")
+            {
+                options.Seed = std::stoul(value);
+                continue;
+            }
+        }
+        catch (std::exception&)
+        {
+        }
+
+        std::cerr << "Invalid argument: " << arg << " " << value << "\n";
+        return false;
+    }
+    return true;
+}
+
+} /* namespace BenchRNG */
+
+/**
+ * @brief Entry point
+ *
+ * @param argc argument count
+ * @param argv argument values
+ * @return int exit code
+ */
+int main(int argc, char* argv[])
+{
+    using namespace BenchRNG;
+
+    Options options;
+    if (!ParseOptions(argc, argv, options))
+    {
+        std::cerr << Usage;
+        return 1;
+    }
+    if (options.ShowUsage)
+    {
+        std::cout << Usage;
+        return 0;
+    }
+
+    Legacy::engine.seed(options.Seed);
+    RNG::Seed(options.Seed);
+
+    std::cout << "draw,legacy_per_s,current_per_s,speedup\n";
+    WriteMeasurements(Measurements, options.Draws);
+    std::cout << "\nbulk draw,per_call_per_s,bulk_per_s,speedup\n";
+    WriteMeasurements(BulkMeasurements, options.Draws);
+    return 0;
+}
@@ -1,32 +1,126 @@
 #include "Application.h"
+#include "Application/Options.h"
+#include "Battle/Battle.h"
+#include "Battle/BattleRecord.h"
+#include "Battle/BattleReplayer.h"
 #include "Entities/EntityManager.h"
+#include "Entities/NPC/NPCGenerator.h"
 #include "Entities/Player.h"
 #include "Misc/Direction.h"
+#include "Misc/Exceptions.h"
+#include "Misc/Profiler.h"
+#include "Misc/RNG.h"
+#include "Misc/Utils.h"
 #include "Player/Controller.h"
 #include "UI/ColorPairs.h"
 #include "UI/InputHandler.h"
+#include "UI/InputLatency.h"
 #include "UI/Screen.h"
 #include "Worlds/World.h"
 #include "Worlds/WorldManager.h"
-#include <sstream>
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
 #include <ncurses.h>
+#include <sstream>
 
 namespace Application
 {
 
-Application::Application()
-    : m_InputHandler(m_Screen, m_PlayerController),
-    m_Screen(m_InputHandler, m_WorldManager, m_EntityManager, m_Player),
-    m_WorldManager(),
+Application::Application(const Options& options)
+    : m_ReplayFile(options.ReplayFile),
+    m_BattleReplayFile(options.BattleReplayFile),
+    m_ScriptFile(options.ScriptFile),
+    m_IsHeadless(options.IsHeadless),
+    m_Seed(StartSession(options)),
+    m_InputHandler(m_Screen, m_PlayerController),
+    m_Screen(m_InputHandler,
+             m_WorldManager,
+             m_EntityManager,
+             m_Player,
+             options.IsHeadless || (!m_BattleReplayFile.empty() && !options.IsRealTime)
+                 ? UI::Render::BackendType::Headless
+             : m_Replayer && !options.IsRealTime ? UI::Render::BackendType::Offscreen
+                                                 : UI::Render::BackendType::Ncurses),
+    m_WorldManager(m_Seed),
     m_Player("Gref",
              'G' | A_BOLD | COLOR_PAIR(UI::ColorPairs::MagentaOnDefault)),
     m_EntityManager(m_WorldManager, m_Player),
     m_PlayerController(m_EntityManager, m_WorldManager, m_Player, m_Screen)
 {
+    if (m_Replayer && !options.IsRealTime)
+        m_Screen.PinPresentationSpeed(UI::Animation::PresentationSpeed::Instant);
+    else
+        m_Screen.SetPresentationSpeed(options.Speed);
+    UI::InputLatency::SetEnabled(options.IsLatencyTracked);
+}
+
+Application::~Application()
+{
+    UI::SetKeyTape(nullptr);
+    UI::InputLatency::SetEnabled(false);
+}
+
+uint64_t Application::StartSession(const Options& options)
+{
+    uint64_t seed;
+    if (!options.ReplayFile.empty())
+    {
+        m_ReplayRecord = SessionRecord::LoadFromFile(options.ReplayFile);
+        if (!m_ReplayRecord)
+            throw InvalidArgumentException("Could not read session record: " + options.ReplayFile);
+        seed       = m_ReplayRecord->GetSeed();
+        m_Replayer = std::make_unique<SessionReplayer>(*m_ReplayRecord, options.IsRealTime);
+        UI::SetKeyTape(m_Replayer.get());
+    }
+    else if (!options.BattleReplayFile.empty())
+    {
+        // The battle record supplies its own random draws
+        seed = RNG::ThreadEngine()();
+    }
+    else if (options.IsHeadless)
+    {
+        // Scripts are text, there are no keys to record
+        if (!options.ScriptFile.empty() && !fileExists(options.ScriptFile))
+            throw InvalidArgumentException("Could not read script: " + options.ScriptFile);
+        seed = options.Seed.value_or(RNG::ThreadEngine()());
+    }
+    else
+    {
+        // Recording is best effort, the game is playable without it
+        seed       = options.Seed.value_or(RNG::ThreadEngine()());
+        m_Recorder = std::make_unique<SessionRecorder>(options.RecordFile, seed);
+        if (m_Recorder->IsGood())
+            UI::SetKeyTape(m_Recorder.get());
+        else
+            m_Recorder.reset();
+    }
+
+    RNG::Seed(seed);
+    return seed;
+}
+
+int Application::Run()
+{
+    int exitCode = !m_BattleReplayFile.empty() ? RunBattleReplay() : m_IsHeadless ? RunScript() : RunInteractive();
+
+    if (Profiler::IsEnabled())
+    {
+        Profiler::DumpToFile(Profiler::ReportFilename);
+    }
+    if (UI::InputLatency::IsEnabled())
+    {
+        UI::InputLatency::DumpToFile(UI::InputLatency::ReportFilename);
+    }
+    return exitCode;
 }
 
-void Application::Run()
+int Application::RunInteractive()
 {
+    int exitCode   = 0;
+    auto startTime = std::chrono::steady_clock::now();
     try
     {
         m_Screen.MainMenu();
@@ -37,15 +131,143 @@ void Application::Run()
             m_InputHandler.ProcessKeypress();
         }
     }
+    // Out of recorded keys
+    catch (ReplayFinishedException&)
+    {
+    }
     // Generic exception handler
     catch (std::exception& ex)
+    {
+        if (m_Replayer)
+        {
+            m_Report += std::string("Replay failed: ") + ex.what() + "\n";
+            exitCode = 1;
+        }
+        else
+        {
+            std::ostringstream message;
+            message << ex.what()
+                    << "\n\nDun-geon will exit.";
+            m_Screen.OkMessageBox(message.str(), "Error");
+        }
+    }
+
+    if (m_Replayer)
+    {
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - startTime;
+        std::ostringstream summary;
+        summary << "Replayed " << m_Replayer->GetPosition() << " of " << m_ReplayRecord->GetKeys().size()
+                << " keys from " << m_ReplayFile << " in " << std::fixed << std::setprecision(2) << elapsed.count()
+                << " s (seed " << m_Seed << ")\n";
+        m_Report += summary.str();
+    }
+    return exitCode;
+}
+
+int Application::RunScript()
+{
+    int exitCode        = 0;
+    size_t lineNumber   = 0;
+    size_t commandCount = 0;
+    auto startTime      = std::chrono::steady_clock::now();
+    std::string source  = m_ScriptFile.empty() ? "standard input" : m_ScriptFile;
+    try
+    {
+        std::ifstream file;
+        if (!m_ScriptFile.empty())
+        {
+            file.open(m_ScriptFile);
+            if (!file)
+                throw InvalidArgumentException("Could not read script: " + m_ScriptFile);
+        }
+        std::istream& script = m_ScriptFile.empty() ? std::cin : file;
+
+        m_Screen.MainMenu();
+
+        // One command per line, same as typed into the command prompt; '#' starts a comment
+        std::string line;
+        while (!m_InputHandler.ShouldQuit() && std::getline(script, line))
+        {
+            lineNumber++;
+            std::string_view command = std::string_view(line).substr(0, line.find('#'));
+            std::string_view rest    = command;
+            if (UI::NextWord(rest).empty())
+                continue;
+
+            m_InputHandler.Eval(command);
+            if (!m_InputHandler.ShouldQuit())
+                m_InputHandler.ExecCommandQueue();
+            commandCount++;
+        }
+    }
+    catch (std::exception& ex)
     {
         std::ostringstream message;
-        message << ex.what()
-                << "\n\nDun-geon will exit.";
-        m_Screen.OkMessageBox(message.str(), "Error");
-        return;
+        message << "Script failed at line " << lineNumber << ": " << ex.what() << "\n";
+        m_Report += message.str();
+        exitCode = 1;
+    }
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - startTime;
+    const auto& stats                     = m_Player.GetStats();
+    std::string ending                    = !m_InputHandler.ShouldQuit() ? "end of script"
+                                            : stats.Health <= 0          ? "game over"
+                                                                         : "quit";
+    std::ostringstream summary;
+    summary << "Ran " << commandCount << " commands from " << source << " in " << std::fixed << std::setprecision(3)
+            << elapsed.count() << " s (" << std::setprecision(0) << commandCount / std::max(elapsed.count(), 1e-9)
+            << " commands/s, seed " << m_Seed << ")\n"
+            << m_Player.GetName() << ": level " << stats.Level << ", " << m_Player.GetXP() << " XP, health "
+            << stats.Health << "/" << stats.MaxHealth << ", " << m_PlayerController.GetBattleCount() << " battles ("
+            << m_PlayerController.GetVictoryCount() << " won), ended by " << ending << "\n";
+    m_Report += summary.str();
+    return exitCode;
+}
+
+int Application::RunBattleReplay()
+{
+    int exitCode   = 0;
+    auto startTime = std::chrono::steady_clock::now();
+    try
+    {
+        auto record = Battle::BattleRecord::LoadFromFile(m_BattleReplayFile);
+        if (!record)
+            throw InvalidArgumentException("Could not read battle record: " + m_BattleReplayFile);
+
+        const auto& recordedPlayer = record->GetPlayer();
+        const auto& recordedEnemy  = record->GetEnemy();
+        Entities::Player player(recordedPlayer.Name, m_Player.GetIcon());
+        player.SetLevel(recordedPlayer.Stats.Level);
+        player.SetHealth(recordedPlayer.Stats.Health);
+        player.SetMana(recordedPlayer.Stats.Mana);
+        auto enemy = Entities::NPC::NPCGenerator::CreateEnemy(recordedEnemy.Name, recordedEnemy.Stats.Level);
+        if (!enemy)
+            throw InvalidArgumentException("Unknown enemy: " + recordedEnemy.Name);
+
+        Battle::Battle battle(player, *enemy);
+        Battle::BattleReplayer replayer(*record);
+        m_Screen.OpenBattleScreen(battle);
+        auto result = replayer.Replay(battle);
+        m_Screen.CloseSubscreen();
+
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - startTime;
+        std::string ending = result == Battle::Battle::Result::Victory    ? "victory"
+                             : result == Battle::Battle::Result::GameOver ? "game over"
+                                                                          : "escape";
+        std::ostringstream summary;
+        summary << "Replayed battle of " << player.GetName() << " against " << enemy->GetName() << " (level "
+                << recordedEnemy.Stats.Level << ") from " << m_BattleReplayFile << " in " << std::fixed
+                << std::setprecision(3) << elapsed.count() << " s: " << ending
+                << (replayer.HasDiverged() ? ", diverged from the record" : "") << "\n";
+        m_Report += summary.str();
+    }
+    catch (std::exception& ex)
+    {
+        m_Screen.CloseSubscreen();
+        m_Report += std::string("Battle replay failed: ") + ex.what() + "\n";
+        exitCode = 1;
     }
+    return exitCode;
 }
 
 } /* namespace Application */
@@ -1,11 +1,17 @@
 #pragma once
 
+#include "Application/Options.h"
+#include "Application/SessionRecord.h"
 #include "Entities/EntityManager.h"
 #include "Entities/Player.h"
 #include "Player/Controller.h"
 #include "UI/InputHandler.h"
 #include "UI/Screen.h"
 #include "Worlds/WorldManager.h"
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
 
 namespace Application
 {
@@ -18,21 +24,76 @@ class Application
 public:
     /**
      * @brief Constructor
+     * 
+     * @param options command line options
      */
-    Application();
+    explicit Application(const Options& options);
+
+    /**
+     * @brief Destructor
+     */
+    ~Application();
 
     /**
      * @brief Run the application
+     * 
+     * @return int exit code
      */
-    void Run();
+    int Run();
+
+    /**
+     * @brief Get the summary of a replay, battle replay or script, to be printed once the terminal is restored
+     * 
+     * @return const std::string& summary, empty when playing interactively
+     */
+    inline const std::string& GetReport() const { return m_Report; }
 
 private:
+    std::optional<SessionRecord> m_ReplayRecord;
+    std::unique_ptr<SessionReplayer> m_Replayer;
+    std::unique_ptr<SessionRecorder> m_Recorder;
+    std::string m_ReplayFile;
+    std::string m_BattleReplayFile;
+    std::string m_ScriptFile;
+    bool m_IsHeadless;
+    std::string m_Report;
+    uint64_t m_Seed;
     UI::InputHandler m_InputHandler;
     UI::Screen m_Screen;
     Worlds::WorldManager m_WorldManager;
     Entities::Player m_Player;
     Entities::EntityManager m_EntityManager;
     Player::Controller m_PlayerController;
+
+    /**
+     * @brief Load the session to replay or start recording a new one, then seed the RNG
+     * 
+     * @param options command line options
+     * @return uint64_t game seed
+     * @throw InvalidArgumentException if the session to replay or the script cannot be read
+     */
+    uint64_t StartSession(const Options& options);
+
+    /**
+     * @brief Play on the terminal, or replay a recorded session
+     * 
+     * @return int exit code
+     */
+    int RunInteractive();
+
+    /**
+     * @brief Run text commands through the input handler without a terminal until they run out or the game ends
+     * 
+     * @return int exit code
+     */
+    int RunScript();
+
+    /**
+     * @brief Rebuild the combatants of a recorded battle and replay it at full speed, or on the battle screen
+     * 
+     * @return int exit code
+     */
+    int RunBattleReplay();
 };
 
 } /* namespace Application */
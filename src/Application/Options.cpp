@@ -0,0 +1,113 @@
+#include "Options.h"
+#include "Misc/Exceptions.h"
+#include <cctype>
+#include <stdexcept>
+
+namespace Application
+{
+
+Options ParseOptions(int argc, const char* const argv[])
+{
+    Options options;
+
+    for (int i = 1; i < argc; i++)
+    {
+        std::string argument = argv[i];
+        std::string value;
+        bool hasValue = false;
+
+        size_t separatorPos = argument.find('=');
+        if (separatorPos != std::string::npos)
+        {
+            value    = argument.substr(separatorPos + 1);
+            argument = argument.substr(0, separatorPos);
+            hasValue = true;
+        }
+
+        if (argument == "-h" || argument == "--help")
+        {
+            options.ShowUsage = true;
+        }
+        else if (argument == "--realtime")
+        {
+            options.IsRealTime = true;
+        }
+        else if (argument == "--headless")
+        {
+            options.IsHeadless = true;
+        }
+        else if (argument == "--latency")
+        {
+            options.IsLatencyTracked = true;
+        }
+        else if (argument == "--speed" || argument == "--record" || argument == "--replay" || argument == "--script"
+                 || argument == "--seed" || argument == "--replay-battle")
+        {
+            if (!hasValue)
+            {
+                if (i + 1 >= argc)
+                    throw InvalidArgumentException("Missing value for " + argument);
+                value = argv[++i];
+            }
+            if (value.empty())
+                throw InvalidArgumentException("Empty value for " + argument);
+
+            if (argument == "--record")
+            {
+                options.RecordFile = value;
+            }
+            else if (argument == "--replay")
+            {
+                options.ReplayFile = value;
+            }
+            else if (argument == "--replay-battle")
+            {
+                options.BattleReplayFile = value;
+            }
+            else if (argument == "--script")
+            {
+                options.ScriptFile = value;
+                options.IsHeadless = true;
+            }
+            else if (argument == "--seed")
+            {
+                size_t parsedLength = 0;
+                try
+                {
+                    if (std::isdigit(static_cast<unsigned char>(value[0])))
+                        options.Seed = std::stoull(value, &parsedLength, 0);
+                }
+                catch (std::exception&)
+                {
+                }
+                if (parsedLength != value.size())
+                    throw InvalidArgumentException("Invalid value for --seed: " + value);
+            }
+            else
+            {
+                auto speed = UI::Animation::ParsePresentationSpeed(value);
+                if (!speed.has_value())
+                    throw InvalidArgumentException("Invalid value for --speed: " + value);
+                options.Speed = speed.value();
+            }
+        }
+        else
+        {
+            throw InvalidArgumentException("Unknown argument: " + argument);
+        }
+    }
+
+    bool isReplay = !options.ReplayFile.empty() || !options.BattleReplayFile.empty();
+    if (options.IsRealTime && !isReplay)
+        throw InvalidArgumentException("--realtime requires --replay or --replay-battle");
+    if (!options.ReplayFile.empty() && !options.BattleReplayFile.empty())
+        throw InvalidArgumentException("--replay cannot be combined with --replay-battle");
+    if (isReplay && (options.IsHeadless || options.Seed))
+        throw InvalidArgumentException("--replay cannot be combined with --script, --headless or --seed");
+    if (options.IsLatencyTracked && (options.IsHeadless || isReplay))
+        throw InvalidArgumentException("--latency only measures interactive sessions");
+
+    return options;
+}
+
+} /* namespace Application */
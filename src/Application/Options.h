@@ -0,0 +1,97 @@
+#pragma once
+
+#include "Application/SessionRecord.h"
+#include "UI/Animation/PresentationSpeed.h"
+#include <cstdint>
+#include <optional>
+#include <string>
+
+namespace Application
+{
+
+/**
+ * @brief Command line usage text
+ */
+static const std::string Usage = "Usage: dun-geon [options]\n"
+                                 "  --speed normal|fast|instant  animation speed (default: normal)\n"
+                                 "  --record FILE                record the session to FILE (default: "
+                                 "data/last-session.bin)\n"
+                                 "  --replay FILE                replay a recorded session without a terminal\n"
+                                 "  --replay-battle FILE         replay a recorded battle, e.g. data/last-battle.bin\n"
+                                 "  --realtime                   replay on the terminal at the recorded pace, or a "
+                                 "battle on the battle screen\n"
+                                 "  --script FILE                run the text commands in FILE without a terminal\n"
+                                 "  --headless                   run text commands from standard input without a "
+                                 "terminal\n"
+                                 "  --seed N                     start a new session with seed N\n"
+                                 "  --latency                    measure keypress-to-frame latency, written to "
+                                 "data/latency.txt\n"
+                                 "  -h, --help                   show this help\n";
+
+/**
+ * @brief Settings given on the command line
+ */
+struct Options
+{
+    /**
+     * @brief Animation presentation speed
+     */
+    UI::Animation::PresentationSpeed Speed = UI::Animation::PresentationSpeed::Normal;
+
+    /**
+     * @brief File to record the session to
+     */
+    std::string RecordFile = SessionRecord::LastSessionFilename;
+
+    /**
+     * @brief Recorded session to replay instead of reading the terminal, none if empty
+     */
+    std::string ReplayFile;
+
+    /**
+     * @brief Recorded battle to replay instead of playing, none if empty
+     */
+    std::string BattleReplayFile;
+
+    /**
+     * @brief Whether a replay shows on the terminal at the recorded pace instead of running as fast as possible
+     */
+    bool IsRealTime = false;
+
+    /**
+     * @brief Whether to run text commands without a terminal instead of playing interactively
+     */
+    bool IsHeadless = false;
+
+    /**
+     * @brief Text commands to run headless, one per line; standard input if empty
+     */
+    std::string ScriptFile;
+
+    /**
+     * @brief Seed of a new session, random if empty
+     */
+    std::optional<uint64_t> Seed;
+
+    /**
+     * @brief Whether to measure keypress-to-frame latency in an interactive session
+     */
+    bool IsLatencyTracked = false;
+
+    /**
+     * @brief Whether only the usage text should be printed
+     */
+    bool ShowUsage = false;
+};
+
+/**
+ * @brief Parse command line arguments
+ * Throws InvalidArgumentException on unknown or malformed arguments.
+ * 
+ * @param argc argument count
+ * @param argv argument values, the first of which is the program name
+ * @return Options parsed options
+ */
+Options ParseOptions(int argc, const char* const argv[]);
+
+} /* namespace Application */
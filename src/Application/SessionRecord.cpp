@@ -0,0 +1,175 @@
+#include "SessionRecord.h"
+#include "Misc/Exceptions.h"
+#include "Misc/Utils.h"
+#include "Misc/Varint.h"
+#include <algorithm>
+#include <array>
+#include <iterator>
+
+namespace Application
+{
+
+const std::string SessionRecord::LastSessionFilename = "data/last-session.bin";
+
+/**
+ * @brief Leading bytes of a serialized record
+ */
+static const std::array<uint8_t, 4> Magic { 'D', 'G', 'S', 'R' };
+
+/**
+ * @brief Format version of a serialized record
+ */
+constexpr static const int FormatVersion = 1;
+
+SessionRecord::SessionRecord(uint64_t seed) : m_Seed(seed)
+{
+}
+
+void SessionRecord::Append(const Key& key)
+{
+    m_Keys.push_back(key);
+}
+
+std::vector<uint8_t> SessionRecord::SerializeHeader(uint64_t seed)
+{
+    std::vector<uint8_t> data(Magic.begin(), Magic.end());
+    Varint::Write(data, FormatVersion);
+    Varint::Write(data, seed);
+    return data;
+}
+
+void SessionRecord::SerializeKey(std::vector<uint8_t>& out, const Key& key)
+{
+    Varint::Write(out, static_cast<uint64_t>(key.DelayMs) << 1 | key.IsPoll);
+    Varint::WriteSigned(out, key.Code);
+}
+
+std::vector<uint8_t> SessionRecord::Serialize() const
+{
+    auto data = SerializeHeader(m_Seed);
+    for (const auto& key : m_Keys)
+    {
+        SerializeKey(data, key);
+    }
+    return data;
+}
+
+std::optional<SessionRecord> SessionRecord::Deserialize(const std::vector<uint8_t>& data)
+{
+    if (data.size() < Magic.size() || !std::equal(Magic.begin(), Magic.end(), data.begin()))
+    {
+        return std::nullopt;
+    }
+
+    Varint::Reader reader(data.data() + Magic.size(), data.size() - Magic.size());
+    SessionRecord record;
+    try
+    {
+        if (reader.Read() != FormatVersion)
+        {
+            return std::nullopt;
+        }
+        record.m_Seed = reader.Read();
+    }
+    catch (InvalidArgumentException&)
+    {
+        return std::nullopt;
+    }
+
+    try
+    {
+        while (!reader.AtEnd())
+        {
+            uint64_t timing = reader.Read();
+            Key key { static_cast<uint32_t>(timing >> 1), (timing & 1) != 0, static_cast<int>(reader.ReadSigned()) };
+            record.m_Keys.push_back(key);
+        }
+    }
+    catch (InvalidArgumentException&)
+    {
+        // Truncated last key
+    }
+    return record;
+}
+
+std::optional<SessionRecord> SessionRecord::LoadFromFile(const std::string& filename)
+{
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.good())
+    {
+        return std::nullopt;
+    }
+    std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    return Deserialize(data);
+}
+
+SessionRecorder::SessionRecorder(const std::string& filename, uint64_t seed)
+    : m_File(filename, std::ios::binary | std::ios::trunc),
+      m_LastKeyTime(std::chrono::steady_clock::now())
+{
+    auto header = SessionRecord::SerializeHeader(seed);
+    m_File.write(reinterpret_cast<const char*>(header.data()), header.size());
+    m_File.flush();
+}
+
+bool SessionRecorder::IsGood() const
+{
+    return m_File.good();
+}
+
+std::optional<int> SessionRecorder::ReplayKey(bool isPoll)
+{
+    return std::nullopt;
+}
+
+void SessionRecorder::RecordKey(int key, bool isPoll)
+{
+    auto now     = std::chrono::steady_clock::now();
+    auto delayMs = std::chrono::duration_cast<std::chrono::milliseconds>(now - m_LastKeyTime).count();
+    m_LastKeyTime = now;
+
+    m_Buffer.clear();
+    SessionRecord::SerializeKey(m_Buffer, { static_cast<uint32_t>(delayMs), isPoll, key });
+    m_File.write(reinterpret_cast<const char*>(m_Buffer.data()), m_Buffer.size());
+    m_File.flush();
+}
+
+SessionReplayer::SessionReplayer(const SessionRecord& record, bool isRealTime)
+    : m_Record(record),
+      m_IsRealTime(isRealTime),
+      m_Position(0)
+{
+}
+
+std::optional<int> SessionReplayer::ReplayKey(bool isPoll)
+{
+    const auto& keys = m_Record.GetKeys();
+    if (isPoll)
+    {
+        return m_Position < keys.size() && keys[m_Position].IsPoll ? Take() : ERR;
+    }
+
+    while (m_Position < keys.size() && keys[m_Position].IsPoll)
+    {
+        m_Position++;
+    }
+    return Take();
+}
+
+int SessionReplayer::Take()
+{
+    const auto& keys = m_Record.GetKeys();
+    if (m_Position >= keys.size())
+    {
+        throw ReplayFinishedException("Replay finished after " + std::to_string(keys.size()) + " keys");
+    }
+
+    const auto& key = keys[m_Position++];
+    if (m_IsRealTime)
+    {
+        Sleep(key.DelayMs);
+    }
+    return key.Code;
+}
+
+} /* namespace Application */
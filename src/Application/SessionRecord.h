@@ -0,0 +1,189 @@
+#pragma once
+
+#include "UI/KeyInput.h"
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace Application
+{
+
+/**
+ * @brief Game seed and every key read during a session, which is enough to play the session again exactly
+ */
+class SessionRecord
+{
+public:
+    /**
+     * @brief File every interactive session is recorded to unless told otherwise
+     */
+    static const std::string LastSessionFilename;
+
+    /**
+     * @brief Recorded key
+     */
+    struct Key
+    {
+        /**
+         * @brief Time since the previous key in milliseconds
+         */
+        uint32_t DelayMs;
+
+        /**
+         * @brief True if the key was read by a poll, e.g. to skip an animation
+         */
+        bool IsPoll;
+
+        /**
+         * @brief Key code
+         */
+        int Code;
+    };
+
+    /**
+     * @brief Constructor
+     *
+     * @param seed game seed
+     */
+    explicit SessionRecord(uint64_t seed = 0);
+
+    /**
+     * @brief Get the game seed
+     */
+    inline uint64_t GetSeed() const { return m_Seed; }
+
+    /**
+     * @brief Get the recorded keys
+     */
+    inline const std::vector<Key>& GetKeys() const { return m_Keys; }
+
+    /**
+     * @brief Append a key
+     *
+     * @param key key
+     */
+    void Append(const Key& key);
+
+    /**
+     * @brief Encode the header, which is followed by the encoded keys
+     *
+     * @param seed game seed
+     * @return std::vector<uint8_t> encoded header
+     */
+    static std::vector<uint8_t> SerializeHeader(uint64_t seed);
+
+    /**
+     * @brief Encode a single key
+     *
+     * @param out output buffer
+     * @param key key
+     */
+    static void SerializeKey(std::vector<uint8_t>& out, const Key& key);
+
+    /**
+     * @brief Encode the whole record
+     *
+     * @return std::vector<uint8_t> encoded record
+     */
+    std::vector<uint8_t> Serialize() const;
+
+    /**
+     * @brief Decode a whole record
+     * A key cut off at the end, e.g. because the game crashed while writing it, is dropped.
+     *
+     * @param data encoded record
+     * @return std::optional<SessionRecord> record, empty if the data is not a valid record
+     */
+    static std::optional<SessionRecord> Deserialize(const std::vector<uint8_t>& data);
+
+    /**
+     * @brief Read a record from a file
+     *
+     * @param filename file name
+     * @return std::optional<SessionRecord> record, empty if the file is missing or not a valid record
+     */
+    static std::optional<SessionRecord> LoadFromFile(const std::string& filename);
+
+private:
+    uint64_t m_Seed;
+    std::vector<Key> m_Keys;
+};
+
+/**
+ * @brief Key tape writing every key to a file as soon as it is read, so the record survives a crash
+ */
+class SessionRecorder : public UI::KeyTape
+{
+public:
+    /**
+     * @brief Constructor, writes the header
+     *
+     * @param filename file to record to
+     * @param seed game seed
+     */
+    SessionRecorder(const std::string& filename, uint64_t seed);
+
+    /**
+     * @brief Check whether the file could be written
+     *
+     * @return true if recording
+     */
+    bool IsGood() const;
+
+    virtual std::optional<int> ReplayKey(bool isPoll) override;
+
+    virtual void RecordKey(int key, bool isPoll) override;
+
+private:
+    std::ofstream m_File;
+    std::chrono::steady_clock::time_point m_LastKeyTime;
+    std::vector<uint8_t> m_Buffer;
+};
+
+/**
+ * @brief Key tape supplying the keys of a record instead of reading the terminal
+ * Recorded polls are only handed to polls; a read skips any poll keys before it, which happens when animations
+ * run at a different speed than during recording. Game state is reproduced either way.
+ */
+class SessionReplayer : public UI::KeyTape
+{
+public:
+    /**
+     * @brief Constructor
+     *
+     * @param record record to replay
+     * @param isRealTime wait the recorded time before every key instead of replaying as fast as possible
+     */
+    SessionReplayer(const SessionRecord& record, bool isRealTime);
+
+    /**
+     * @brief Get the number of keys replayed or skipped so far
+     *
+     * @return size_t key count
+     */
+    inline size_t GetPosition() const { return m_Position; }
+
+    virtual std::optional<int> ReplayKey(bool isPoll) override;
+
+    /**
+     * @brief Ignore keys from the terminal
+     */
+    virtual void RecordKey(int key, bool isPoll) override {}
+
+private:
+    const SessionRecord& m_Record;
+    bool m_IsRealTime;
+    size_t m_Position;
+
+    /**
+     * @brief Hand out the next key
+     *
+     * @return int key code
+     */
+    int Take();
+};
+
+} /* namespace Application */
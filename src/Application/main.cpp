@@ -1,13 +1,50 @@
 #include "Application/Application.h"
+#include "Application/Options.h"
+#include "Misc/Exceptions.h"
+#include <iostream>
+#include <string>
 
 /**
  * @brief Main function
  * 
+ * @param argc argument count
+ * @param argv argument values
  * @return int exit code
  */
-int main()
+int main(int argc, char* argv[])
 {
-    Application::Application application;
-    application.Run();
-    return 0;
+    Application::Options options;
+    try
+    {
+        options = Application::ParseOptions(argc, argv);
+    }
+    catch (InvalidArgumentException& ex)
+    {
+        std::cerr << ex.what() << "\n" << Application::Usage;
+        return 1;
+    }
+
+    if (options.ShowUsage)
+    {
+        std::cout << Application::Usage;
+        return 0;
+    }
+
+    int exitCode = 0;
+    std::string report;
+    try
+    {
+        // The terminal is restored when the application is destroyed, print nothing before
+        Application::Application application(options);
+        exitCode = application.Run();
+        report   = application.GetReport();
+    }
+    catch (InvalidArgumentException& ex)
+    {
+        std::cerr << ex.what() << "\n";
+        return 1;
+    }
+
+    std::cout << report;
+    return exitCode;
 }
@@ -1,24 +1,16 @@
 #pragma once
 
-#include "Effect.h"
-#include "Misc/Exceptions.h"
+#include "BattleProfile.h"
 #include "Misc/RNG.h"
 #include "Skill.h"
-#include <memory>
-
-namespace UI
-{
-class BattleScreen;
-}
 
 namespace Battle
 {
 
-struct ApplyEffectOnlySkillResult : public Skill::SkillResult
-{
-};
-
-template<typename EffectType> class ApplyEffectOnlySkill : public Skill
+/**
+ * @brief Part of ApplyEffectOnlySkill which does not depend on the effect type
+ */
+class ApplyEffectOnlySkillBase : public Skill
 {
 public:
     /**
@@ -33,23 +25,55 @@ public:
      * @param baseHitChance base hit chance
      * @param baseDuration base duration
      * @param baseManaCost base mana cost
+     * @param actionCost action cost, in initiative time units
      */
-    ApplyEffectOnlySkill(Category category,
-                         Target targetType,
-                         const std::string& name,
-                         const std::string& flavorText,
-                         const std::string& longDescription,
-                         const std::string& effectDescription,
-                         int baseHitChance,
-                         int baseDuration,
-                         int baseManaCost)
-        : Skill(category, targetType, name, flavorText, longDescription, baseManaCost),
+    ApplyEffectOnlySkillBase(Category category,
+                             Target targetType,
+                             const std::string& name,
+                             const std::string& flavorText,
+                             const std::string& longDescription,
+                             const std::string& effectDescription,
+                             int baseHitChance,
+                             int baseDuration,
+                             int baseManaCost,
+                             int actionCost = StandardActionCost)
+        : Skill(category, targetType, name, flavorText, longDescription, baseManaCost, actionCost),
           m_BaseHitChance(baseHitChance),
           m_BaseDuration(baseDuration),
           m_EffectDescription(effectDescription)
     {
     }
 
+    /**
+     * @brief Calculate effective hit chance for a particular instance
+     *
+     * @param userProfile skill user profile
+     * @param targetProfile skill target profile
+     * @return int effective hit chance
+     */
+    virtual int CalculateHitChance(const BattleProfile& userProfile, const BattleProfile& targetProfile) const override
+    {
+        return m_BaseHitChance;
+    }
+
+    /**
+     * @brief Get the Effect Description
+     * 
+     * @return const std::string& effect description
+     */
+    inline const std::string& GetEffectDescription() const { return m_EffectDescription; }
+
+protected:
+    int m_BaseHitChance;
+    int m_BaseDuration;
+    std::string m_EffectDescription;
+};
+
+template<typename EffectType> class ApplyEffectOnlySkill : public ApplyEffectOnlySkillBase
+{
+public:
+    using ApplyEffectOnlySkillBase::ApplyEffectOnlySkillBase;
+
     /**
      * @brief Destructor
      */
@@ -60,62 +84,29 @@ public:
      *
      * @param userProfile user battle profile
      * @param targetProfile target battle profile to apply effects to
+     * @return SkillResult result
      */
-    virtual void ApplySkill(const BattleProfile& userProfile, BattleProfile& targetProfile) override
+    virtual SkillResult ApplySkill(const BattleProfile& userProfile, BattleProfile& targetProfile) const override
     {
-        m_LastApplyResult.reset();
         bool hit = RNG::Chance(CalculateHitChance(userProfile, targetProfile) / 100.);
         if (hit)
         {
-            auto& effect = targetProfile.ActiveEffects.emplace_back(
-                std::make_unique<EffectType>(userProfile, targetProfile, m_BaseDuration));
-            effect->Apply();
+            ApplyEffects(userProfile, targetProfile);
         }
 
-        m_LastApplyResult = std::make_unique<ApplyEffectOnlySkillResult>(ApplyEffectOnlySkillResult { hit });
+        return ApplyEffectOnlySkillResult { hit };
     }
 
     /**
-     * @brief Send data to the battle screen to draw the hover thumbnail
-     *
-     * @param battleScreen battle screen
-     */
-    virtual void OnBattleMenuHover(UI::BattleScreen& battleScreen) override;
-
-    /**
-     * @brief Get the SkillResult of the last skill usage
+     * @brief Apply the effect to the target without rolling for it
      *
-     * @param battleScreen battle screen
-     * @param isPlayer true if the user is the player
-     */
-    virtual void AnimateTo(UI::BattleScreen& battleScreen, bool isPlayer) const override;
-
-    /**
-     * @brief Calculate effective hit chance for a particular instance
-     *
-     * @param userProfile skill user profile
-     * @param targetProfile skill target profile
-     * @return int effective hit chance
+     * @param userProfile user battle profile
+     * @param targetProfile target battle profile to apply effects to
      */
-    virtual int CalculateHitChance(const BattleProfile& userProfile, const BattleProfile& targetProfile) const
+    virtual void ApplyEffects(const BattleProfile& userProfile, BattleProfile& targetProfile) const override
     {
-        return m_BaseHitChance;
+        targetProfile.ApplyEffect(EffectType(userProfile, m_BaseDuration));
     }
-
-    /**
-     * @brief Get the Effect Description
-     * 
-     * @return const std::string& effect description
-     */
-    inline const std::string& GetEffectDescription() const { return m_EffectDescription; }
-
-protected:
-    int m_BaseHitChance;
-    int m_BaseDuration;
-    std::string m_EffectDescription;
-
-private:
-    std::unique_ptr<ApplyEffectOnlySkillResult> m_LastApplyResult;
 };
 
 } /* namespace Battle */
\ No newline at end of file
@@ -0,0 +1,402 @@
+#include "AttackKernel.h"
+#include "Misc/Exceptions.h"
+#include "Misc/RNG.h"
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define DUNGEON_ATTACK_KERNEL_X86
+#endif
+
+namespace Battle::AttackKernel
+{
+
+/**
+ * @brief Inputs and outputs of the chance calculations
+ */
+struct ChanceLanes
+{
+    const int* UserLevel;
+    const int* UserDexterity;
+    const int* UserSorcery;
+    const int* TargetLevel;
+    const int* TargetDexterity;
+    int BaseHitChance;
+    int BaseCritChance;
+    bool IsSpell;
+    int* HitChance;
+    int* CritChance;
+    size_t Size;
+};
+
+/**
+ * @brief Inputs and outputs of the crit and resistance calculations
+ */
+struct DamageLanes
+{
+    const uint8_t* IsCrit;
+    const int* MinDamage;
+    const int* MaxDamage;
+    const int* Resistance;
+    int* Damage;
+    size_t Size;
+};
+
+/**
+ * @brief Calculate chances one pair at a time
+ *
+ * @param lanes lanes
+ * @param begin first pair to process
+ */
+static void ChancesScalar(const ChanceLanes& lanes, size_t begin)
+{
+    for (size_t i = begin; i < lanes.Size; i++)
+    {
+        lanes.HitChance[i]  = AttackSkill::HitChance(lanes.BaseHitChance,
+                                                    lanes.UserLevel[i],
+                                                    lanes.UserDexterity[i],
+                                                    lanes.TargetLevel[i],
+                                                    lanes.TargetDexterity[i]);
+        lanes.CritChance[i] = AttackSkill::CritChance(lanes.BaseCritChance,
+                                                      lanes.IsSpell,
+                                                      lanes.UserLevel[i],
+                                                      lanes.UserDexterity[i],
+                                                      lanes.UserSorcery[i],
+                                                      lanes.TargetLevel[i]);
+    }
+}
+
+/**
+ * @brief Apply crits and resistances one pair at a time
+ *
+ * @param lanes lanes
+ * @param begin first pair to process
+ */
+static void DamageScalar(const DamageLanes& lanes, size_t begin)
+{
+    for (size_t i = begin; i < lanes.Size; i++)
+    {
+        int damage = lanes.Damage[i];
+        if (lanes.IsCrit[i])
+            damage = AttackSkill::ApplyCrit(damage, { lanes.MinDamage[i], lanes.MaxDamage[i] });
+        lanes.Damage[i] = AttackSkill::ApplyResistance(damage, lanes.Resistance[i]);
+    }
+}
+
+#ifdef DUNGEON_ATTACK_KERNEL_X86
+
+// The vector paths repeat the scalar formulas operation by operation, without FMA contraction, so every
+// intermediate double is rounded exactly like in AttackSkill. Chances are non-negative after clamping, where
+// lround is truncation plus one if the remaining fraction is at least a half.
+
+__attribute__((target("sse4.1"))) static inline __m128d RoundSSE41(__m128d value)
+{
+    __m128d truncated = _mm_round_pd(value, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+    __m128d roundUp   = _mm_cmpge_pd(_mm_sub_pd(value, truncated), _mm_set1_pd(0.5));
+    return _mm_add_pd(truncated, _mm_and_pd(roundUp, _mm_set1_pd(1.0)));
+}
+
+__attribute__((target("sse4.1"))) static inline __m128d ClampSSE41(__m128d value)
+{
+    return _mm_min_pd(_mm_max_pd(value, _mm_setzero_pd()), _mm_set1_pd(100.0));
+}
+
+__attribute__((target("sse4.1"))) static inline __m128d Load2SSE41(const int* source)
+{
+    return _mm_cvtepi32_pd(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(source)));
+}
+
+/**
+ * @brief Calculate chances two pairs at a time
+ *
+ * @param lanes lanes
+ * @return size_t number of pairs processed
+ */
+__attribute__((target("sse4.1"))) static size_t ChancesSSE41(const ChanceLanes& lanes)
+{
+    const __m128d zero      = _mm_setzero_pd();
+    const __m128d hundred   = _mm_set1_pd(100.0);
+    const __m128d baseHit   = _mm_set1_pd(lanes.BaseHitChance);
+    const __m128d baseCrit  = _mm_set1_pd(lanes.BaseCritChance);
+    const __m128d critScale = _mm_set1_pd(lanes.IsSpell ? 0.1 : 0.05);
+    const int* critStat     = lanes.IsSpell ? lanes.UserSorcery : lanes.UserDexterity;
+
+    size_t i = 0;
+    for (; i + 2 <= lanes.Size; i += 2)
+    {
+        __m128i userLevel   = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(lanes.UserLevel + i));
+        __m128i targetLevel = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(lanes.TargetLevel + i));
+
+        __m128d levelDodge = _mm_max_pd(
+            _mm_mul_pd(_mm_cvtepi32_pd(_mm_sub_epi32(targetLevel, userLevel)), _mm_set1_pd(2.5)), zero);
+        __m128d dodge = _mm_add_pd(levelDodge, _mm_div_pd(Load2SSE41(lanes.TargetDexterity + i), _mm_set1_pd(7.0)));
+        __m128d hit   = _mm_div_pd(
+            _mm_mul_pd(_mm_add_pd(baseHit, _mm_div_pd(Load2SSE41(lanes.UserDexterity + i), _mm_set1_pd(4.0))),
+                       _mm_sub_pd(hundred, dodge)),
+            hundred);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(lanes.HitChance + i),
+                         _mm_cvttpd_epi32(RoundSSE41(ClampSSE41(hit))));
+
+        __m128d levelFactor = _mm_mul_pd(_mm_cvtepi32_pd(_mm_sub_epi32(userLevel, targetLevel)), _mm_set1_pd(0.5));
+        __m128d crit = _mm_add_pd(_mm_add_pd(baseCrit, _mm_mul_pd(critScale, Load2SSE41(critStat + i))), levelFactor);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(lanes.CritChance + i),
+                         _mm_cvttpd_epi32(RoundSSE41(ClampSSE41(crit))));
+    }
+    return i;
+}
+
+/**
+ * @brief Apply crits and resistances two pairs at a time
+ *
+ * @param lanes lanes
+ * @return size_t number of pairs processed
+ */
+__attribute__((target("sse4.1"))) static size_t DamageSSE41(const DamageLanes& lanes)
+{
+    size_t i = 0;
+    for (; i + 2 <= lanes.Size; i += 2)
+    {
+        uint16_t critBytes;
+        std::memcpy(&critBytes, lanes.IsCrit + i, sizeof(critBytes));
+        __m128i critMask = _mm_cmpgt_epi32(_mm_cvtepu8_epi32(_mm_cvtsi32_si128(critBytes)), _mm_setzero_si128());
+
+        __m128i damage     = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(lanes.Damage + i));
+        __m128i maxDamage  = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(lanes.MaxDamage + i));
+        __m128i critDamage = _mm_max_epi32(_mm_cvttpd_epi32(_mm_mul_pd(_mm_cvtepi32_pd(damage), _mm_set1_pd(1.4))),
+                                           maxDamage);
+        damage             = _mm_blendv_epi8(damage, critDamage, critMask);
+
+        __m128i resistance = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(lanes.Resistance + i));
+        __m128d factor     = _mm_div_pd(_mm_cvtepi32_pd(_mm_sub_epi32(_mm_set1_epi32(100), resistance)),
+                                    _mm_set1_pd(100.0));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(lanes.Damage + i),
+                         _mm_cvttpd_epi32(_mm_mul_pd(_mm_cvtepi32_pd(damage), factor)));
+    }
+    return i;
+}
+
+__attribute__((target("avx2"))) static inline __m256d RoundAVX2(__m256d value)
+{
+    __m256d truncated = _mm256_round_pd(value, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+    __m256d roundUp   = _mm256_cmp_pd(_mm256_sub_pd(value, truncated), _mm256_set1_pd(0.5), _CMP_GE_OQ);
+    return _mm256_add_pd(truncated, _mm256_and_pd(roundUp, _mm256_set1_pd(1.0)));
+}
+
+__attribute__((target("avx2"))) static inline __m256d ClampAVX2(__m256d value)
+{
+    return _mm256_min_pd(_mm256_max_pd(value, _mm256_setzero_pd()), _mm256_set1_pd(100.0));
+}
+
+__attribute__((target("avx2"))) static inline __m256d Load4AVX2(const int* source)
+{
+    return _mm256_cvtepi32_pd(_mm_loadu_si128(reinterpret_cast<const __m128i*>(source)));
+}
+
+/**
+ * @brief Calculate chances four pairs at a time
+ *
+ * @param lanes lanes
+ * @return size_t number of pairs processed
+ */
+__attribute__((target("avx2"))) static size_t ChancesAVX2(const ChanceLanes& lanes)
+{
+    const __m256d zero      = _mm256_setzero_pd();
+    const __m256d hundred   = _mm256_set1_pd(100.0);
+    const __m256d baseHit   = _mm256_set1_pd(lanes.BaseHitChance);
+    const __m256d baseCrit  = _mm256_set1_pd(lanes.BaseCritChance);
+    const __m256d critScale = _mm256_set1_pd(lanes.IsSpell ? 0.1 : 0.05);
+    const int* critStat     = lanes.IsSpell ? lanes.UserSorcery : lanes.UserDexterity;
+
+    size_t i = 0;
+    for (; i + 4 <= lanes.Size; i += 4)
+    {
+        __m128i userLevel   = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lanes.UserLevel + i));
+        __m128i targetLevel = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lanes.TargetLevel + i));
+
+        __m256d levelDodge = _mm256_max_pd(
+            _mm256_mul_pd(_mm256_cvtepi32_pd(_mm_sub_epi32(targetLevel, userLevel)), _mm256_set1_pd(2.5)), zero);
+        __m256d dodge = _mm256_add_pd(levelDodge,
+                                      _mm256_div_pd(Load4AVX2(lanes.TargetDexterity + i), _mm256_set1_pd(7.0)));
+        __m256d hit   = _mm256_div_pd(
+            _mm256_mul_pd(
+                _mm256_add_pd(baseHit, _mm256_div_pd(Load4AVX2(lanes.UserDexterity + i), _mm256_set1_pd(4.0))),
+                _mm256_sub_pd(hundred, dodge)),
+            hundred);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes.HitChance + i),
+                         _mm256_cvttpd_epi32(RoundAVX2(ClampAVX2(hit))));
+
+        __m256d levelFactor = _mm256_mul_pd(_mm256_cvtepi32_pd(_mm_sub_epi32(userLevel, targetLevel)),
+                                            _mm256_set1_pd(0.5));
+        __m256d crit        = _mm256_add_pd(
+            _mm256_add_pd(baseCrit, _mm256_mul_pd(critScale, Load4AVX2(critStat + i))), levelFactor);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes.CritChance + i),
+                         _mm256_cvttpd_epi32(RoundAVX2(ClampAVX2(crit))));
+    }
+    return i;
+}
+
+/**
+ * @brief Apply crits and resistances four pairs at a time
+ *
+ * @param lanes lanes
+ * @return size_t number of pairs processed
+ */
+__attribute__((target("avx2"))) static size_t DamageAVX2(const DamageLanes& lanes)
+{
+    size_t i = 0;
+    for (; i + 4 <= lanes.Size; i += 4)
+    {
+        int critBytes;
+        std::memcpy(&critBytes, lanes.IsCrit + i, sizeof(critBytes));
+        __m128i critMask = _mm_cmpgt_epi32(_mm_cvtepu8_epi32(_mm_cvtsi32_si128(critBytes)), _mm_setzero_si128());
+
+        __m128i damage     = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lanes.Damage + i));
+        __m128i maxDamage  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lanes.MaxDamage + i));
+        __m128i critDamage = _mm_max_epi32(
+            _mm256_cvttpd_epi32(_mm256_mul_pd(_mm256_cvtepi32_pd(damage), _mm256_set1_pd(1.4))), maxDamage);
+        damage             = _mm_blendv_epi8(damage, critDamage, critMask);
+
+        __m128i resistance = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lanes.Resistance + i));
+        __m256d factor     = _mm256_div_pd(_mm256_cvtepi32_pd(_mm_sub_epi32(_mm_set1_epi32(100), resistance)),
+                                       _mm256_set1_pd(100.0));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes.Damage + i),
+                         _mm256_cvttpd_epi32(_mm256_mul_pd(_mm256_cvtepi32_pd(damage), factor)));
+    }
+    return i;
+}
+
+#endif /* DUNGEON_ATTACK_KERNEL_X86 */
+
+/**
+ * @brief Detect the best instruction set supported by the CPU
+ *
+ * @return InstructionSet instruction set
+ */
+static InstructionSet DetectInstructionSet()
+{
+#ifdef DUNGEON_ATTACK_KERNEL_X86
+    if (__builtin_cpu_supports("avx2"))
+        return InstructionSet::AVX2;
+    if (__builtin_cpu_supports("sse4.1"))
+        return InstructionSet::SSE41;
+#endif
+    return InstructionSet::Scalar;
+}
+
+InstructionSet SupportedInstructionSet()
+{
+    static const InstructionSet supported = DetectInstructionSet();
+    return supported;
+}
+
+/**
+ * @brief Make sure an instruction set can be used
+ *
+ * @param instructionSet instruction set
+ * @param caller calling function for the error message
+ * @throw InvalidArgumentException if not supported
+ */
+static void CheckInstructionSet(InstructionSet instructionSet, const std::string& caller)
+{
+    if (static_cast<int>(instructionSet) > static_cast<int>(SupportedInstructionSet()))
+    {
+        throw InvalidArgumentException("AttackKernel::" + caller + "() failed - instruction set not supported");
+    }
+}
+
+void Project(const AttackSkill& skill,
+             const ProfileBatch& users,
+             const ProfileBatch& targets,
+             BatchResult& result,
+             InstructionSet instructionSet)
+{
+    CheckInstructionSet(instructionSet, "Project");
+    if (users.Size() != targets.Size())
+    {
+        throw InvalidArgumentException("AttackKernel::Project() failed - batch sizes differ");
+    }
+
+    size_t size = users.Size();
+    result.HitChance.resize(size);
+    result.CritChance.resize(size);
+    result.MinDamage.resize(size);
+    result.MaxDamage.resize(size);
+    skill.CalculateEffectiveDamageBatch(skill.GetBaseDamageRange().first, users, targets, result.MinDamage.data());
+    skill.CalculateEffectiveDamageBatch(skill.GetBaseDamageRange().second, users, targets, result.MaxDamage.data());
+
+    ChanceLanes lanes { users.Level.data(),
+                        users.Dexterity.data(),
+                        users.Sorcery.data(),
+                        targets.Level.data(),
+                        targets.Dexterity.data(),
+                        skill.GetBaseHitChance(),
+                        skill.GetBaseCritChance(),
+                        skill.GetCategory() == Skill::Category::Spell,
+                        result.HitChance.data(),
+                        result.CritChance.data(),
+                        size };
+
+    size_t done = 0;
+#ifdef DUNGEON_ATTACK_KERNEL_X86
+    if (instructionSet == InstructionSet::AVX2)
+        done = ChancesAVX2(lanes);
+    else if (instructionSet == InstructionSet::SSE41)
+        done = ChancesSSE41(lanes);
+#endif
+    ChancesScalar(lanes, done);
+}
+
+void Sample(const AttackSkill& skill, const ProfileBatch& targets, BatchResult& result, InstructionSet instructionSet)
+{
+    CheckInstructionSet(instructionSet, "Sample");
+    size_t size = result.HitChance.size();
+    if (targets.Size() != size)
+    {
+        throw InvalidArgumentException("AttackKernel::Sample() failed - batch sizes differ");
+    }
+
+    // Same draws in the same order as AttackSkill::ApplySkill
+    result.IsHit.resize(size);
+    result.IsCrit.resize(size);
+    result.Damage.resize(size);
+    for (size_t i = 0; i < size; i++)
+    {
+        result.IsHit[i] = RNG::Chance(result.HitChance[i] / 100.);
+        if (!result.IsHit[i])
+        {
+            result.IsCrit[i] = false;
+            result.Damage[i] = 0;
+            continue;
+        }
+        result.Damage[i] = RNG::RandomInt(result.MinDamage[i], result.MaxDamage[i] + 1);
+        result.IsCrit[i] = RNG::Chance(result.CritChance[i] / 100.);
+    }
+
+    DamageLanes lanes { result.IsCrit.data(),
+                        result.MinDamage.data(),
+                        result.MaxDamage.data(),
+                        targets.Resistances[skill.GetDamageType().ToInt()].data(),
+                        result.Damage.data(),
+                        size };
+
+    size_t done = 0;
+#ifdef DUNGEON_ATTACK_KERNEL_X86
+    if (instructionSet == InstructionSet::AVX2)
+        done = DamageAVX2(lanes);
+    else if (instructionSet == InstructionSet::SSE41)
+        done = DamageSSE41(lanes);
+#endif
+    DamageScalar(lanes, done);
+}
+
+void Resolve(const AttackSkill& skill,
+             const ProfileBatch& users,
+             const ProfileBatch& targets,
+             BatchResult& result,
+             InstructionSet instructionSet)
+{
+    Project(skill, users, targets, result, instructionSet);
+    Sample(skill, targets, result, instructionSet);
+}
+
+} /* namespace Battle::AttackKernel */
@@ -0,0 +1,97 @@
+#pragma once
+
+#include "AttackSkill.h"
+#include "ProfileBatch.h"
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Batched attack resolution over structure-of-arrays profiles
+ * Chances, damage ranges, crits and resistances are computed with SIMD instructions where the CPU supports them,
+ * with results identical to AttackSkill for every pair. Random sampling stays sequential and draws in the same
+ * order as AttackSkill::ApplySkill, so a batch resolved after RNG::Seed matches the same attacks made one by one.
+ */
+namespace Battle::AttackKernel
+{
+
+/**
+ * @brief Instruction set used by the kernel, in order of preference
+ */
+enum class InstructionSet
+{
+    Scalar,
+    SSE41,
+    AVX2
+};
+
+/**
+ * @brief Projected and sampled outcomes of a batch of attacks
+ */
+struct BatchResult
+{
+    std::vector<int> HitChance;
+    std::vector<int> CritChance;
+    std::vector<int> MinDamage;
+    std::vector<int> MaxDamage;
+    std::vector<uint8_t> IsHit;
+    std::vector<uint8_t> IsCrit;
+
+    /**
+     * @brief Damage dealt, after crit and resistance
+     */
+    std::vector<int> Damage;
+};
+
+/**
+ * @brief Get the best instruction set supported by the CPU
+ *
+ * @return InstructionSet instruction set
+ */
+InstructionSet SupportedInstructionSet();
+
+/**
+ * @brief Calculate hit chance, crit chance and damage range of a skill for every user/target pair
+ *
+ * @param skill attack skill
+ * @param users user profiles
+ * @param targets target profiles, same size as users
+ * @param result result to fill the projections of
+ * @param instructionSet instruction set to use, at most the supported one
+ * @throw InvalidArgumentException if the batch sizes differ or the instruction set is not supported
+ */
+void Project(const AttackSkill& skill,
+             const ProfileBatch& users,
+             const ProfileBatch& targets,
+             BatchResult& result,
+             InstructionSet instructionSet = SupportedInstructionSet());
+
+/**
+ * @brief Sample the outcome of every projected attack, then apply crits and resistances
+ *
+ * @param skill attack skill
+ * @param targets target profiles
+ * @param result result with projections, to fill the outcomes of
+ * @param instructionSet instruction set to use, at most the supported one
+ * @throw InvalidArgumentException if the instruction set is not supported
+ */
+void Sample(const AttackSkill& skill,
+            const ProfileBatch& targets,
+            BatchResult& result,
+            InstructionSet instructionSet = SupportedInstructionSet());
+
+/**
+ * @brief Project and sample a batch of attacks
+ *
+ * @param skill attack skill
+ * @param users user profiles
+ * @param targets target profiles, same size as users
+ * @param result result to fill
+ * @param instructionSet instruction set to use, at most the supported one
+ */
+void Resolve(const AttackSkill& skill,
+             const ProfileBatch& users,
+             const ProfileBatch& targets,
+             BatchResult& result,
+             InstructionSet instructionSet = SupportedInstructionSet());
+
+} /* namespace Battle::AttackKernel */
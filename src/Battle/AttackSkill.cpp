@@ -1,7 +1,5 @@
 #include "AttackSkill.h"
-#include "Misc/Exceptions.h"
 #include "Misc/RNG.h"
-#include "UI/BattleScreen.h"
 #include <algorithm>
 #include <cmath>
 
@@ -16,8 +14,9 @@ AttackSkill::AttackSkill(Category category,
                          DamageType damageType,
                          int baseHitChance,
                          int baseCritChance,
-                         int baseManaCost)
-    : Skill(category, Target::Opponent, name, flavorText, longDescription, baseManaCost),
+                         int baseManaCost,
+                         int actionCost)
+    : Skill(category, Target::Opponent, name, flavorText, longDescription, baseManaCost, actionCost),
       m_BaseDamageRange(baseDamageRange),
       m_DamageType(damageType),
       m_BaseHitChance(baseHitChance),
@@ -25,15 +24,12 @@ AttackSkill::AttackSkill(Category category,
 {
 }
 
-void AttackSkill::ApplySkill(const BattleProfile& userProfile, BattleProfile& targetProfile)
+SkillResult AttackSkill::ApplySkill(const BattleProfile& userProfile, BattleProfile& targetProfile) const
 {
-    m_LastApplyResult.reset();
     bool hit = RNG::Chance(CalculateHitChance(userProfile, targetProfile) / 100.);
     if (!hit)
     {
-        m_LastApplyResult = std::make_unique<AttackSkillResult>(
-            AttackSkillResult { false, false, DamageInstance { 0, m_DamageType } });
-        return;
+        return AttackSkillResult { false, false, DamageInstance { 0, m_DamageType } };
     }
 
     auto damageRange = CalculateEffectiveDamageRange(userProfile, targetProfile);
@@ -42,67 +38,98 @@ void AttackSkill::ApplySkill(const BattleProfile& userProfile, BattleProfile& ta
     bool crit = RNG::Chance(CalculateCritChance(userProfile, targetProfile) / 100.);
     if (crit)
     {
-        // Guarantee damage will be at least the top end of the damage range, or add 40 %
-        damage = std::max(static_cast<int>(damage * 1.4), damageRange.second);
+        damage = ApplyCrit(damage, damageRange);
     }
 
     // Damage modifiers
-    damage *= (100 - targetProfile.Resistances[m_DamageType.ToInt()]) / 100.0;
+    damage = ApplyResistance(damage, targetProfile.Resistances[m_DamageType.ToInt()]);
 
     targetProfile.Stats.Health -= damage;
 
-    m_LastApplyResult = std::make_unique<AttackSkillResult>(
-        AttackSkillResult { true, crit, DamageInstance { damage, m_DamageType } });
+    return AttackSkillResult { true, crit, DamageInstance { damage, m_DamageType } };
 }
 
-void AttackSkill::OnBattleMenuHover(UI::BattleScreen& battleScreen)
+std::pair<int, int> AttackSkill::CalculateEffectiveDamageRange(const BattleProfile& userProfile,
+                                                               const BattleProfile& targetProfile) const
 {
-    battleScreen.ProjectSkillUse(*this);
-    battleScreen.PrintSkillHoverThumbnailInfo(*this);
+    return { CalculateEffectiveDamage(m_BaseDamageRange.first, userProfile, targetProfile),
+             CalculateEffectiveDamage(m_BaseDamageRange.second, userProfile, targetProfile) };
 }
 
-void AttackSkill::AnimateTo(UI::BattleScreen& battleScreen, bool isPlayer) const
+void AttackSkill::CalculateEffectiveDamageBatch(int baseDamage,
+                                                const ProfileBatch& users,
+                                                const ProfileBatch& targets,
+                                                int* out) const
 {
-    if (!m_LastApplyResult)
+    BattleProfile user({});
+    BattleProfile target({});
+    for (size_t i = 0; i < users.Size(); i++)
     {
-        throw CustomException("AttackSkill::AnimateTo() failed - no last usage record");
+        users.Get(i, user);
+        targets.Get(i, target);
+        out[i] = CalculateEffectiveDamage(baseDamage, user, target);
     }
+}
 
-    if (isPlayer)
-    {
-        battleScreen.AnimatePlayerAttack(*m_LastApplyResult);
-    }
-    else
-    {
-        battleScreen.AnimateEnemyAttack(*m_LastApplyResult, m_Name);
-    }
+int AttackSkill::CalculateHitChance(const BattleProfile& userProfile, const BattleProfile& targetProfile) const
+{
+    return HitChance(m_BaseHitChance,
+                     userProfile.Stats.Level,
+                     userProfile.Stats.Dexterity,
+                     targetProfile.Stats.Level,
+                     targetProfile.Stats.Dexterity);
 }
 
-std::pair<int, int> AttackSkill::CalculateEffectiveDamageRange(const BattleProfile& userProfile,
-                                                               const BattleProfile& targetProfile) const
+int AttackSkill::CalculateCritChance(const BattleProfile& userProfile, const BattleProfile& targetProfile) const
 {
-    return { CalculateEffectiveDamage(m_BaseDamageRange.first, userProfile, targetProfile),
-             CalculateEffectiveDamage(m_BaseDamageRange.second, userProfile, targetProfile) };
+    return CritChance(m_BaseCritChance,
+                      m_Category == Category::Spell,
+                      userProfile.Stats.Level,
+                      userProfile.Stats.Dexterity,
+                      userProfile.Stats.Sorcery,
+                      targetProfile.Stats.Level);
 }
 
-int AttackSkill::CalculateHitChance(const BattleProfile& userProfile, const BattleProfile& targetProfile) const
+OutcomeDistribution AttackSkill::CalculateOutcomeDistribution(const BattleProfile& userProfile,
+                                                              const BattleProfile& targetProfile) const
 {
-    int levelDifference      = targetProfile.Stats.Level - userProfile.Stats.Level;
-    double targetDodgeChance = (levelDifference > 0 ? levelDifference * 2.5 : 0) + targetProfile.Stats.Dexterity / 7.0;
-    return lround(std::clamp(
-        (m_BaseHitChance + userProfile.Stats.Dexterity / 4.0) * (100 - targetDodgeChance) / 100.0, 0.0, 100.0));
+    return OutcomeDistribution(CalculateHitChance(userProfile, targetProfile),
+                               CalculateCritChance(userProfile, targetProfile),
+                               CalculateEffectiveDamageRange(userProfile, targetProfile),
+                               targetProfile.Resistances[m_DamageType.ToInt()]);
 }
 
-int AttackSkill::CalculateCritChance(const BattleProfile& userProfile, const BattleProfile& targetProfile) const
+int AttackSkill::HitChance(int baseHitChance, int userLevel, int userDexterity, int targetLevel, int targetDexterity)
+{
+    int levelDifference      = targetLevel - userLevel;
+    double targetDodgeChance = (levelDifference > 0 ? levelDifference * 2.5 : 0) + targetDexterity / 7.0;
+    return lround(
+        std::clamp((baseHitChance + userDexterity / 4.0) * (100 - targetDodgeChance) / 100.0, 0.0, 100.0));
+}
+
+int AttackSkill::CritChance(int baseCritChance,
+                            bool isSpell,
+                            int userLevel,
+                            int userDexterity,
+                            int userSorcery,
+                            int targetLevel)
 {
-    double levelDifferenceFactor = (userProfile.Stats.Level - targetProfile.Stats.Level) * 0.5;
-    if (m_Category == Category::Spell)
+    double levelDifferenceFactor = (userLevel - targetLevel) * 0.5;
+    if (isSpell)
     {
-        return lround(
-            std::clamp(m_BaseCritChance + 0.1 * userProfile.Stats.Sorcery + levelDifferenceFactor, 0.0, 100.0));
+        return lround(std::clamp(baseCritChance + 0.1 * userSorcery + levelDifferenceFactor, 0.0, 100.0));
     }
-    return lround(
-        std::clamp(m_BaseCritChance + 0.05 * userProfile.Stats.Dexterity + levelDifferenceFactor, 0.0, 100.0));
+    return lround(std::clamp(baseCritChance + 0.05 * userDexterity + levelDifferenceFactor, 0.0, 100.0));
+}
+
+int AttackSkill::ApplyCrit(int damage, const std::pair<int, int>& damageRange)
+{
+    return std::max(static_cast<int>(damage * 1.4), damageRange.second);
+}
+
+int AttackSkill::ApplyResistance(int damage, int resistance)
+{
+    return static_cast<int>(damage * ((100 - resistance) / 100.0));
 }
 
 } /* namespace Battle */
\ No newline at end of file
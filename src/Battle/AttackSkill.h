@@ -2,6 +2,8 @@
 
 #include "DamageInstance.h"
 #include "DamageType.h"
+#include "OutcomeDistribution.h"
+#include "ProfileBatch.h"
 #include "Skill.h"
 
 namespace Battle
@@ -10,22 +12,6 @@ namespace Battle
 class AttackSkill : public Skill
 {
 public:
-    /**
-     * @brief Attack skill result data
-     */
-    struct AttackSkillResult : public SkillResult
-    {
-        /**
-         * @brief Was a crit (if applicable)
-         */
-        bool IsCrit;
-
-        /**
-         * @brief Damage value (if applicable)
-         */
-        DamageInstance Damage;
-    };
-
     /**
      * @brief Constructor
      *
@@ -38,6 +24,7 @@ public:
      * @param baseHitChance base hit chance
      * @param baseCritChance base crit chance
      * @param baseManaCost base mana cost
+     * @param actionCost action cost, in initiative time units
      */
     AttackSkill(Category category,
                 const std::string& name,
@@ -47,7 +34,8 @@ public:
                 DamageType damageType,
                 int baseHitChance,
                 int baseCritChance,
-                int baseManaCost);
+                int baseManaCost,
+                int actionCost = StandardActionCost);
 
     /**
      * @brief Destructor
@@ -61,22 +49,7 @@ public:
      * @param targetProfile target battle profile to apply effects to
      * @return SkillResult result
      */
-    virtual void ApplySkill(const BattleProfile& userProfile, BattleProfile& targetProfile) override;
-
-    /**
-     * @brief Send data to the battle screen to draw the hover thumbnail
-     *
-     * @param battleScreen battle screen
-     */
-    virtual void OnBattleMenuHover(UI::BattleScreen& battleScreen) override;
-
-    /**
-     * @brief Animate the result of the last skill usage on the battle screen
-     * 
-     * @param battleScreen battle screen
-     * @param isPlayer true if the user is the player
-     */
-    virtual void AnimateTo(UI::BattleScreen& battleScreen, bool isPlayer) const override;
+    virtual SkillResult ApplySkill(const BattleProfile& userProfile, BattleProfile& targetProfile) const override;
 
     /**
      * @brief Calculate the effective damage dealt for a particular instance
@@ -90,6 +63,21 @@ public:
                                          const BattleProfile& userProfile,
                                          const BattleProfile& targetProfile) const = 0;
 
+    /**
+     * @brief Calculate the effective damage for every pair of a batch
+     * The default copies each pair into profiles and calls CalculateEffectiveDamage; skills whose formula only
+     * needs batched stats should override it with a plain loop over the arrays.
+     *
+     * @param baseDamage base damage figure
+     * @param users attack user profiles
+     * @param targets attack target profiles
+     * @param out effective damage per pair
+     */
+    virtual void CalculateEffectiveDamageBatch(int baseDamage,
+                                               const ProfileBatch& users,
+                                               const ProfileBatch& targets,
+                                               int* out) const;
+
     /**
      * @brief Get the effective damage range
      *
@@ -107,7 +95,8 @@ public:
      * @param targetProfile skill target profile
      * @return int effective hit chance
      */
-    int CalculateHitChance(const BattleProfile& userProfile, const BattleProfile& targetProfile) const;
+    virtual int CalculateHitChance(const BattleProfile& userProfile,
+                                   const BattleProfile& targetProfile) const override;
 
     /**
      * @brief Calculate effective crit chance for a particular instance
@@ -118,6 +107,16 @@ public:
      */
     int CalculateCritChance(const BattleProfile& userProfile, const BattleProfile& targetProfile) const;
 
+    /**
+     * @brief Calculate the exact distribution of the damage dealt by using the skill
+     *
+     * @param userProfile skill user profile
+     * @param targetProfile skill target profile
+     * @return OutcomeDistribution outcome distribution
+     */
+    OutcomeDistribution CalculateOutcomeDistribution(const BattleProfile& userProfile,
+                                                     const BattleProfile& targetProfile) const;
+
     /**
      * @brief Get the damage type
      * 
@@ -125,14 +124,80 @@ public:
      */
     inline DamageType GetDamageType() const { return m_DamageType; }
 
+    /**
+     * @brief Get the base damage range
+     *
+     * @return const std::pair<int, int>& base damage range
+     */
+    inline const std::pair<int, int>& GetBaseDamageRange() const { return m_BaseDamageRange; }
+
+    /**
+     * @brief Get the base hit chance
+     *
+     * @return int base hit chance
+     */
+    inline int GetBaseHitChance() const { return m_BaseHitChance; }
+
+    /**
+     * @brief Get the base crit chance
+     *
+     * @return int base crit chance
+     */
+    inline int GetBaseCritChance() const { return m_BaseCritChance; }
+
+    /**
+     * @brief Hit chance formula
+     *
+     * @param baseHitChance base hit chance of the skill
+     * @param userLevel user level
+     * @param userDexterity user dexterity
+     * @param targetLevel target level
+     * @param targetDexterity target dexterity
+     * @return int hit chance in percent
+     */
+    static int HitChance(int baseHitChance, int userLevel, int userDexterity, int targetLevel, int targetDexterity);
+
+    /**
+     * @brief Crit chance formula: spells scale with sorcery, everything else with dexterity
+     *
+     * @param baseCritChance base crit chance of the skill
+     * @param isSpell true if the skill is a spell
+     * @param userLevel user level
+     * @param userDexterity user dexterity
+     * @param userSorcery user sorcery
+     * @param targetLevel target level
+     * @return int crit chance in percent
+     */
+    static int CritChance(int baseCritChance,
+                          bool isSpell,
+                          int userLevel,
+                          int userDexterity,
+                          int userSorcery,
+                          int targetLevel);
+
+    /**
+     * @brief Raise damage for a crit: add 40 %, but at least to the top end of the damage range
+     *
+     * @param damage damage before the crit
+     * @param damageRange effective damage range
+     * @return int crit damage
+     */
+    static int ApplyCrit(int damage, const std::pair<int, int>& damageRange);
+
+    /**
+     * @brief Scale damage by the target's resistance
+     *
+     * @param damage incoming damage
+     * @param resistance resistance in percent
+     * @return int damage taken
+     */
+    static int ApplyResistance(int damage, int resistance);
+
 protected:
     std::pair<int, int> m_BaseDamageRange;
     DamageType m_DamageType;
     int m_BaseHitChance;
     int m_BaseCritChance;
-
-private:
-    std::unique_ptr<AttackSkillResult> m_LastApplyResult;
 };
 
 } /* namespace Battle */
\ No newline at end of file
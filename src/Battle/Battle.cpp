@@ -1,26 +1,86 @@
 #include "Battle.h"
+#include "BattleObserver.h"
+#include "Misc/Exceptions.h"
+#include "Misc/Profiler.h"
 #include "Misc/RNG.h"
+#include "PlayerDecision.h"
 #include "Skill.h"
-#include "SkillCollection.h"
-#include "UI/BattleScreen.h"
-#include <sstream>
+#include <optional>
 
 namespace Battle
 {
 
-Battle::Battle(Entities::Player& player, Entities::Character& enemy)
+Battle::Battle(Entities::Player& player, Entities::Character& enemy) : Battle(player, 0, 1)
+{
+    AddCombatant(enemy, false);
+}
+
+Battle::Battle(Entities::Player& player,
+               const std::vector<Entities::Character*>& enemies,
+               const std::vector<Entities::Character*>& allies)
+    : Battle(player, allies.size(), enemies.size())
+{
+    if (enemies.empty())
+    {
+        throw InvalidArgumentException("Battle::Battle() failed - no enemies");
+    }
+
+    for (auto* ally : allies)
+    {
+        AddCombatant(*ally, true);
+    }
+    for (auto* enemy : enemies)
+    {
+        AddCombatant(*enemy, false);
+    }
+}
+
+Battle::Battle(Entities::Player& player, size_t allyCount, size_t enemyCount)
     : m_Player(player),
-      m_Enemy(enemy),
-      m_BattleScreen(nullptr),
+      m_Observer(nullptr),
+      m_PlayerDecision(nullptr),
+      m_Record(nullptr),
       m_Result(Result::Ongoing),
-      m_PlayerProfile(m_Player.GetStats()),
-      m_EnemyProfile(m_Enemy.GetStats())
+      m_FirstEnemy(1 + allyCount),
+      m_ActiveCombatant(PlayerIndex),
+      m_Sides { { PlayerIndex, 1 + allyCount, 0, {} }, { 1 + allyCount, enemyCount, 0, {} } }
+{
+    m_Combatants.reserve(m_FirstEnemy + enemyCount);
+    m_Scheduler.Reserve(m_FirstEnemy + enemyCount);
+    AddCombatant(player, true);
+}
+
+void Battle::AddCombatant(Entities::Character& character, bool isPlayerSide)
 {
+    const auto& stats = character.GetStats();
+    int initiative    = InitiativeScheduler::Initiative(stats);
+    m_Combatants.push_back({ character,
+                             BattleProfile(stats),
+                             isPlayerSide,
+                             false,
+                             stats.Health,
+                             initiative,
+                             InitiativeScheduler::Delay(Skill::StandardActionCost, initiative) });
+
+    Side& side = m_Sides[isPlayerSide ? 0 : 1];
+    side.Standing++;
+    if (side.Size > 1)
+        side.Targets.emplace(stats.Health, m_Combatants.size() - 1);
 }
 
-void Battle::SetBattleScreen(UI::BattleScreen* battleScreen)
+void Battle::SetObserver(BattleObserver* observer)
 {
-    m_BattleScreen = battleScreen;
+    m_Observer = observer;
+}
+
+void Battle::SetPlayerDecision(PlayerDecision* playerDecision)
+{
+    m_PlayerDecision = playerDecision;
+}
+
+void Battle::SetRecord(BattleRecord* record)
+{
+    m_Record = record;
 }
 
 const Entities::Player& Battle::GetPlayer() const
@@ -30,23 +90,71 @@ const Entities::Player& Battle::GetPlayer() const
 
 const Entities::Character& Battle::GetEnemy() const
 {
-    return m_Enemy;
+    return m_Combatants[m_FirstEnemy].Character;
+}
+
+size_t Battle::SuggestTarget(bool isPlayerSide) const
+{
+    const Side& opponents = m_Sides[isPlayerSide ? 1 : 0];
+    if (opponents.Standing == 0)
+    {
+        throw CustomException("Battle::SuggestTarget() failed - no opponents left");
+    }
+    return opponents.Size == 1 ? opponents.First : opponents.Targets.begin()->second;
 }
 
 Battle::Result Battle::DoBattle()
 {
-    bool playerTurn = true;
+    if (m_PlayerDecision == nullptr)
+    {
+        throw CustomException("Battle::DoBattle() failed - no player decision set");
+    }
+
+    // Random draws are recorded through a tape chained in front of any tape already attached, e.g. by a replayer
+    std::optional<RecordingTape> recordingTape;
+    std::optional<RNG::ScopedTape> scopedTape;
+    if (m_Record)
+    {
+        m_Record->Begin(m_Player, GetEnemy());
+        recordingTape.emplace(*m_Record, RNG::GetTape());
+        scopedTape.emplace(&*recordingTape);
+    }
+
+    // Everyone gets an opening turn, the player's side first; initiative decides the order from then on
+    for (size_t i = 0; i < m_Combatants.size(); i++)
+    {
+        m_Scheduler.Schedule(i, 0);
+    }
+
     while (m_Result == Result::Ongoing)
     {
-        if (playerTurn)
+        size_t index         = m_Scheduler.Next();
+        Combatant& combatant = m_Combatants[index];
+        if (combatant.IsDefeated)
+            continue;
+
+        m_ActiveCombatant = index;
+        Record(BattleRecord::EventType::TurnStart, combatant.IsPlayerSide);
+        const Skill* usedSkill = nullptr;
+        if (index == PlayerIndex)
         {
-            DoPlayerTurn();
+            PROFILE_SCOPE("Battle::DoPlayerTurn");
+            usedSkill = DoPlayerTurn();
         }
         else
         {
-            DoEnemyTurn();
+            PROFILE_SCOPE("Battle::DoCharacterTurn");
+            usedSkill = DoCharacterTurn(index);
+        }
+
+        if (usedSkill)
+        {
+            int cost = usedSkill->GetActionCost();
+            m_Scheduler.Schedule(index,
+                                 cost == Skill::StandardActionCost
+                                     ? combatant.StandardDelay
+                                     : InitiativeScheduler::Delay(cost, combatant.Initiative));
         }
-        playerTurn = !playerTurn;
     }
 
     FinishBattle();
@@ -55,208 +163,175 @@ Battle::Result Battle::DoBattle()
 
 const BattleProfile& Battle::GetPlayerProfile() const
 {
-    return m_PlayerProfile;
+    return m_Combatants[PlayerIndex].Profile;
 }
 
 const BattleProfile& Battle::GetEnemyProfile() const
 {
-    return m_EnemyProfile;
+    return m_Combatants[m_FirstEnemy].Profile;
 }
 
-void Battle::DoPlayerTurn()
+const Skill* Battle::DoPlayerTurn()
 {
-    UpdateActiveEffects(m_PlayerProfile);
-    m_BattleScreen->DisplayPlayerActiveEffects();
-    m_BattleScreen->DisplayEnemyActiveEffects();
+    Combatant& player = m_Combatants[PlayerIndex];
+    RecordEffects(BattleRecord::EventType::EffectExpired, true, player.Profile.UpdateActiveEffects());
+    if (m_Observer)
+        m_Observer->OnEffectsUpdated();
 
-    if (m_PlayerProfile.Stats.Health <= 0)
-    {
-        m_Result = Result::GameOver;
-        return;
-    }
-
-    // Filter available options
-    static std::map<int, std::string> actions
-        = { { 0, "Melee" }, { 1, "Ranged" }, { 2, "Spell" }, { 5, "Special" }, { 20, "Escape" } };
-    std::map<int, Skill*> specialSkills;
-    bool hasMelee          = false;
-    bool hasRanged         = false;
-    bool hasSpell          = false;
-    bool hasSpecial        = false;
-    for (auto& skill : m_Player.GetSkills())
-    {
-        if (skill->GetCategory() == Skill::Category::Melee)
-            hasMelee = true;
-        else if (skill->GetCategory() == Skill::Category::Ranged)
-            hasRanged = true;
-        else if (skill->GetCategory() == Skill::Category::Spell)
-            hasSpell = true;
-        else if (skill->GetCategory() == Skill::Category::Special)
-            hasSpecial = true;
-    }
-    if (!hasMelee)
-        actions.erase(0);
-    if (!hasRanged)
-        actions.erase(1);
-    if (!hasSpell)
-        actions.erase(2);
-    if (!hasSpecial)
-        actions.erase(5);
-
-ACTION_CHOICE:
-    constexpr int RethinkCode = 1000;
-    m_BattleScreen->PostMessage("What will " + m_Player.GetName() + " do?");
-
-    int choice = m_BattleScreen->SelectPlayerAction(actions);
-    Skill::Category selectedSkillCategory = Skill::Category::Passive;
-    switch (choice)
-    {
-    case 0:
-        selectedSkillCategory = Skill::Category::Melee;
-        break;
-    case 1:
-        selectedSkillCategory = Skill::Category::Ranged;
-        break;
-    case 2:
-        selectedSkillCategory = Skill::Category::Spell;
-        break;
-    case 5:
-        selectedSkillCategory = Skill::Category::Special;
-        break;
-    }
+    UpdateCombatant(PlayerIndex);
+    if (player.IsDefeated)
+        return nullptr;
 
-    if (choice == 20)
+    // Draws made by the decision itself are not part of the battle; the chosen skill is recorded instead
+    std::optional<RNG::ScopedTape> noTape;
+    if (RNG::GetTape())
+        noTape.emplace(nullptr);
+    Skill* selectedSkill = m_PlayerDecision->ChooseSkill(*this);
+    if (selectedSkill == nullptr)
     {
         m_Result = Result::Escape;
-        return;
+        return nullptr;
     }
-
-    m_BattleScreen->PostMessage("Which skill?");
-    std::map<int, Skill*> availableSkills;
-    std::map<int, std::string> options { { RethinkCode, "<rethink>" } };
-    int counter = 0;
-    for (auto& skill : m_Player.GetSkills())
+    size_t target = PlayerIndex;
+    if (selectedSkill->GetTargetType() == Skill::Target::Opponent)
     {
-        if (skill->GetCategory() == selectedSkillCategory)
+        target = m_PlayerDecision->ChooseTarget(*this, *selectedSkill);
+        if (target >= m_Combatants.size() || m_Combatants[target].IsPlayerSide || m_Combatants[target].IsDefeated)
         {
-            availableSkills[counter] = skill.get();
-            options[counter]         = skill->GetName();
-            counter++;
+            throw CustomException("Battle::DoPlayerTurn() failed - invalid target " + std::to_string(target));
         }
     }
+    noTape.reset();
+
+    if (m_Observer)
+        m_Observer->OnSkillChosen(*selectedSkill, PlayerIndex);
+    LaunchAttack(*selectedSkill, PlayerIndex, target);
+    return selectedSkill;
+}
+
+const Skill* Battle::DoCharacterTurn(size_t index)
+{
+    Combatant& combatant = m_Combatants[index];
+    RecordEffects(BattleRecord::EventType::EffectExpired,
+                  combatant.IsPlayerSide,
+                  combatant.Profile.UpdateActiveEffects());
+    if (m_Observer)
+        m_Observer->OnEffectsUpdated();
 
-    int skillChoice = m_BattleScreen->SelectWithHoverAction(options, [&](auto it) {
-        m_BattleScreen->ClearProjectionArea();
-        m_BattleScreen->ClearThumbnailArea();
-        if (it->first == RethinkCode)
-            return;
+    UpdateCombatant(index);
+    if (combatant.IsDefeated)
+        return nullptr;
 
-        availableSkills.at(it->first)->OnBattleMenuHover(*m_BattleScreen);
-    });
+    size_t target              = SuggestTarget(combatant.IsPlayerSide);
+    const Skill& selectedSkill = combatant.Character.ChooseBattleSkill(
+        combatant.Profile, m_Combatants[target].Character, m_Combatants[target].Profile);
 
-    if (skillChoice == RethinkCode)
-        goto ACTION_CHOICE;
+    if (m_Observer)
+        m_Observer->OnSkillChosen(selectedSkill, index);
+    LaunchAttack(selectedSkill, index, target);
+    return &selectedSkill;
+}
 
-    auto& selectedSkill = *availableSkills.at(skillChoice);
-    m_BattleScreen->PostMessage(m_Player.GetName() + " uses " + selectedSkill.GetName() + "!");
-    m_BattleScreen->ClearProjectionArea();
-    m_BattleScreen->ClearThumbnailArea();
-    switch (selectedSkill.GetTargetType())
+void Battle::LaunchAttack(const Skill& skill, size_t user, size_t target)
+{
+    Combatant& userCombatant = m_Combatants[user];
+    switch (skill.GetTargetType())
     {
     case Skill::Target::Opponent:
-        LaunchAttack(selectedSkill, true);
         break;
     case Skill::Target::Self:
-        LaunchAttack(selectedSkill, true);
+        target = user;
         break;
-    // TODO: Add option to choose target or target both
     default:
-        break;
+        throw NotSupportedException("Battle::LaunchAttack() failed - unsupported target type of " + skill.GetName());
     }
-}
+    Combatant& targetCombatant = m_Combatants[target];
 
-void Battle::DoEnemyTurn()
-{
-    UpdateActiveEffects(m_EnemyProfile);
-    m_BattleScreen->DisplayPlayerActiveEffects();
-    m_BattleScreen->DisplayEnemyActiveEffects();
-
-    if (m_EnemyProfile.Stats.Health <= 0)
+    unsigned targetEffects = 0;
+    if (m_Record)
     {
-        m_Result = Result::Victory;
-        return;
+        Record(BattleRecord::EventType::SkillUsed, userCombatant.IsPlayerSide, SkillIndex(skill, user));
+        targetEffects = targetCombatant.Profile.ActiveEffectMask();
     }
 
-    m_BattleScreen->PostMessage(m_Enemy.GetName() + " attacks!");
-    std::map<int, Skill*> availableSkills;
-    int counter = 0;
-    for (auto& skill : m_Enemy.GetSkills())
+    SkillResult result = skill.ApplySkill(userCombatant.Profile, targetCombatant.Profile);
+    if (m_Record)
     {
-        availableSkills[counter] = skill.get();
-        counter++;
+        bool isTargetPlayer = targetCombatant.IsPlayerSide;
+        if (auto* attackResult = std::get_if<AttackSkillResult>(&result); attackResult && attackResult->IsHit)
+            Record(BattleRecord::EventType::Damage, isTargetPlayer, attackResult->Damage.GetValue());
+        RecordEffects(BattleRecord::EventType::EffectApplied,
+                      isTargetPlayer,
+                      targetCombatant.Profile.ActiveEffectMask() & ~targetEffects);
     }
 
-    // Pick random skill
-    LaunchAttack(*availableSkills.at(RNG::RandomInt(availableSkills.size())), false);
+    if (m_Observer)
+        m_Observer->OnSkillApplied(skill, result, user, target);
+    UpdateCombatant(target);
 }
 
-void Battle::LaunchAttack(Skill& skill, bool isPlayer)
+void Battle::ReindexCombatant(size_t index)
 {
-    if (isPlayer)
+    Combatant& combatant = m_Combatants[index];
+    int health           = combatant.Profile.Stats.Health;
+    Side& side = m_Sides[combatant.IsPlayerSide ? 0 : 1];
+    if (side.Size > 1)
     {
-        switch (skill.GetTargetType())
+        // Re-key the existing node rather than reallocating it
+        auto node = side.Targets.extract({ combatant.TargetHealth, index });
+        if (health > 0)
         {
-        case Skill::Target::Opponent:
-            skill.ApplySkill(m_PlayerProfile, m_EnemyProfile);
-            break;
-        case Skill::Target::Self:
-            skill.ApplySkill(m_PlayerProfile, m_PlayerProfile);
-            break;
-        default:
-            break;
-        }
-    }
-    else
-    {
-        switch (skill.GetTargetType())
-        {
-        case Skill::Target::Opponent:
-            skill.ApplySkill(m_EnemyProfile, m_PlayerProfile);
-            break;
-        case Skill::Target::Self:
-            skill.ApplySkill(m_EnemyProfile, m_EnemyProfile);
-            break;
-        default:
-            break;
+            node.value().first = health;
+            side.Targets.insert(std::move(node));
         }
     }
+    combatant.TargetHealth = health;
+    if (health > 0)
+        return;
 
-    skill.AnimateTo(*m_BattleScreen, isPlayer);
+    combatant.IsDefeated = true;
+    side.Standing--;
+    if (index == PlayerIndex)
+        m_Result = Result::GameOver;
+    else if (m_Sides[1].Standing == 0)
+        m_Result = Result::Victory;
 }
 
 void Battle::FinishBattle()
 {
-    m_BattleScreen->BattleEndMessage(m_Result);
+    Record(BattleRecord::EventType::Result, true, static_cast<int64_t>(m_Result));
+    if (m_Observer)
+        m_Observer->OnBattleEnd(m_Result);
 
     // Update remaining player HP/MP
-    m_Player.SetHealth(m_PlayerProfile.Stats.Health);
-    m_Player.SetMana(m_PlayerProfile.Stats.Mana);
+    m_Player.SetHealth(GetPlayerProfile().Stats.Health);
+    m_Player.SetMana(GetPlayerProfile().Stats.Mana);
 }
 
-void Battle::UpdateActiveEffects(BattleProfile& profile)
+void Battle::Record(BattleRecord::EventType type, bool isPlayer, int64_t value)
 {
-    for (auto& effect : profile.ActiveEffects)
+    if (m_Record)
+        m_Record->Append(type, isPlayer, value);
+}
+
+void Battle::RecordEffects(BattleRecord::EventType type, bool isPlayer, unsigned mask)
+{
+    for (unsigned index = 0; mask != 0; index++, mask >>= 1)
     {
-        effect->Tick();
-        if (effect->GetRemainingDuration() == 0)
-        {
-            effect->Remove();
-        }
+        if (mask & 1)
+            Record(type, isPlayer, index);
+    }
+}
+
+int Battle::SkillIndex(const Skill& skill, size_t user) const
+{
+    const auto& skills = m_Combatants[user].Character.GetSkills();
+    for (size_t i = 0; i < skills.size(); i++)
+    {
+        if (skills[i].get() == &skill)
+            return static_cast<int>(i);
     }
-    profile.ActiveEffects.erase(std::remove_if(profile.ActiveEffects.begin(),
-                                               profile.ActiveEffects.end(),
-                                               [](auto& effect) { return effect->GetRemainingDuration() == 0; }),
-                                profile.ActiveEffects.end());
+    return -1;
 }
 
 } /* namespace Battle */
\ No newline at end of file
@@ -1,14 +1,26 @@
 #pragma once
 
+#include "BattleRecord.h"
+#include "InitiativeScheduler.h"
 #include "Skill.h"
 #include "Entities/Character.h"
 #include "Entities/Player.h"
-
-namespace UI { class BattleScreen; }
+#include <set>
+#include <utility>
+#include <vector>
 
 namespace Battle
 {
 
+class BattleObserver;
+class PlayerDecision;
+
+/**
+ * @brief Rules engine conducting a battle between the player's side and one or more enemies
+ * Player choices come from a PlayerDecision and progress is reported to an optional BattleObserver,
+ * so a battle can run with or without any UI. Turn order comes from an InitiativeScheduler; everyone else
+ * picks their skill through their battle behavior against the weakest opponent still standing.
+ */
 class Battle
 {
 public:
@@ -23,6 +35,45 @@ public:
         Escape = 2
     };
 
+    /**
+     * @brief Participant of a battle
+     */
+    struct Combatant
+    {
+        Entities::Character& Character;
+        BattleProfile Profile;
+
+        /**
+         * @brief True if on the player's side
+         */
+        bool IsPlayerSide;
+
+        /**
+         * @brief True once the combatant has been taken out of the battle
+         */
+        bool IsDefeated;
+
+        /**
+         * @brief Health the combatant is indexed under among the targets of its side
+         */
+        int TargetHealth;
+
+        /**
+         * @brief Initiative, from the Dexterity at the start of the battle
+         */
+        int Initiative;
+
+        /**
+         * @brief Delay after an action of standard cost
+         */
+        int64_t StandardDelay;
+    };
+
+    /**
+     * @brief Index of the player among the combatants
+     */
+    constexpr static const size_t PlayerIndex = 0;
+
     /**
      * @brief Constructor
      *
@@ -32,11 +83,37 @@ public:
     Battle(Entities::Player& player, Entities::Character& enemy);
 
     /**
-     * @brief Set the battle screen
+     * @brief Constructor
+     *
+     * @param player player
+     * @param enemies enemy characters, at least one
+     * @param allies characters fighting alongside the player (default: none)
+     * @throw InvalidArgumentException if there are no enemies
+     */
+    Battle(Entities::Player& player,
+           const std::vector<Entities::Character*>& enemies,
+           const std::vector<Entities::Character*>& allies = {});
+
+    /**
+     * @brief Set the observer notified about the battle's progress
+     * 
+     * @param observer observer (null for none)
+     */
+    void SetObserver(BattleObserver* observer);
+
+    /**
+     * @brief Set the source of the player's choices, required before the battle is conducted
      * 
-     * @param battleScreen battle screen
+     * @param playerDecision player decision
      */
-    void SetBattleScreen(UI::BattleScreen* battleScreen);
+    void SetPlayerDecision(PlayerDecision* playerDecision);
+
+    /**
+     * @brief Set the record the battle's events are appended to
+     * 
+     * @param record record (null for none)
+     */
+    void SetRecord(BattleRecord* record);
 
     /**
      * @brief Get the Player
@@ -46,12 +123,43 @@ public:
     const Entities::Player& GetPlayer() const;
 
     /**
-     * @brief Get the Enemy
+     * @brief Get the Enemy, the first one if there are several
      * 
      * @return const Entities::Character& enemy
      */
     const Entities::Character& GetEnemy() const;
 
+    /**
+     * @brief Get the number of combatants, the player included
+     * 
+     * @return size_t combatant count
+     */
+    inline size_t GetCombatantCount() const { return m_Combatants.size(); }
+
+    /**
+     * @brief Get a combatant
+     * The player comes first, followed by the allies and then the enemies, in the order given to the constructor.
+     * 
+     * @param index combatant index
+     * @return const Combatant& combatant
+     */
+    inline const Combatant& GetCombatant(size_t index) const { return m_Combatants[index]; }
+
+    /**
+     * @brief Get the combatant whose turn it is
+     * 
+     * @return size_t combatant index
+     */
+    inline size_t GetActiveCombatant() const { return m_ActiveCombatant; }
+
+    /**
+     * @brief Get the weakest opponent still standing of a side
+     * 
+     * @param isPlayerSide true to look for a target of the player's side
+     * @return size_t combatant index
+     */
+    size_t SuggestTarget(bool isPlayerSide) const;
+
     /**
      * @brief Conduct the battle
      */
@@ -64,8 +172,8 @@ public:
      */
     const BattleProfile& GetPlayerProfile() const;
 
-        /**
-     * @brief Get the current state of the enemy profile
+    /**
+     * @brief Get the current state of the enemy profile, the first one's if there are several
      * 
      * @return const BattleProfile& enemy profile
      */
@@ -73,39 +181,128 @@ public:
 
 private:
     Entities::Player& m_Player;
-    Entities::Character& m_Enemy;
-    UI::BattleScreen* m_BattleScreen;
+    BattleObserver* m_Observer;
+    PlayerDecision* m_PlayerDecision;
+    BattleRecord* m_Record;
     Result m_Result;
-    BattleProfile m_PlayerProfile;
-    BattleProfile m_EnemyProfile;
+    std::vector<Combatant> m_Combatants;
+    size_t m_FirstEnemy;
+    size_t m_ActiveCombatant;
+    InitiativeScheduler m_Scheduler;
+
+    /**
+     * @brief Combatants of one side
+     */
+    struct Side
+    {
+        size_t First;
+        size_t Size;
+        size_t Standing;
+
+        /**
+         * @brief Combatants still standing, ordered by health and index; only kept for sides of several
+         */
+        std::set<std::pair<int, size_t>> Targets;
+    };
+
+    /**
+     * @brief The player's side and the enemy side
+     */
+    Side m_Sides[2];
+
+    /**
+     * @brief Constructor adding the player
+     *
+     * @param player player
+     * @param allyCount number of allies
+     * @param enemyCount number of enemies
+     */
+    Battle(Entities::Player& player, size_t allyCount, size_t enemyCount);
 
     /**
      * @brief Perform the player's turn
+     * 
+     * @return const Skill* skill used, null if the player did not act
      */
-    void DoPlayerTurn();
+    const Skill* DoPlayerTurn();
 
     /**
-     * @brief Perform the enemy's turn
+     * @brief Perform the turn of any other combatant
+     * 
+     * @param index combatant index
+     * @return const Skill* skill used
      */
-    void DoEnemyTurn();
+    const Skill* DoCharacterTurn(size_t index);
 
     /**
      * @brief Launch an attack
      * 
      * @param skill skill used
-     * @param isPlayer true if the attacker is the player
+     * @param user user combatant index
+     * @param target opposing combatant aimed at, used by skills targeting the opponent
      */
-    void LaunchAttack(Skill& skill, bool isPlayer);
+    void LaunchAttack(const Skill& skill, size_t user, size_t target);
 
     /**
-     * @brief Wrap up
+     * @brief Add a combatant
+     * 
+     * @param character character
+     * @param isPlayerSide true if on the player's side
      */
-    void FinishBattle();
+    void AddCombatant(Entities::Character& character, bool isPlayerSide);
 
     /**
-     * @brief Perform effect ticks and remove expired effects
+     * @brief Update the target index after a combatant's health may have changed, and take it out of the
+     * battle if it has fallen
+     * 
+     * @param index combatant index
+     */
+    inline void UpdateCombatant(size_t index)
+    {
+        const Combatant& combatant = m_Combatants[index];
+        int health                 = combatant.Profile.Stats.Health;
+        if (!combatant.IsDefeated && (health != combatant.TargetHealth || health <= 0))
+            ReindexCombatant(index);
+    }
+
+    /**
+     * @brief Move a combatant whose health has changed within the target index
+     * 
+     * @param index combatant index
      */
-    void UpdateActiveEffects(BattleProfile& profile);
+    void ReindexCombatant(size_t index);
+
+    /**
+     * @brief Append an event to the record, if any
+     * 
+     * @param type event type
+     * @param isPlayer true if the event concerns the player's side
+     * @param value event value
+     */
+    void Record(BattleRecord::EventType type, bool isPlayer, int64_t value = 0);
+
+    /**
+     * @brief Append an event for every effect type in a bit mask to the record, if any
+     * 
+     * @param type event type
+     * @param isPlayer true if the event concerns the player's side
+     * @param mask bit mask of ActiveEffect indices
+     */
+    void RecordEffects(BattleRecord::EventType type, bool isPlayer, unsigned mask);
+
+    /**
+     * @brief Find the index of a skill among its user's skills
+     * 
+     * @param skill skill
+     * @param user user combatant index
+     * @return int index, -1 if the skill does not belong to the user
+     */
+    int SkillIndex(const Skill& skill, size_t user) const;
+
+    /**
+     * @brief Wrap up
+     */
+    void FinishBattle();
 };
 
 } /* namespace Battle */
\ No newline at end of file
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "Battle.h"
+#include "Skill.h"
+
+namespace Battle
+{
+
+/**
+ * @brief Receives notifications about the progress of a battle, e.g. to present it
+ * All notifications do nothing by default.
+ */
+class BattleObserver
+{
+public:
+    /**
+     * @brief Destructor
+     */
+    virtual ~BattleObserver() = default;
+
+    /**
+     * @brief Called after the active effects of a combatant have been updated at the start of its turn
+     * The combatant is Battle::GetActiveCombatant().
+     */
+    virtual void OnEffectsUpdated() {}
+
+    /**
+     * @brief Called when a combatant has decided which skill to use, before it is applied
+     *
+     * @param skill chosen skill
+     * @param user combatant index of the user
+     */
+    virtual void OnSkillChosen(const Skill& skill, size_t user) {}
+
+    /**
+     * @brief Called after a skill has been applied
+     *
+     * @param skill applied skill
+     * @param result result of the skill usage
+     * @param user combatant index of the user
+     * @param target combatant index of the target, the user itself for skills targeting the user
+     */
+    virtual void OnSkillApplied(const Skill& skill, const SkillResult& result, size_t user, size_t target) {}
+
+    /**
+     * @brief Called once the battle is over
+     *
+     * @param result battle result
+     */
+    virtual void OnBattleEnd(Battle::Result result) {}
+};
+
+} /* namespace Battle */
@@ -7,4 +7,38 @@ BattleProfile::BattleProfile(const Entities::Stats& stats) : Stats(stats), Resis
 {
 }
 
-} /* namespace Battle */
\ No newline at end of file
+unsigned BattleProfile::UpdateActiveEffects()
+{
+    unsigned expired = 0;
+    for (auto& activeEffect : ActiveEffects)
+    {
+        std::visit(
+            [this](auto& effect) {
+                effect.TickAction(*this);
+                effect.Tick();
+                if (effect.GetRemainingDuration() == 0)
+                {
+                    effect.Remove(*this);
+                }
+            },
+            activeEffect);
+        if (AsEffect(activeEffect).GetRemainingDuration() == 0)
+            expired |= 1u << activeEffect.index();
+    }
+    ActiveEffects.RemoveIf([](const ActiveEffect& activeEffect) {
+        return AsEffect(activeEffect).GetRemainingDuration() == 0;
+    });
+    return expired;
+}
+
+unsigned BattleProfile::ActiveEffectMask() const
+{
+    unsigned mask = 0;
+    for (const auto& activeEffect : ActiveEffects)
+    {
+        mask |= 1u << activeEffect.index();
+    }
+    return mask;
+}
+
+} /* namespace Battle */
@@ -1,10 +1,10 @@
 #pragma once
 
+#include "EffectCollection.h"
 #include "Entities/Stats.h"
-#include "Effect.h"
+#include "Misc/InlineVector.h"
 #include <array>
-#include <memory>
-#include <vector>
+#include <type_traits>
 
 namespace Battle
 {
@@ -15,11 +15,18 @@ namespace Battle
 class BattleProfile
 {
 public:
+    /**
+     * @brief Maximum number of simultaneously active effects
+     * An effect type can only be active once, reapplying it refreshes the duration instead.
+     */
+    constexpr static const size_t MaxActiveEffects = 8;
+    static_assert(MaxActiveEffects >= std::variant_size_v<ActiveEffect>);
+
     Entities::Stats Stats;
 
     std::array<int, 5> Resistances;
 
-    std::vector<std::unique_ptr<Effect>> ActiveEffects;
+    InlineVector<ActiveEffect, MaxActiveEffects> ActiveEffects;
 
     /**
      * @brief Constructor
@@ -28,7 +35,42 @@ public:
      */
     BattleProfile(const Entities::Stats& stats);
 
-private:
+    /**
+     * @brief Apply an effect, or refresh its duration if an effect of the same type is already active
+     *
+     * @tparam EffectType effect type
+     * @param effect effect
+     */
+    template <typename EffectType>
+    void ApplyEffect(const EffectType& effect)
+    {
+        for (auto& activeEffect : ActiveEffects)
+        {
+            if (auto* sameEffect = std::get_if<EffectType>(&activeEffect))
+            {
+                sameEffect->Refresh();
+                return;
+            }
+        }
+        std::get<EffectType>(ActiveEffects.EmplaceBack(effect)).Apply(*this);
+    }
+
+    /**
+     * @brief Perform effect ticks and remove expired effects
+     *
+     * @return unsigned bit mask of the ActiveEffect indices of the expired effects
+     */
+    unsigned UpdateActiveEffects();
+
+    /**
+     * @brief Get the effect types currently active
+     *
+     * @return unsigned bit mask of the ActiveEffect indices of the active effects
+     */
+    unsigned ActiveEffectMask() const;
 };
 
-} /* namespace Battle */
\ No newline at end of file
+// Vectors of profiles and moved profiles rely on the effects being moved rather than copied
+static_assert(std::is_nothrow_move_constructible_v<BattleProfile>);
+
+} /* namespace Battle */
@@ -0,0 +1,308 @@
+#include "BattleRecord.h"
+#include "Misc/Varint.h"
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+namespace Battle
+{
+
+const std::string BattleRecord::LastBattleFilename = "data/last-battle.bin";
+
+/**
+ * @brief Leading bytes of a serialized record
+ */
+static const std::array<uint8_t, 4> Magic { 'D', 'G', 'B', 'R' };
+
+/**
+ * @brief Format version of a serialized record
+ */
+constexpr static const int FormatVersion = 2;
+
+/**
+ * @brief Encode stats
+ *
+ * @param out output buffer
+ * @param stats stats
+ */
+static void WriteStats(std::vector<uint8_t>& out, const Entities::Stats& stats)
+{
+    for (int value : { stats.Level,
+                       stats.Health,
+                       stats.MaxHealth,
+                       stats.Mana,
+                       stats.MaxMana,
+                       stats.Strength,
+                       stats.Dexterity,
+                       stats.Sorcery,
+                       stats.Wisdom })
+    {
+        Varint::WriteSigned(out, value);
+    }
+}
+
+/**
+ * @brief Decode stats
+ *
+ * @param reader reader
+ * @return Entities::Stats stats
+ */
+static Entities::Stats ReadStats(Varint::Reader& reader)
+{
+    Entities::Stats stats;
+    for (int* value : { &stats.Level,
+                        &stats.Health,
+                        &stats.MaxHealth,
+                        &stats.Mana,
+                        &stats.MaxMana,
+                        &stats.Strength,
+                        &stats.Dexterity,
+                        &stats.Sorcery,
+                        &stats.Wisdom })
+    {
+        *value = static_cast<int>(reader.ReadSigned());
+    }
+    return stats;
+}
+
+/**
+ * @brief Encode a string
+ *
+ * @param out output buffer
+ * @param value string
+ */
+static void WriteString(std::vector<uint8_t>& out, const std::string& value)
+{
+    Varint::Write(out, value.size());
+    out.insert(out.end(), value.begin(), value.end());
+}
+
+/**
+ * @brief Decode a string
+ *
+ * @param reader reader
+ * @return std::string string
+ */
+static std::string ReadString(Varint::Reader& reader)
+{
+    std::string value;
+    uint64_t length = reader.Read();
+    for (uint64_t i = 0; i < length; i++)
+    {
+        value.push_back(static_cast<char>(reader.ReadByte()));
+    }
+    return value;
+}
+
+/**
+ * @brief Encode a participant
+ *
+ * @param out output buffer
+ * @param participant participant
+ */
+static void WriteParticipant(std::vector<uint8_t>& out, const BattleRecord::Participant& participant)
+{
+    WriteString(out, participant.Name);
+    WriteStats(out, participant.Stats);
+    Varint::Write(out, participant.Skills.size());
+    for (const auto& skill : participant.Skills)
+    {
+        WriteString(out, skill);
+    }
+}
+
+/**
+ * @brief Decode a participant
+ *
+ * @param reader reader
+ * @return BattleRecord::Participant participant
+ */
+static BattleRecord::Participant ReadParticipant(Varint::Reader& reader)
+{
+    BattleRecord::Participant participant;
+    participant.Name    = ReadString(reader);
+    participant.Stats   = ReadStats(reader);
+    uint64_t skillCount = reader.Read();
+    for (uint64_t i = 0; i < skillCount; i++)
+    {
+        participant.Skills.push_back(ReadString(reader));
+    }
+    return participant;
+}
+
+/**
+ * @brief Describe a character at the start of a battle
+ *
+ * @param character character
+ * @return BattleRecord::Participant participant
+ */
+static BattleRecord::Participant MakeParticipant(const Entities::Character& character)
+{
+    BattleRecord::Participant participant { character.GetName(), character.GetStats(), {} };
+    for (const auto& skill : character.GetSkills())
+    {
+        participant.Skills.push_back(skill->GetName());
+    }
+    return participant;
+}
+
+BattleRecord::BattleRecord() : m_Player {}, m_Enemy {}
+{
+}
+
+void BattleRecord::Begin(const Entities::Character& player, const Entities::Character& enemy)
+{
+    m_Player = MakeParticipant(player);
+    m_Enemy  = MakeParticipant(enemy);
+    m_EventBytes.clear();
+}
+
+void BattleRecord::Append(EventType type, bool isPlayer, int64_t value)
+{
+    // Tag byte: event type and side
+    m_EventBytes.push_back(static_cast<uint8_t>(static_cast<uint8_t>(type) << 1 | isPlayer));
+    if (type != EventType::TurnStart)
+    {
+        Varint::WriteSigned(m_EventBytes, value);
+    }
+}
+
+void BattleRecord::AppendReal(double value)
+{
+    m_EventBytes.push_back(static_cast<uint8_t>(static_cast<uint8_t>(EventType::RandomReal) << 1));
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    for (int i = 0; i < 8; i++)
+    {
+        m_EventBytes.push_back(static_cast<uint8_t>(bits >> (8 * i)));
+    }
+}
+
+std::vector<BattleRecord::Event> BattleRecord::Events() const
+{
+    std::vector<Event> events;
+    Varint::Reader reader(m_EventBytes.data(), m_EventBytes.size());
+    while (!reader.AtEnd())
+    {
+        uint8_t tag = reader.ReadByte();
+        Event event { static_cast<EventType>(tag >> 1), (tag & 1) != 0, 0, 0 };
+        switch (event.Type)
+        {
+        case EventType::TurnStart:
+            break;
+        case EventType::RandomReal:
+        {
+            uint64_t bits = 0;
+            for (int i = 0; i < 8; i++)
+            {
+                bits |= static_cast<uint64_t>(reader.ReadByte()) << (8 * i);
+            }
+            std::memcpy(&event.RealValue, &bits, sizeof(bits));
+            break;
+        }
+        case EventType::SkillUsed:
+        case EventType::RandomInt:
+        case EventType::Damage:
+        case EventType::EffectApplied:
+        case EventType::EffectExpired:
+        case EventType::Result:
+            event.Value = reader.ReadSigned();
+            break;
+        default:
+            throw InvalidArgumentException("BattleRecord::Events() failed - unknown event type "
+                                           + std::to_string(tag >> 1));
+        }
+        events.push_back(event);
+    }
+    return events;
+}
+
+std::vector<uint8_t> BattleRecord::Serialize() const
+{
+    std::vector<uint8_t> data(Magic.begin(), Magic.end());
+    Varint::Write(data, FormatVersion);
+    WriteParticipant(data, m_Player);
+    WriteParticipant(data, m_Enemy);
+    Varint::Write(data, m_EventBytes.size());
+    data.insert(data.end(), m_EventBytes.begin(), m_EventBytes.end());
+    return data;
+}
+
+std::optional<BattleRecord> BattleRecord::Deserialize(const std::vector<uint8_t>& data)
+{
+    if (data.size() < Magic.size() || !std::equal(Magic.begin(), Magic.end(), data.begin()))
+    {
+        return std::nullopt;
+    }
+
+    try
+    {
+        Varint::Reader reader(data.data() + Magic.size(), data.size() - Magic.size());
+        if (reader.Read() != FormatVersion)
+        {
+            return std::nullopt;
+        }
+
+        BattleRecord record;
+        record.m_Player     = ReadParticipant(reader);
+        record.m_Enemy      = ReadParticipant(reader);
+        uint64_t eventCount = reader.Read();
+        for (uint64_t i = 0; i < eventCount; i++)
+        {
+            record.m_EventBytes.push_back(reader.ReadByte());
+        }
+        record.Events(); // Validate
+        return record;
+    }
+    catch (InvalidArgumentException&)
+    {
+        return std::nullopt;
+    }
+}
+
+bool BattleRecord::SaveToFile(const std::string& filename) const
+{
+    std::ofstream file(filename, std::ios::binary);
+    if (!file.good())
+    {
+        return false;
+    }
+    auto data = Serialize();
+    file.write(reinterpret_cast<const char*>(data.data()), data.size());
+    return file.good();
+}
+
+std::optional<BattleRecord> BattleRecord::LoadFromFile(const std::string& filename)
+{
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.good())
+    {
+        return std::nullopt;
+    }
+    std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    return Deserialize(data);
+}
+
+RecordingTape::RecordingTape(BattleRecord& record, RNG::Tape* next) : m_Record(record), m_Next(next)
+{
+}
+
+int RecordingTape::TapeInt(int value, int low, int high)
+{
+    if (m_Next)
+        value = m_Next->TapeInt(value, low, high);
+    m_Record.Append(BattleRecord::EventType::RandomInt, false, value - low);
+    return value;
+}
+
+double RecordingTape::TapeDouble(double value)
+{
+    if (m_Next)
+        value = m_Next->TapeDouble(value);
+    m_Record.AppendReal(value);
+    return value;
+}
+
+} /* namespace Battle */
@@ -0,0 +1,195 @@
+#pragma once
+
+#include "Entities/Character.h"
+#include "Entities/Stats.h"
+#include "Misc/RNG.h"
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace Battle
+{
+
+/**
+ * @brief Compact binary event stream of a single battle
+ * Holds the name, skills and starting stats of both combatants followed by varint-encoded events, including every
+ * random draw, which is enough to rebuild the combatants and for BattleReplayer to reproduce the battle exactly.
+ */
+class BattleRecord
+{
+public:
+    /**
+     * @brief File the record of the last battle played is saved to
+     */
+    static const std::string LastBattleFilename;
+
+    /**
+     * @brief Battle event type
+     */
+    enum class EventType : uint8_t
+    {
+        TurnStart,     // no value
+        SkillUsed,     // index of the skill among the user's skills
+        RandomInt,     // drawn value minus the lower bound
+        RandomReal,    // drawn value, stored as raw 8 bytes
+        Damage,        // damage dealt to the side
+        EffectApplied, // index of the effect type in ActiveEffect
+        EffectExpired, // index of the effect type in ActiveEffect
+        Result         // Battle::Result
+    };
+
+    /**
+     * @brief Combatant at the start of the battle
+     */
+    struct Participant
+    {
+        /**
+         * @brief Name, which identifies the type of an enemy
+         */
+        std::string Name;
+
+        Entities::Stats Stats;
+
+        /**
+         * @brief Names of the skills, in the order they were granted
+         */
+        std::vector<std::string> Skills;
+    };
+
+    /**
+     * @brief Decoded battle event
+     */
+    struct Event
+    {
+        EventType Type;
+
+        /**
+         * @brief True if the event concerns the player's side
+         */
+        bool IsPlayer;
+
+        /**
+         * @brief Event value, see EventType
+         */
+        int64_t Value;
+
+        /**
+         * @brief Drawn value of a RandomReal event
+         */
+        double RealValue;
+    };
+
+    /**
+     * @brief Constructor
+     */
+    BattleRecord();
+
+    /**
+     * @brief Discard all events and start a new record
+     *
+     * @param player player at the start of the battle
+     * @param enemy enemy at the start of the battle
+     */
+    void Begin(const Entities::Character& player, const Entities::Character& enemy);
+
+    /**
+     * @brief Append an event
+     *
+     * @param type event type, other than RandomReal
+     * @param isPlayer true if the event concerns the player's side
+     * @param value event value (ignored for TurnStart)
+     */
+    void Append(EventType type, bool isPlayer, int64_t value = 0);
+
+    /**
+     * @brief Append a RandomReal event
+     *
+     * @param value drawn value
+     */
+    void AppendReal(double value);
+
+    /**
+     * @brief Decode all events
+     *
+     * @return std::vector<Event> events
+     * @throw InvalidArgumentException if the stream is malformed
+     */
+    std::vector<Event> Events() const;
+
+    /**
+     * @brief Get the player at the start of the battle
+     */
+    inline const Participant& GetPlayer() const { return m_Player; }
+
+    /**
+     * @brief Get the enemy at the start of the battle
+     */
+    inline const Participant& GetEnemy() const { return m_Enemy; }
+
+    /**
+     * @brief Get the encoded events
+     */
+    inline const std::vector<uint8_t>& GetEventBytes() const { return m_EventBytes; }
+
+    /**
+     * @brief Encode the whole record, header included
+     *
+     * @return std::vector<uint8_t> encoded record
+     */
+    std::vector<uint8_t> Serialize() const;
+
+    /**
+     * @brief Decode a whole record
+     *
+     * @param data encoded record
+     * @return std::optional<BattleRecord> record, empty if the data is not a valid record
+     */
+    static std::optional<BattleRecord> Deserialize(const std::vector<uint8_t>& data);
+
+    /**
+     * @brief Write the record to a file
+     *
+     * @param filename file name
+     * @return true on success
+     */
+    bool SaveToFile(const std::string& filename) const;
+
+    /**
+     * @brief Read a record from a file
+     *
+     * @param filename file name
+     * @return std::optional<BattleRecord> record, empty if the file is missing or not a valid record
+     */
+    static std::optional<BattleRecord> LoadFromFile(const std::string& filename);
+
+private:
+    Participant m_Player;
+    Participant m_Enemy;
+    std::vector<uint8_t> m_EventBytes;
+};
+
+/**
+ * @brief Tape appending every random draw to a record, after passing it on to the previously attached tape
+ */
+class RecordingTape : public RNG::Tape
+{
+public:
+    /**
+     * @brief Constructor
+     *
+     * @param record record to append to
+     * @param next tape to consult first, e.g. a replayer (null for none)
+     */
+    RecordingTape(BattleRecord& record, RNG::Tape* next);
+
+    virtual int TapeInt(int value, int low, int high) override;
+
+    virtual double TapeDouble(double value) override;
+
+private:
+    BattleRecord& m_Record;
+    RNG::Tape* m_Next;
+};
+
+} /* namespace Battle */
@@ -0,0 +1,132 @@
+#include "BattleReplayer.h"
+#include "Battle.h"
+#include "Misc/Exceptions.h"
+#include <tuple>
+
+namespace Battle
+{
+
+/**
+ * @brief Compare two sets of stats
+ *
+ * @param a stats
+ * @param b stats
+ * @return true if equal
+ */
+static bool StatsEqual(const Entities::Stats& a, const Entities::Stats& b)
+{
+    return std::tie(a.Level, a.Health, a.MaxHealth, a.Mana, a.MaxMana, a.Strength, a.Dexterity, a.Sorcery, a.Wisdom)
+           == std::tie(b.Level, b.Health, b.MaxHealth, b.Mana, b.MaxMana, b.Strength, b.Dexterity, b.Sorcery, b.Wisdom);
+}
+
+/**
+ * @brief Check whether a character is the one described by a record
+ *
+ * @param character character
+ * @param participant participant stored in the record
+ * @return true if name, skills and stats are the same
+ */
+static bool Matches(const Entities::Character& character, const BattleRecord::Participant& participant)
+{
+    const auto& skills = character.GetSkills();
+    if (character.GetName() != participant.Name || skills.size() != participant.Skills.size()
+        || !StatsEqual(character.GetStats(), participant.Stats))
+    {
+        return false;
+    }
+    for (size_t i = 0; i < skills.size(); i++)
+    {
+        if (skills[i]->GetName() != participant.Skills[i])
+            return false;
+    }
+    return true;
+}
+
+BattleReplayer::BattleReplayer(const BattleRecord& record)
+    : m_Record(record),
+      m_Events(record.Events()),
+      m_SkillCursor(0),
+      m_IntCursor(0),
+      m_RealCursor(0),
+      m_HasDiverged(false)
+{
+}
+
+Battle::Result BattleReplayer::Replay(Entities::Player& player,
+                                      Entities::Character& enemy,
+                                      BattleObserver* observer,
+                                      BattleRecord* newRecord)
+{
+    Battle battle(player, enemy);
+    battle.SetObserver(observer);
+    return Replay(battle, newRecord);
+}
+
+Battle::Result BattleReplayer::Replay(Battle& battle, BattleRecord* newRecord)
+{
+    if (battle.GetCombatantCount() != 2 || !Matches(battle.GetPlayer(), m_Record.GetPlayer())
+        || !Matches(battle.GetEnemy(), m_Record.GetEnemy()))
+    {
+        throw InvalidArgumentException("BattleReplayer::Replay() failed - combatants differ from the record");
+    }
+
+    battle.SetPlayerDecision(this);
+    battle.SetRecord(newRecord);
+
+    RNG::ScopedTape scopedTape(this);
+    return battle.DoBattle();
+}
+
+Skill* BattleReplayer::ChooseSkill(const Battle& battle)
+{
+    const auto& skills = battle.GetPlayer().GetSkills();
+    for (; m_SkillCursor < m_Events.size(); m_SkillCursor++)
+    {
+        const auto& event = m_Events[m_SkillCursor];
+        if (event.Type == BattleRecord::EventType::Result)
+            return nullptr;
+        if (event.Type != BattleRecord::EventType::SkillUsed || !event.IsPlayer)
+            continue;
+
+        m_SkillCursor++;
+        if (event.Value < 0 || event.Value >= static_cast<int64_t>(skills.size()))
+            break;
+        return skills[event.Value].get();
+    }
+    m_HasDiverged = true;
+    return nullptr;
+}
+
+int BattleReplayer::TapeInt(int value, int low, int high)
+{
+    const auto* event = Next(m_IntCursor, BattleRecord::EventType::RandomInt);
+    if (event == nullptr || event->Value < 0 || event->Value >= static_cast<int64_t>(high) - low)
+    {
+        m_HasDiverged = true;
+        return value;
+    }
+    return low + static_cast<int>(event->Value);
+}
+
+double BattleReplayer::TapeDouble(double value)
+{
+    const auto* event = Next(m_RealCursor, BattleRecord::EventType::RandomReal);
+    if (event == nullptr)
+    {
+        m_HasDiverged = true;
+        return value;
+    }
+    return event->RealValue;
+}
+
+const BattleRecord::Event* BattleReplayer::Next(size_t& cursor, BattleRecord::EventType type)
+{
+    for (; cursor < m_Events.size(); cursor++)
+    {
+        if (m_Events[cursor].Type == type)
+            return &m_Events[cursor++];
+    }
+    return nullptr;
+}
+
+} /* namespace Battle */
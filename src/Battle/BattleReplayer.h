@@ -0,0 +1,93 @@
+#pragma once
+
+#include "BattleRecord.h"
+#include "PlayerDecision.h"
+#include "Entities/Character.h"
+#include "Entities/Player.h"
+#include "Misc/RNG.h"
+
+namespace Battle
+{
+
+class BattleObserver;
+
+/**
+ * @brief Reproduces a recorded battle by feeding back the player's choices and the random draws of the record
+ * Replaying against changed battle rules works as well; the replay then diverges from the record at some point,
+ * after which fresh random draws are used.
+ */
+class BattleReplayer : public PlayerDecision, public RNG::Tape
+{
+public:
+    /**
+     * @brief Constructor
+     *
+     * @param record record to replay, must outlive the replayer
+     */
+    explicit BattleReplayer(const BattleRecord& record);
+
+    /**
+     * @brief Replay the battle at full speed, or presented by an observer
+     * The combatants must have the names, skills and stats stored in the record.
+     *
+     * @param player player
+     * @param enemy enemy
+     * @param observer observer (null for none)
+     * @param newRecord record to write the replayed battle to, e.g. to compare it with the original (null for none)
+     * @return Battle::Result battle result
+     * @throw InvalidArgumentException if the combatants differ from the record
+     */
+    Battle::Result Replay(Entities::Player& player,
+                          Entities::Character& enemy,
+                          BattleObserver* observer = nullptr,
+                          BattleRecord* newRecord  = nullptr);
+
+    /**
+     * @brief Replay the battle on a battle which has not been conducted yet, e.g. one shown by the battle screen
+     * The replayer takes over the player's decisions; an observer already set on the battle is kept.
+     *
+     * @param battle 1v1 battle between combatants with the names, skills and stats stored in the record
+     * @param newRecord record to write the replayed battle to (null for none)
+     * @return Battle::Result battle result
+     * @throw InvalidArgumentException if the combatants differ from the record
+     */
+    Battle::Result Replay(Battle& battle, BattleRecord* newRecord = nullptr);
+
+    /**
+     * @brief Check whether the replay requested anything the record could not supply
+     *
+     * @return true if diverged
+     */
+    inline bool HasDiverged() const { return m_HasDiverged; }
+
+    /**
+     * @brief Choose the next skill the player used in the record
+     *
+     * @param battle battle in progress
+     * @return Skill* recorded skill, null if the player escaped or the record is exhausted
+     */
+    virtual Skill* ChooseSkill(const Battle& battle) override;
+
+    virtual int TapeInt(int value, int low, int high) override;
+
+    virtual double TapeDouble(double value) override;
+
+private:
+    const BattleRecord& m_Record;
+    std::vector<BattleRecord::Event> m_Events;
+    size_t m_SkillCursor;
+    size_t m_IntCursor;
+    size_t m_RealCursor;
+    bool m_HasDiverged;
+
+    /**
+     * @brief Advance a cursor to the next event of the given type
+     *
+     * @param cursor cursor
+     * @param type event type
+     * @return const BattleRecord::Event* event, null if there is none
+     */
+    const BattleRecord::Event* Next(size_t& cursor, BattleRecord::EventType type);
+};
+
+} /* namespace Battle */
@@ -1,27 +1,23 @@
 #include "Effect.h"
-#include "BattleProfile.h"
 
 namespace Battle
 {
 
-Effect::Effect(const std::string& name, const BattleProfile& user, BattleProfile& target, int duration)
-    : OriginalDuration(duration),
-      m_Name(name),
-      m_User(user),
-      m_Target(target),
+Effect::Effect(const char* name, int duration)
+    : m_Name(name),
+      m_OriginalDuration(duration),
       m_RemainingDuration(duration)
 {
 }
 
 void Effect::Tick()
 {
-    TickAction();
     m_RemainingDuration--;
 }
 
 void Effect::Refresh()
 {
-    m_RemainingDuration = OriginalDuration;
+    m_RemainingDuration = m_OriginalDuration;
 }
 
-} /* namespace Battle */
\ No newline at end of file
+} /* namespace Battle */
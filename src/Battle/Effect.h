@@ -1,12 +1,13 @@
 #pragma once
 
-#include <string>
-
 namespace Battle
 {
 
-class BattleProfile;
-
+/**
+ * @brief Common part of battle effects: name and duration
+ * Effects are stored by value in a BattleProfile and dispatched without virtual calls, so every effect in
+ * EffectCollection provides Apply, Remove and TickAction members taking the affected profile.
+ */
 class Effect
 {
 public:
@@ -14,29 +15,12 @@ public:
      * @brief Constructor
      *
      * @param name effect name
-     * @param user user profile
-     * @param target target profile
      * @param duration duration
      */
-    Effect(const std::string& name, const BattleProfile& user, BattleProfile& target, int duration);
-
-    /**
-     * @brief Destructor
-     */
-    virtual ~Effect() = default;
-
-    /**
-     * @brief Apply the effect to the target
-     */
-    virtual void Apply() = 0;
+    Effect(const char* name, int duration);
 
     /**
-     * @brief De-apply the effect from the target
-     */
-    virtual void Remove() = 0;
-
-    /**
-     * @brief Perform the tick action and decrease duration
+     * @brief Decrease duration, after the tick action has been performed
      */
     void Tick();
 
@@ -48,29 +32,21 @@ public:
     /**
      * @brief Get the name
      *
-     * @return const std::string& name
+     * @return const char* name
      */
-    inline const std::string& GetName() const { return m_Name; }
+    inline const char* GetName() const { return m_Name; }
 
     /**
      * @brief Get the remaining duration
      */
-    inline virtual int GetRemainingDuration() { return m_RemainingDuration; }
+    inline int GetRemainingDuration() const { return m_RemainingDuration; }
 
 protected:
     constexpr static const int InfiniteDuration = -1;
 
-    const int OriginalDuration;
-
-    std::string m_Name;
-    const BattleProfile& m_User;
-    BattleProfile& m_Target;
+    const char* m_Name;
+    int m_OriginalDuration;
     int m_RemainingDuration;
-
-    /**
-     * @brief Action performed every turn the effect is active
-     */
-    virtual void TickAction() = 0;
 };
 
-} /* namespace Battle */
\ No newline at end of file
+} /* namespace Battle */
@@ -0,0 +1,18 @@
+#include "EffectCollection.h"
+#include "BattleProfile.h"
+#include "DamageType.h"
+
+namespace Battle::EffectCollection
+{
+
+void Brace::Apply(BattleProfile& target)
+{
+    target.Resistances[DamageType::Physical.ToInt()] += 50;
+}
+
+void Brace::Remove(BattleProfile& target)
+{
+    target.Resistances[DamageType::Physical.ToInt()] -= 50;
+}
+
+} /* namespace Battle::EffectCollection */
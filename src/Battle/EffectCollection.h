@@ -1,8 +1,12 @@
 #pragma once
 
-#include "BattleProfile.h"
-#include "DamageType.h"
 #include "Effect.h"
+#include <variant>
+
+namespace Battle
+{
+class BattleProfile;
+}
 
 namespace Battle::EffectCollection
 {
@@ -13,16 +17,37 @@ namespace Battle::EffectCollection
 class Brace : public Effect
 {
 public:
-    Brace(const BattleProfile& user, BattleProfile& target, int duration) : Effect("Brace", user, target, duration) {}
+    Brace(const BattleProfile& user, int duration) : Effect("Brace", duration) {}
 
-    void Apply() override { m_Target.Resistances[DamageType::Physical.ToInt()] += 50; }
+    void Apply(BattleProfile& target);
 
-    void Remove() override { m_Target.Resistances[DamageType::Physical.ToInt()] -= 50; }
+    void Remove(BattleProfile& target);
 
-    void TickAction() override
+    void TickAction(BattleProfile& target)
     {
         // do nothing
     }
 };
 
-} /* namespace Battle::EffectCollection */
\ No newline at end of file
+} /* namespace Battle::EffectCollection */
+
+namespace Battle
+{
+
+/**
+ * @brief Any effect out of the collection, stored by value
+ */
+using ActiveEffect = std::variant<EffectCollection::Brace>;
+
+/**
+ * @brief Access the name and duration of an active effect
+ *
+ * @param activeEffect active effect
+ * @return const Effect& effect
+ */
+inline const Effect& AsEffect(const ActiveEffect& activeEffect)
+{
+    return std::visit([](const auto& effect) -> const Effect& { return effect; }, activeEffect);
+}
+
+} /* namespace Battle */
@@ -0,0 +1,27 @@
+#include "InitiativeScheduler.h"
+#include "Misc/Exceptions.h"
+#include <algorithm>
+
+namespace Battle
+{
+
+int InitiativeScheduler::Initiative(const Entities::Stats& stats)
+{
+    return BaseInitiative + std::max(0, stats.Dexterity);
+}
+
+int64_t InitiativeScheduler::Delay(int actionCost, int initiative)
+{
+    return std::max<int64_t>(1, actionCost * TimeScale / initiative);
+}
+
+InitiativeScheduler::InitiativeScheduler() : m_IsRootTaken(false), m_Now(0), m_Sequence(0)
+{
+}
+
+void InitiativeScheduler::Reserve(size_t combatants)
+{
+    m_Heap.reserve(combatants);
+}
+
+} /* namespace Battle */
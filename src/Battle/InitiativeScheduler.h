@@ -0,0 +1,203 @@
+#pragma once
+
+#include "Entities/Stats.h"
+#include "Misc/Exceptions.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Battle
+{
+
+/**
+ * @brief Turn order of a battle with any number of combatants
+ * Every combatant is queued at the time of its next turn. Acting pushes the turn back by the action cost divided by
+ * the combatant's initiative, so faster combatants act more often. Scheduling and taking the next turn are
+ * O(log n); turns at the same time are taken in the order they were scheduled. The turn taken last stays at the
+ * root of the heap until the next call, so queueing the acting combatant again costs a single sift-down.
+ */
+class InitiativeScheduler
+{
+public:
+    /**
+     * @brief Initiative time units one action cost unit takes at an initiative of 1
+     */
+    constexpr static const int64_t TimeScale = 1000;
+
+    /**
+     * @brief Initiative of a combatant without any Dexterity
+     */
+    constexpr static const int BaseInitiative = 100;
+
+    /**
+     * @brief Calculate the initiative of a combatant
+     *
+     * @param stats combatant stats
+     * @return int initiative
+     */
+    static int Initiative(const Entities::Stats& stats);
+
+    /**
+     * @brief Calculate the time an action takes
+     *
+     * @param actionCost action cost
+     * @param initiative initiative of the acting combatant
+     * @return int64_t delay until the combatant's next turn
+     */
+    static int64_t Delay(int actionCost, int initiative);
+
+    /**
+     * @brief Constructor
+     */
+    InitiativeScheduler();
+
+    /**
+     * @brief Reserve space for a number of combatants
+     *
+     * @param combatants combatant count
+     */
+    void Reserve(size_t combatants);
+
+    /**
+     * @brief Queue a turn
+     *
+     * @param combatant combatant index
+     * @param delay time from now until the turn
+     */
+    void Schedule(size_t combatant, int64_t delay);
+
+    /**
+     * @brief Take the next turn off the queue and advance the time to it
+     *
+     * @return size_t combatant index
+     * @throw CustomException if no turns are queued
+     */
+    size_t Next();
+
+    /**
+     * @brief Check whether any turns are queued
+     *
+     * @return true if empty
+     */
+    inline bool Empty() const { return m_Heap.size() == (m_IsRootTaken ? 1 : 0); }
+
+    /**
+     * @brief Get the time of the turn taken last
+     *
+     * @return int64_t time
+     */
+    inline int64_t Now() const { return m_Now; }
+
+private:
+    /**
+     * @brief Queued turn
+     */
+    struct Turn
+    {
+        int64_t Time;
+        uint64_t Sequence;
+        size_t Combatant;
+
+        inline bool operator>(const Turn& other) const
+        {
+            return Time != other.Time ? Time > other.Time : Sequence > other.Sequence;
+        }
+    };
+
+    /**
+     * @brief Binary min-heap of queued turns
+     */
+    std::vector<Turn> m_Heap;
+
+    /**
+     * @brief True if the root of the heap is the turn taken last and no longer queued
+     */
+    bool m_IsRootTaken;
+
+    int64_t m_Now;
+    uint64_t m_Sequence;
+
+    /**
+     * @brief Move a turn down from a position until the heap is in order again
+     *
+     * @param position heap position
+     * @param turn turn to place
+     */
+    void SiftDown(size_t position, Turn turn);
+
+    /**
+     * @brief Move a turn up from a position until the heap is in order again
+     *
+     * @param position heap position
+     * @param turn turn to place
+     */
+    void SiftUp(size_t position, Turn turn);
+};
+
+inline void InitiativeScheduler::Schedule(size_t combatant, int64_t delay)
+{
+    Turn turn { m_Now + delay, m_Sequence++, combatant };
+    if (m_IsRootTaken)
+    {
+        m_IsRootTaken = false;
+        SiftDown(0, turn);
+        return;
+    }
+
+    m_Heap.push_back(turn);
+    SiftUp(m_Heap.size() - 1, turn);
+}
+
+inline size_t InitiativeScheduler::Next()
+{
+    if (m_IsRootTaken)
+    {
+        // The turn taken last was not queued again, fill its place with the last turn
+        m_IsRootTaken = false;
+        Turn last     = m_Heap.back();
+        m_Heap.pop_back();
+        if (!m_Heap.empty())
+            SiftDown(0, last);
+    }
+    if (m_Heap.empty())
+    {
+        throw CustomException("InitiativeScheduler::Next() failed - no turns queued");
+    }
+
+    m_IsRootTaken = true;
+    m_Now         = m_Heap.front().Time;
+    return m_Heap.front().Combatant;
+}
+
+inline void InitiativeScheduler::SiftDown(size_t position, Turn turn)
+{
+    size_t size = m_Heap.size();
+    while (true)
+    {
+        size_t child = 2 * position + 1;
+        if (child >= size)
+            break;
+        if (child + 1 < size && m_Heap[child] > m_Heap[child + 1])
+            child++;
+        if (!(turn > m_Heap[child]))
+            break;
+        m_Heap[position] = m_Heap[child];
+        position         = child;
+    }
+    m_Heap[position] = turn;
+}
+
+inline void InitiativeScheduler::SiftUp(size_t position, Turn turn)
+{
+    while (position > 0)
+    {
+        size_t parent = (position - 1) / 2;
+        if (!(m_Heap[parent] > turn))
+            break;
+        m_Heap[position] = m_Heap[parent];
+        position         = parent;
+    }
+    m_Heap[position] = turn;
+}
+
+} /* namespace Battle */
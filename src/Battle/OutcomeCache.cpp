@@ -0,0 +1,51 @@
+#include "OutcomeCache.h"
+#include "AttackSkill.h"
+
+namespace Battle
+{
+
+OutcomeDistribution OutcomeCache::Get(const AttackSkill& skill,
+                                      const BattleProfile& userProfile,
+                                      const BattleProfile& targetProfile)
+{
+    const auto& user   = userProfile.Stats;
+    const auto& target = targetProfile.Stats;
+    int resistance     = targetProfile.Resistances[skill.GetDamageType().ToInt()];
+    Key key { &skill,
+              { user.Level,
+                user.MaxHealth,
+                user.MaxMana,
+                user.Strength,
+                user.Dexterity,
+                user.Sorcery,
+                user.Wisdom,
+                target.Level,
+                target.MaxHealth,
+                target.MaxMana,
+                target.Strength,
+                target.Dexterity,
+                target.Sorcery,
+                target.Wisdom,
+                resistance } };
+
+    auto it = m_Entries.find(key);
+    if (it != m_Entries.end())
+    {
+        m_HitCount++;
+        return it->second;
+    }
+
+    m_MissCount++;
+    if (m_Entries.size() >= Capacity)
+    {
+        m_Entries.clear();
+    }
+    return m_Entries.emplace(key, skill.CalculateOutcomeDistribution(userProfile, targetProfile)).first->second;
+}
+
+void OutcomeCache::Clear()
+{
+    m_Entries.clear();
+}
+
+} /* namespace Battle */
\ No newline at end of file
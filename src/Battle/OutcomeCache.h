@@ -0,0 +1,71 @@
+#pragma once
+
+#include "BattleProfile.h"
+#include "OutcomeDistribution.h"
+#include <array>
+#include <cstddef>
+#include <map>
+#include <utility>
+
+namespace Battle
+{
+
+class AttackSkill;
+
+/**
+ * @brief Memo of attack outcome distributions, kept by the caller which projects or evaluates attacks repeatedly
+ * Entries are keyed on the skill and the stats of both sides (except health and mana) and the target resistance,
+ * so damage formulas must not depend on current health or mana. Distributions are returned by value, so clearing
+ * the memo never invalidates one held by the caller.
+ */
+class OutcomeCache
+{
+public:
+    /**
+     * @brief Number of distributions kept before the cache is cleared
+     */
+    constexpr static const size_t Capacity = 64;
+
+    /**
+     * @brief Get the distribution of the damage dealt by using an attack skill, calculating it on a miss
+     *
+     * @param skill attack skill
+     * @param userProfile skill user profile
+     * @param targetProfile skill target profile
+     * @return OutcomeDistribution outcome distribution
+     */
+    OutcomeDistribution Get(const AttackSkill& skill,
+                            const BattleProfile& userProfile,
+                            const BattleProfile& targetProfile);
+
+    /**
+     * @brief Drop all cached distributions
+     */
+    void Clear();
+
+    /**
+     * @brief Get the number of lookups answered from the cache
+     *
+     * @return size_t hit count
+     */
+    inline size_t GetHitCount() const { return m_HitCount; }
+
+    /**
+     * @brief Get the number of lookups which had to calculate the distribution
+     *
+     * @return size_t miss count
+     */
+    inline size_t GetMissCount() const { return m_MissCount; }
+
+private:
+    /**
+     * @brief Skill, stats of both sides (except health and mana) and the target resistance
+     */
+    using Key = std::pair<const AttackSkill*, std::array<int, 15>>;
+
+    std::map<Key, OutcomeDistribution> m_Entries;
+    size_t m_HitCount  = 0;
+    size_t m_MissCount = 0;
+};
+
+} /* namespace Battle */
\ No newline at end of file
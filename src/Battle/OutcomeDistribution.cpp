@@ -0,0 +1,74 @@
+#include "OutcomeDistribution.h"
+#include "AttackSkill.h"
+#include <algorithm>
+
+namespace Battle
+{
+
+OutcomeDistribution::OutcomeDistribution(int hitChance,
+                                         int critChance,
+                                         const std::pair<int, int>& damageRange,
+                                         int resistance)
+    : m_HitChance(hitChance),
+      m_CritChance(critChance),
+      m_MinDamage(0),
+      m_ExpectedDamage(0)
+{
+    // Same thresholds as RNG::Chance
+    double hitProbability  = std::clamp(hitChance / 100., 0., 1.);
+    double critProbability = std::clamp(critChance / 100., 0., 1.);
+    int low                = damageRange.first;
+    int high               = std::max(damageRange.first, damageRange.second);
+
+    // Every base damage value is equally likely and leads to one outcome with and one without a crit
+    std::vector<std::pair<int, double>> outcomes { { 0, 1. - hitProbability } };
+    double baseProbability = hitProbability / (high - low + 1);
+    for (int baseDamage = low; baseDamage <= high; baseDamage++)
+    {
+        outcomes.push_back({ AttackSkill::ApplyResistance(baseDamage, resistance),
+                             baseProbability * (1. - critProbability) });
+        outcomes.push_back({ AttackSkill::ApplyResistance(AttackSkill::ApplyCrit(baseDamage, damageRange), resistance),
+                             baseProbability * critProbability });
+    }
+
+    // Impossible outcomes (e.g. a miss at 100 % hit chance) must not widen the damage range
+    outcomes.erase(std::remove_if(outcomes.begin(),
+                                  outcomes.end(),
+                                  [](const auto& outcome) { return outcome.second <= 0; }),
+                   outcomes.end());
+    auto [minOutcome, maxOutcome] = std::minmax_element(
+        outcomes.begin(), outcomes.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+    m_MinDamage = minOutcome->first;
+    m_Probabilities.assign(maxOutcome->first - m_MinDamage + 1, 0.);
+    for (const auto& [damage, probability] : outcomes)
+    {
+        m_Probabilities[damage - m_MinDamage] += probability;
+        m_ExpectedDamage += damage * probability;
+    }
+
+    m_TailProbabilities.resize(m_Probabilities.size());
+    double tail = 0;
+    for (int i = m_Probabilities.size() - 1; i >= 0; i--)
+    {
+        tail += m_Probabilities[i];
+        m_TailProbabilities[i] = tail;
+    }
+}
+
+double OutcomeDistribution::Probability(int damage) const
+{
+    if (damage < m_MinDamage || damage > GetMaxDamage())
+        return 0;
+    return m_Probabilities[damage - m_MinDamage];
+}
+
+double OutcomeDistribution::ProbabilityAtLeast(int damage) const
+{
+    if (damage <= m_MinDamage)
+        return 1;
+    if (damage > GetMaxDamage())
+        return 0;
+    return m_TailProbabilities[damage - m_MinDamage];
+}
+
+} /* namespace Battle */
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <utility>
+#include <vector>
+
+namespace Battle
+{
+
+/**
+ * @brief Exact probability distribution of the damage dealt by a single attack skill use
+ * Mirrors the sampling in AttackSkill::ApplySkill (hit roll, uniform base damage, crit roll, resistance scaling),
+ * so projections and AI evaluations can be made without simulating the attack.
+ */
+class OutcomeDistribution
+{
+public:
+    /**
+     * @brief Constructor
+     *
+     * @param hitChance hit chance in percent
+     * @param critChance crit chance in percent
+     * @param damageRange effective damage range before crits and resistances
+     * @param resistance target resistance to the damage type in percent
+     */
+    OutcomeDistribution(int hitChance, int critChance, const std::pair<int, int>& damageRange, int resistance);
+
+    /**
+     * @brief Get the hit chance
+     *
+     * @return int hit chance in percent
+     */
+    inline int GetHitChance() const { return m_HitChance; }
+
+    /**
+     * @brief Get the crit chance, which only applies on a hit
+     *
+     * @return int crit chance in percent
+     */
+    inline int GetCritChance() const { return m_CritChance; }
+
+    /**
+     * @brief Get the smallest possible damage value, including a miss
+     *
+     * @return int smallest damage value
+     */
+    inline int GetMinDamage() const { return m_MinDamage; }
+
+    /**
+     * @brief Get the largest possible damage value
+     *
+     * @return int largest damage value
+     */
+    inline int GetMaxDamage() const { return m_MinDamage + static_cast<int>(m_Probabilities.size()) - 1; }
+
+    /**
+     * @brief Get the expected damage, including misses
+     *
+     * @return double expected damage
+     */
+    inline double GetExpectedDamage() const { return m_ExpectedDamage; }
+
+    /**
+     * @brief Get the probability of dealing exactly the given damage
+     *
+     * @param damage damage value
+     * @return double probability
+     */
+    double Probability(int damage) const;
+
+    /**
+     * @brief Get the probability of dealing at least the given damage
+     *
+     * @param damage damage value
+     * @return double probability
+     */
+    double ProbabilityAtLeast(int damage) const;
+
+    /**
+     * @brief Get the probability that the attack brings a target with the given health to 0 or below
+     *
+     * @param targetHealth target's current health
+     * @return double kill probability
+     */
+    inline double KillProbability(int targetHealth) const { return ProbabilityAtLeast(targetHealth); }
+
+private:
+    int m_HitChance;
+    int m_CritChance;
+    int m_MinDamage;
+    double m_ExpectedDamage;
+
+    /**
+     * @brief Probability of each damage value, starting at the smallest one
+     */
+    std::vector<double> m_Probabilities;
+
+    /**
+     * @brief Probability of at least each damage value, starting at the smallest one
+     */
+    std::vector<double> m_TailProbabilities;
+};
+
+} /* namespace Battle */
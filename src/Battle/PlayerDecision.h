@@ -0,0 +1,38 @@
+#pragma once
+
+#include "Battle.h"
+#include "Skill.h"
+
+namespace Battle
+{
+
+/**
+ * @brief Source of the player's choices in battle
+ */
+class PlayerDecision
+{
+public:
+    /**
+     * @brief Destructor
+     */
+    virtual ~PlayerDecision() = default;
+
+    /**
+     * @brief Choose the skill the player uses this turn
+     *
+     * @param battle battle in progress
+     * @return Skill* chosen skill owned by the player, or null to escape from the battle
+     */
+    virtual Skill* ChooseSkill(const Battle& battle) = 0;
+
+    /**
+     * @brief Choose the enemy to use a skill targeting the opponent on
+     *
+     * @param battle battle in progress
+     * @param skill chosen skill
+     * @return size_t combatant index of an enemy still standing; the weakest one by default
+     */
+    virtual size_t ChooseTarget(const Battle& battle, const Skill& skill) { return battle.SuggestTarget(true); }
+};
+
+} /* namespace Battle */
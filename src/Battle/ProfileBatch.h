@@ -0,0 +1,83 @@
+#pragma once
+
+#include "BattleProfile.h"
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace Battle
+{
+
+/**
+ * @brief Structure-of-arrays view of the attack-relevant parts of many battle profiles
+ * Each stat is a contiguous array, so batched attack resolution can process several profiles per instruction.
+ */
+struct ProfileBatch
+{
+    std::vector<int> Level;
+    std::vector<int> Strength;
+    std::vector<int> Dexterity;
+    std::vector<int> Sorcery;
+
+    /**
+     * @brief Resistances in percent, indexed by damage type
+     */
+    std::array<std::vector<int>, 5> Resistances;
+
+    /**
+     * @brief Get the number of profiles
+     *
+     * @return size_t size
+     */
+    inline size_t Size() const { return Level.size(); }
+
+    /**
+     * @brief Change the number of profiles, new ones are zeroed
+     *
+     * @param size size
+     */
+    void Resize(size_t size)
+    {
+        Level.resize(size);
+        Strength.resize(size);
+        Dexterity.resize(size);
+        Sorcery.resize(size);
+        for (auto& resistances : Resistances)
+            resistances.resize(size);
+    }
+
+    /**
+     * @brief Copy a profile into the batch
+     *
+     * @param index index
+     * @param profile battle profile
+     */
+    void Set(size_t index, const BattleProfile& profile)
+    {
+        Level[index]     = profile.Stats.Level;
+        Strength[index]  = profile.Stats.Strength;
+        Dexterity[index] = profile.Stats.Dexterity;
+        Sorcery[index]   = profile.Stats.Sorcery;
+        for (size_t type = 0; type < Resistances.size(); type++)
+            Resistances[type][index] = profile.Resistances[type];
+    }
+
+    /**
+     * @brief Copy a profile out of the batch; stats which are not part of the batch are zero
+     *
+     * @param index index
+     * @param profile battle profile to write to
+     */
+    void Get(size_t index, BattleProfile& profile) const
+    {
+        profile.Stats           = {};
+        profile.Stats.Level     = Level[index];
+        profile.Stats.Strength  = Strength[index];
+        profile.Stats.Dexterity = Dexterity[index];
+        profile.Stats.Sorcery   = Sorcery[index];
+        for (size_t type = 0; type < Resistances.size(); type++)
+            profile.Resistances[type] = Resistances[type][index];
+    }
+};
+
+} /* namespace Battle */
@@ -0,0 +1,29 @@
+#include "RandomPlayerDecision.h"
+#include "Misc/RNG.h"
+
+namespace Battle
+{
+
+Skill* RandomPlayerDecision::ChooseSkill(const Battle& battle)
+{
+    const auto& skills = battle.GetPlayer().GetSkills();
+
+    int activeSkillCount = 0;
+    for (const auto& skill : skills)
+    {
+        if (skill->GetCategory() != Skill::Category::Passive)
+            activeSkillCount++;
+    }
+    if (activeSkillCount == 0)
+        return nullptr;
+
+    int choice = RNG::RandomInt(activeSkillCount);
+    for (const auto& skill : skills)
+    {
+        if (skill->GetCategory() != Skill::Category::Passive && choice-- == 0)
+            return skill.get();
+    }
+    return nullptr;
+}
+
+} /* namespace Battle */
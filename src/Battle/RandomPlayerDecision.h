@@ -0,0 +1,23 @@
+#pragma once
+
+#include "PlayerDecision.h"
+
+namespace Battle
+{
+
+/**
+ * @brief Scripted player policy which uses a random active skill every turn and never escapes
+ */
+class RandomPlayerDecision : public PlayerDecision
+{
+public:
+    /**
+     * @brief Choose a random skill out of the player's non-passive skills
+     *
+     * @param battle battle in progress
+     * @return Skill* chosen skill, or null if the player has no usable skills
+     */
+    virtual Skill* ChooseSkill(const Battle& battle) override;
+};
+
+} /* namespace Battle */
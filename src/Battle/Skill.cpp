@@ -9,13 +9,15 @@ Skill::Skill(Category category,
              const std::string& name,
              const std::string& flavorText,
              const std::string& longDescription,
-             int baseManaCost)
+             int baseManaCost,
+             int actionCost)
     : m_Category(category),
       m_TargetType(targetType),
       m_Name(name),
       m_FlavorText(flavorText),
       m_LongDescription(longDescription),
-      m_BaseManaCost(baseManaCost)
+      m_BaseManaCost(baseManaCost),
+      m_ActionCost(actionCost)
 {
 }
 
@@ -1,13 +1,9 @@
 #pragma once
 
 #include "BattleProfile.h"
+#include "SkillResult.h"
 #include <string>
 
-namespace UI
-{
-class BattleScreen;
-}
-
 namespace Battle
 {
 
@@ -29,6 +25,16 @@ public:
         Special
     };
 
+    /**
+     * @brief Number of categories
+     */
+    constexpr static const int CategoryCount = 5;
+
+    /**
+     * @brief Action cost of an ordinary skill, in initiative time units
+     */
+    constexpr static const int StandardActionCost = 100;
+
     /**
      * @brief Possible targets for the skill
      */
@@ -40,17 +46,6 @@ public:
         Both
     };
 
-    /**
-     * @brief Result data for ApplySkill - base struct
-     */
-    struct SkillResult
-    {
-        /**
-         * @brief Was a hit
-         */
-        bool IsHit;
-    };
-
     /**
      * @brief Constructor
      *
@@ -60,13 +55,15 @@ public:
      * @param flavorText flavor text (up to 24 characters)
      * @param longDescription longer description
      * @param baseManaCost base mana cost
+     * @param actionCost action cost, in initiative time units
      */
     Skill(Category category,
           Target targetType,
           const std::string& name,
           const std::string& flavorText,
           const std::string& longDescription,
-          int baseManaCost);
+          int baseManaCost,
+          int actionCost = StandardActionCost);
 
     /**
      * @brief Destructor
@@ -75,27 +72,31 @@ public:
 
     /**
      * @brief Apply skill to target
+     * Skills hold no per-use state, so one skill object can be used by any number of battles.
      *
      * @param userProfile user battle profile
      * @param targetProfile target battle profile to apply effects to
-     * @return std::unique_ptr<SkillResult> result data
+     * @return SkillResult result data
      */
-    virtual void ApplySkill(const BattleProfile& userProfile, BattleProfile& targetProfile) = 0;
+    virtual SkillResult ApplySkill(const BattleProfile& userProfile, BattleProfile& targetProfile) const = 0;
 
     /**
-     * @brief Action to perform when the skill is hovered over in the battle menu
+     * @brief Calculate effective hit chance for a particular instance
      *
-     * @param battleScreen battle screen
+     * @param userProfile skill user profile
+     * @param targetProfile skill target profile
+     * @return int effective hit chance
      */
-    virtual void OnBattleMenuHover(UI::BattleScreen& battleScreen) = 0;
+    virtual int CalculateHitChance(const BattleProfile& userProfile, const BattleProfile& targetProfile) const = 0;
 
     /**
-     * @brief Animate the result of the last skill usage on the battle screen
-     * 
-     * @param battleScreen battle screen
-     * @param isPlayer true if the user is the player
+     * @brief Apply the lasting effects of a hit to the target without rolling for it
+     * Lets AI evaluate the skill on a copy of the target profile.
+     *
+     * @param userProfile user battle profile
+     * @param targetProfile target battle profile to apply effects to
      */
-    virtual void AnimateTo(UI::BattleScreen& battleScreen, bool isPlayer) const = 0;
+    virtual void ApplyEffects(const BattleProfile& userProfile, BattleProfile& targetProfile) const {}
 
     /**
      * @brief Get the Category
@@ -139,6 +140,14 @@ public:
      */
     int GetManaCost() const;
 
+    /**
+     * @brief Get the action cost, which delays the user's next turn proportionally
+     * Quick skills cost less than StandardActionCost, heavy ones more.
+     *
+     * @return int action cost
+     */
+    inline int GetActionCost() const { return m_ActionCost; }
+
 protected:
     Category m_Category;
     Target m_TargetType;
@@ -146,6 +155,7 @@ protected:
     std::string m_FlavorText;
     std::string m_LongDescription;
     int m_BaseManaCost;
+    int m_ActionCost;
 };
 
 } /* namespace Battle */
\ No newline at end of file
@@ -3,12 +3,13 @@
 #include "ApplyEffectOnlySkill.h"
 #include "AttackSkill.h"
 #include "EffectCollection.h"
+#include <algorithm>
 
 namespace Battle::SkillCollection
 {
 
 /**
- * @brief Single turn physical defense move
+ * @brief Single turn physical defense move, quick to take
  */
 class Brace : public ApplyEffectOnlySkill<EffectCollection::Brace>
 {
@@ -18,11 +19,13 @@ public:
                                Target::Self,
                                "Brace",
                                "Brace for the next blow",
-                               "Increases physical resistance by 50% for the next turn.",
+                               "Increases physical resistance by 50% for the next turn. Takes half as long as an "
+                               "attack.",
                                "Next turn:\nPhys. Res. +50%",
                                100,
                                1,
-                               0)
+                               0,
+                               StandardActionCost / 2)
     {
     }
 };
@@ -41,6 +44,14 @@ public:
     {
         return baseDamage;
     }
+
+    inline void CalculateEffectiveDamageBatch(int baseDamage,
+                                              const ProfileBatch& users,
+                                              const ProfileBatch& targets,
+                                              int* out) const override
+    {
+        std::fill(out, out + users.Size(), baseDamage);
+    }
 };
 
 /**
@@ -68,15 +79,27 @@ public:
     {
         return baseDamage + userProfile.Stats.Strength / 10;
     }
+
+    inline void CalculateEffectiveDamageBatch(int baseDamage,
+                                              const ProfileBatch& users,
+                                              const ProfileBatch& targets,
+                                              int* out) const override
+    {
+        for (size_t i = 0; i < users.Size(); i++)
+            out[i] = baseDamage + users.Strength[i] / 10;
+    }
 };
 
 /**
- * @brief Basic magic attack (NPC only)
+ * @brief Basic magic attack, slow to cast (NPC only)
  */
 class Wail : public AttackSkill
 {
 public:
-    Wail() : AttackSkill(Category::Spell, "Wail", "", "", { 2, 3 }, DamageType::Magic, 80, 5, 0) {}
+    Wail()
+        : AttackSkill(Category::Spell, "Wail", "", "", { 2, 3 }, DamageType::Magic, 80, 5, 0, StandardActionCost * 3 / 2)
+    {
+    }
 
     inline int CalculateEffectiveDamage(int baseDamage,
                                         const BattleProfile& userProfile,
@@ -84,6 +107,15 @@ public:
     {
         return baseDamage + userProfile.Stats.Sorcery / 10;
     }
+
+    inline void CalculateEffectiveDamageBatch(int baseDamage,
+                                              const ProfileBatch& users,
+                                              const ProfileBatch& targets,
+                                              int* out) const override
+    {
+        for (size_t i = 0; i < users.Size(); i++)
+            out[i] = baseDamage + users.Sorcery[i] / 10;
+    }
 };
 
 } /* namespace Battle::SkillCollection */
\ No newline at end of file
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "DamageInstance.h"
+#include <variant>
+
+namespace Battle
+{
+
+/**
+ * @brief Attack skill result data
+ */
+struct AttackSkillResult
+{
+    /**
+     * @brief Was a hit
+     */
+    bool IsHit;
+
+    /**
+     * @brief Was a crit (if applicable)
+     */
+    bool IsCrit;
+
+    /**
+     * @brief Damage value (if applicable)
+     */
+    DamageInstance Damage;
+};
+
+/**
+ * @brief Apply-effect-only skill result data
+ */
+struct ApplyEffectOnlySkillResult
+{
+    /**
+     * @brief Was a hit
+     */
+    bool IsHit;
+};
+
+/**
+ * @brief Result data of any skill usage, returned by value from Skill::ApplySkill
+ */
+using SkillResult = std::variant<AttackSkillResult, ApplyEffectOnlySkillResult>;
+
+} /* namespace Battle */
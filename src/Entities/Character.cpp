@@ -1,6 +1,7 @@
 #include "Character.h"
 #include "EntityManager.h"
 #include "Misc/Direction.h"
+#include "NPC/Behavior/RandomBattleBehavior.h"
 #include "NPC/Behavior/WanderingMovement.h"
 #include "Worlds/Room.h"
 #include <cmath>
@@ -19,7 +20,10 @@ Character::Character(const std::string& name,
     : Entity(name, description, icon, isBlocking),
       m_BaseXPReward(baseXPReward),
       m_Stats(initialStats),
-      m_MovementBehavior(std::make_unique<NPC::Behavior::WanderingMovement>(*this))
+      m_MovementBehavior(std::make_unique<NPC::Behavior::WanderingMovement>(*this)),
+      m_BattleBehavior(std::make_unique<NPC::Behavior::RandomBattleBehavior>()),
+      m_SkillCategoryMask(0),
+      m_CategoryOffsets {}
 {
 }
 
@@ -28,6 +32,13 @@ Direction Character::GetNextMove(const EntityManager& entityManager)
     return m_MovementBehavior->GetNextStep(entityManager);
 }
 
+const Battle::Skill& Character::ChooseBattleSkill(const Battle::BattleProfile& profile,
+                                                  const Character& opponent,
+                                                  const Battle::BattleProfile& opponentProfile)
+{
+    return m_BattleBehavior->ChooseSkill(*this, profile, opponent, opponentProfile);
+}
+
 bool Character::Fightable() const
 {
     return true;
@@ -38,4 +49,16 @@ int Character::CalculateXPReward() const
     return lround(m_BaseXPReward * sqrt(m_Stats.Level));
 }
 
+void Character::IndexSkill(Battle::Skill& skill)
+{
+    // Insert at the end of the skill's category group and shift the groups after it
+    int category = static_cast<int>(skill.GetCategory());
+    m_SkillsByCategory.insert(m_SkillsByCategory.begin() + m_CategoryOffsets[category + 1], &skill);
+    for (int i = category + 1; i <= Battle::Skill::CategoryCount; i++)
+    {
+        m_CategoryOffsets[i]++;
+    }
+    m_SkillCategoryMask |= 1u << category;
+}
+
 } /* namespace Entities */
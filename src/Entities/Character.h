@@ -3,6 +3,7 @@
 #include "Battle/Skill.h"
 #include "Entity.h"
 #include "Misc/Direction.h"
+#include "NPC/Behavior/IBattleBehavior.h"
 #include "NPC/Behavior/IMovement.h"
 #include "Stats.h"
 #include <array>
@@ -15,6 +16,43 @@ namespace Entities
 
 class EntityManager;
 
+/**
+ * @brief Contiguous range of skills of a single category
+ */
+class SkillRange
+{
+public:
+    /**
+     * @brief Constructor
+     *
+     * @param first first skill
+     * @param last past the last skill
+     */
+    SkillRange(Battle::Skill* const* first, Battle::Skill* const* last) : m_First(first), m_Last(last) {}
+
+    inline Battle::Skill* const* begin() const { return m_First; }
+    inline Battle::Skill* const* end() const { return m_Last; }
+
+    /**
+     * @brief Get the number of skills
+     *
+     * @return size_t size
+     */
+    inline size_t Size() const { return m_Last - m_First; }
+
+    /**
+     * @brief Access a skill
+     *
+     * @param index index
+     * @return Battle::Skill& skill
+     */
+    inline Battle::Skill& operator[](size_t index) const { return *m_First[index]; }
+
+private:
+    Battle::Skill* const* m_First;
+    Battle::Skill* const* m_Last;
+};
+
 /**
  * @brief Game character with stats and movement
  */
@@ -58,6 +96,18 @@ public:
      */
     virtual Direction GetNextMove(const EntityManager& entityManager) override;
 
+    /**
+     * @brief Choose the skill to use in the character's battle turn
+     *
+     * @param profile battle profile of the character
+     * @param opponent opposing character
+     * @param opponentProfile battle profile of the opposing character
+     * @return const Battle::Skill& chosen skill
+     */
+    const Battle::Skill& ChooseBattleSkill(const Battle::BattleProfile& profile,
+                                           const Character& opponent,
+                                           const Battle::BattleProfile& opponentProfile);
+
     /**
      * @brief Is this fightable?
      *
@@ -75,9 +125,40 @@ public:
     /**
      * @brief Get the skillset
      *
-     * @return auto& skillset
+     * @return const auto& skillset
      */
-    inline auto& GetSkills() { return m_Skillset; }
+    inline const auto& GetSkills() const { return m_Skillset; }
+
+    /**
+     * @brief Get the skill categories the character has skills in
+     *
+     * @return unsigned bit mask of Battle::Skill::Category values
+     */
+    inline unsigned GetSkillCategoryMask() const { return m_SkillCategoryMask; }
+
+    /**
+     * @brief Check whether the character has skills of a category
+     *
+     * @param category skill category
+     * @return true if there is at least one
+     */
+    inline bool HasSkillCategory(Battle::Skill::Category category) const
+    {
+        return m_SkillCategoryMask & (1u << static_cast<int>(category));
+    }
+
+    /**
+     * @brief Get the skills of a category, in the order they were granted
+     *
+     * @param category skill category
+     * @return SkillRange skills, valid until the next skill is granted
+     */
+    inline SkillRange GetSkillsOfCategory(Battle::Skill::Category category) const
+    {
+        int index = static_cast<int>(category);
+        return { m_SkillsByCategory.data() + m_CategoryOffsets[index],
+                 m_SkillsByCategory.data() + m_CategoryOffsets[index + 1] };
+    }
 
     /**
      * @brief Get the XP reward for killing this
@@ -92,13 +173,38 @@ public:
      * @tparam SkillType skill class
      * @param level skill level to add
      */
-    template<typename SkillClass> void GrantSkill(int level = 1) { m_Skillset.emplace_back(new SkillClass()); }
+    template<typename SkillClass> void GrantSkill(int level = 1)
+    {
+        m_Skillset.emplace_back(new SkillClass());
+        IndexSkill(*m_Skillset.back());
+    }
 
 protected:
     const int m_BaseXPReward;
     Stats m_Stats;
     std::unique_ptr<NPC::Behavior::IMovement> m_MovementBehavior;
+    std::unique_ptr<NPC::Behavior::IBattleBehavior> m_BattleBehavior;
     std::vector<std::unique_ptr<Battle::Skill>> m_Skillset;
+
+private:
+    unsigned m_SkillCategoryMask;
+
+    /**
+     * @brief Skills grouped by category, in category order
+     */
+    std::vector<Battle::Skill*> m_SkillsByCategory;
+
+    /**
+     * @brief Start of every category's group in m_SkillsByCategory, followed by the total size
+     */
+    std::array<size_t, Battle::Skill::CategoryCount + 1> m_CategoryOffsets;
+
+    /**
+     * @brief Add a newly granted skill to the category index
+     *
+     * @param skill skill
+     */
+    void IndexSkill(Battle::Skill& skill);
 };
 
 } /* namespace Entities */
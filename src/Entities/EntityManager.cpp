@@ -2,6 +2,7 @@
 #include "Character.h"
 #include "Entity.h"
 #include "Misc/Direction.h"
+#include "Misc/Profiler.h"
 #include "Misc/RNG.h"
 #include "Player.h"
 #include "Worlds/Field.h"
@@ -171,6 +172,7 @@ const Worlds::Field* EntityManager::AdjacentField(
 
 void EntityManager::Cycle(Worlds::Room& room)
 {
+    PROFILE_SCOPE("EntityManager::Cycle");
     if (m_EntityStorage.count(&room) == 0)
     {
         return;
@@ -197,6 +199,7 @@ void EntityManager::Pluck(Entity& entity, Worlds::Room& room)
 
 void EntityManager::PopulateRoom(Worlds::Room& room, bool firstEntry)
 {
+    PROFILE_SCOPE("EntityManager::PopulateRoom");
     int entityCount = 0;
     double rng      = RNG::RandomDouble();
     double postRng  = RNG::RandomDouble();
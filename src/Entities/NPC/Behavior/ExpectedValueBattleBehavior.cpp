@@ -0,0 +1,218 @@
+#include "ExpectedValueBattleBehavior.h"
+#include "Battle/AttackSkill.h"
+#include "Battle/BattleProfile.h"
+#include "Character.h"
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+namespace Entities::NPC::Behavior
+{
+
+/**
+ * @brief Check whether a skill can be chosen: it must be active and have a single, fixed target
+ *
+ * @param skill skill
+ * @return true if usable
+ */
+static bool IsUsable(const Battle::Skill& skill)
+{
+    return skill.GetCategory() != Battle::Skill::Category::Passive
+           && (skill.GetTargetType() == Battle::Skill::Target::Opponent
+               || skill.GetTargetType() == Battle::Skill::Target::Self);
+}
+
+/**
+ * @brief Calculate the expected value of an attack: damage capped at the target's health, and a kill counting as
+ * the target's health once more
+ *
+ * @param outcomes memo of outcome distributions
+ * @param skill attack skill
+ * @param userProfile user battle profile
+ * @param targetProfile target battle profile
+ * @param killProbability output for the probability of killing the target (null if not needed)
+ * @return double expected value
+ */
+static double AttackValue(Battle::OutcomeCache& outcomes,
+                          const Battle::AttackSkill& skill,
+                          const Battle::BattleProfile& userProfile,
+                          const Battle::BattleProfile& targetProfile,
+                          double* killProbability = nullptr)
+{
+    auto distribution = outcomes.Get(skill, userProfile, targetProfile);
+    int health        = std::max(targetProfile.Stats.Health, 1);
+
+    double value = 0;
+    for (int damage = distribution.GetMinDamage(); damage <= distribution.GetMaxDamage(); damage++)
+    {
+        value += distribution.Probability(damage) * std::min(damage, health);
+    }
+    double kill = distribution.KillProbability(health);
+    if (killProbability)
+        *killProbability = kill;
+    return value + kill * health;
+}
+
+/**
+ * @brief Calculate the value of the best attack a character has against a target
+ *
+ * @param outcomes memo of outcome distributions
+ * @param attacker attacking character
+ * @param attackerProfile attacker battle profile
+ * @param targetProfile target battle profile
+ * @return double expected value of the best attack, 0 if there is none
+ */
+static double Threat(Battle::OutcomeCache& outcomes,
+                     const Character& attacker,
+                     const Battle::BattleProfile& attackerProfile,
+                     const Battle::BattleProfile& targetProfile)
+{
+    double threat = 0;
+    for (const auto& skill : attacker.GetSkills())
+    {
+        if (auto* attackSkill = dynamic_cast<const Battle::AttackSkill*>(skill.get()))
+            threat = std::max(threat, AttackValue(outcomes, *attackSkill, attackerProfile, targetProfile));
+    }
+    return threat;
+}
+
+/**
+ * @brief Score a skill by its expected value
+ *
+ * @param outcomes memo of outcome distributions
+ * @param skill skill
+ * @param self skill user
+ * @param selfProfile user battle profile
+ * @param opponent opposing character
+ * @param opponentProfile opponent battle profile
+ * @return double score, lowest for skills which cannot be used
+ */
+static double ScoreSkill(Battle::OutcomeCache& outcomes,
+                         const Battle::Skill& skill,
+                         const Character& self,
+                         const Battle::BattleProfile& selfProfile,
+                         const Character& opponent,
+                         const Battle::BattleProfile& opponentProfile)
+{
+    if (!IsUsable(skill))
+        return std::numeric_limits<double>::lowest();
+
+    bool targetsSelf                           = skill.GetTargetType() == Battle::Skill::Target::Self;
+    const Battle::BattleProfile& targetProfile = targetsSelf ? selfProfile : opponentProfile;
+
+    // Killing the opponent also spares the user the opponent's next attack
+    double score = 0;
+    if (auto* attackSkill = dynamic_cast<const Battle::AttackSkill*>(&skill))
+    {
+        double killProbability = 0;
+        score += AttackValue(outcomes, *attackSkill, selfProfile, targetProfile, &killProbability);
+        if (!targetsSelf && killProbability > 0)
+            score += killProbability * Threat(outcomes, opponent, opponentProfile, selfProfile);
+    }
+
+    // Effects are evaluated on copies of the profiles; refreshing an active effect changes nothing and is skipped
+    Battle::BattleProfile selfAfter     = selfProfile;
+    Battle::BattleProfile opponentAfter = opponentProfile;
+    Battle::BattleProfile& targetAfter  = targetsSelf ? selfAfter : opponentAfter;
+    skill.ApplyEffects(selfProfile, targetAfter);
+    if (targetAfter.ActiveEffectMask() != targetProfile.ActiveEffectMask())
+    {
+        double dealtGain = Threat(outcomes, self, selfAfter, opponentAfter)
+                           - Threat(outcomes, self, selfProfile, opponentProfile);
+        double takenLoss = Threat(outcomes, opponent, opponentProfile, selfProfile)
+                           - Threat(outcomes, opponent, opponentAfter, selfAfter);
+        score += skill.CalculateHitChance(selfProfile, targetProfile) / 100. * (dealtGain + takenLoss);
+    }
+    return score;
+}
+
+/**
+ * @brief Write the battle-relevant state of a profile to a key
+ *
+ * @param out position to write to, advanced past the written values
+ * @param profile battle profile
+ */
+static void WriteProfileKey(int*& out, const Battle::BattleProfile& profile)
+{
+    const auto& stats = profile.Stats;
+    for (int value : { stats.Level,
+                       stats.Health,
+                       stats.MaxHealth,
+                       stats.Mana,
+                       stats.MaxMana,
+                       stats.Strength,
+                       stats.Dexterity,
+                       stats.Sorcery,
+                       stats.Wisdom })
+    {
+        *out++ = value;
+    }
+    for (int resistance : profile.Resistances)
+    {
+        *out++ = resistance;
+    }
+    *out++ = static_cast<int>(profile.ActiveEffectMask());
+}
+
+const Battle::Skill& ExpectedValueBattleBehavior::ChooseSkill(const Character& self,
+                                                              const Battle::BattleProfile& selfProfile,
+                                                              const Character& opponent,
+                                                              const Battle::BattleProfile& opponentProfile)
+{
+    const auto& skills = self.GetSkills();
+
+    // Nothing to weigh with a single usable skill
+    const Battle::Skill* onlyUsable = nullptr;
+    for (const auto& skill : skills)
+    {
+        if (!IsUsable(*skill))
+            continue;
+        if (onlyUsable)
+        {
+            onlyUsable = nullptr;
+            break;
+        }
+        onlyUsable = skill.get();
+    }
+    if (onlyUsable)
+        return *onlyUsable;
+
+    StateKey key;
+    int* out = key.data();
+    WriteProfileKey(out, selfProfile);
+    WriteProfileKey(out, opponentProfile);
+    *out = static_cast<int>(opponent.GetSkills().size());
+
+    auto cached = m_ChoiceCache.find(key);
+    if (cached != m_ChoiceCache.end() && cached->second < skills.size())
+        return *skills[cached->second];
+
+    size_t bestIndex = 0;
+    double bestScore = std::numeric_limits<double>::lowest();
+    for (size_t i = 0; i < skills.size(); i++)
+    {
+        double score = ScoreSkill(m_OutcomeCache, *skills[i], self, selfProfile, opponent, opponentProfile);
+        if (score > bestScore)
+        {
+            bestIndex = i;
+            bestScore = score;
+        }
+    }
+
+    if (m_ChoiceCache.size() >= ChoiceCacheCapacity)
+        m_ChoiceCache.clear();
+    m_ChoiceCache.emplace(key, bestIndex);
+    return *skills.at(bestIndex);
+}
+
+size_t ExpectedValueBattleBehavior::StateHash::operator()(const StateKey& key) const
+{
+    uint64_t hash = 14695981039346656037ull;
+    for (int value : key)
+    {
+        hash = (hash ^ static_cast<uint32_t>(value)) * 1099511628211ull;
+    }
+    return static_cast<size_t>(hash);
+}
+
+} /* namespace Entities::NPC::Behavior */
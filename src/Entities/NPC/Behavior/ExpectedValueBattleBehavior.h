@@ -0,0 +1,60 @@
+#pragma once
+
+#include "Battle/OutcomeCache.h"
+#include "IBattleBehavior.h"
+#include <array>
+#include <cstddef>
+#include <unordered_map>
+
+namespace Entities::NPC::Behavior
+{
+
+/**
+ * @brief Uses the skill with the highest expected value, based on the exact outcome distributions of the attacks
+ * Attacks are worth their expected damage, capped at the target's health, plus a bonus for the chance to kill.
+ * Effects are worth the change in expected damage dealt and taken they cause, so e.g. physical attacks lose value
+ * against a braced target and bracing again while braced is worth nothing.
+ * Choices are cached per battle state, so repeated states cost a single lookup regardless of the number of skills.
+ * Outcome distributions are memoized separately, so states which differ only in health reuse them.
+ */
+class ExpectedValueBattleBehavior : public IBattleBehavior
+{
+public:
+    /**
+     * @brief Choose the skill with the highest expected value
+     *
+     * @param self character whose turn it is
+     * @param selfProfile battle profile of the character
+     * @param opponent opposing character
+     * @param opponentProfile battle profile of the opposing character
+     * @return const Battle::Skill& chosen skill
+     */
+    virtual const Battle::Skill& ChooseSkill(const Character& self,
+                                             const Battle::BattleProfile& selfProfile,
+                                             const Character& opponent,
+                                             const Battle::BattleProfile& opponentProfile) override;
+
+private:
+    /**
+     * @brief Number of choices kept before the cache is cleared
+     */
+    constexpr static const size_t ChoiceCacheCapacity = 256;
+
+    /**
+     * @brief Stats, resistances and active effects of both sides, and the opponent's skill count
+     */
+    using StateKey = std::array<int, 31>;
+
+    /**
+     * @brief FNV-1a hash of a battle state
+     */
+    struct StateHash
+    {
+        size_t operator()(const StateKey& key) const;
+    };
+
+    std::unordered_map<StateKey, size_t, StateHash> m_ChoiceCache;
+    Battle::OutcomeCache m_OutcomeCache;
+};
+
+} /* namespace Entities::NPC::Behavior */
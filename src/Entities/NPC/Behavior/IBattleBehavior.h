@@ -0,0 +1,43 @@
+#pragma once
+
+namespace Battle
+{
+class BattleProfile;
+class Skill;
+} /* namespace Battle */
+
+namespace Entities
+{
+class Character;
+}
+
+namespace Entities::NPC::Behavior
+{
+
+/**
+ * @brief Interface for skill selection patterns in battle
+ */
+class IBattleBehavior
+{
+public:
+    /**
+     * @brief Destructor
+     */
+    virtual ~IBattleBehavior() = default;
+
+    /**
+     * @brief Choose the skill to use this turn
+     *
+     * @param self character whose turn it is
+     * @param selfProfile battle profile of the character
+     * @param opponent opposing character
+     * @param opponentProfile battle profile of the opposing character
+     * @return const Battle::Skill& chosen skill owned by the character
+     */
+    virtual const Battle::Skill& ChooseSkill(const Character& self,
+                                             const Battle::BattleProfile& selfProfile,
+                                             const Character& opponent,
+                                             const Battle::BattleProfile& opponentProfile) = 0;
+};
+
+} /* namespace Entities::NPC::Behavior */
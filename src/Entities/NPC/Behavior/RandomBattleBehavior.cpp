@@ -0,0 +1,17 @@
+#include "RandomBattleBehavior.h"
+#include "Character.h"
+#include "Misc/RNG.h"
+
+namespace Entities::NPC::Behavior
+{
+
+const Battle::Skill& RandomBattleBehavior::ChooseSkill(const Character& self,
+                                                       const Battle::BattleProfile& selfProfile,
+                                                       const Character& opponent,
+                                                       const Battle::BattleProfile& opponentProfile)
+{
+    auto& skills = self.GetSkills();
+    return *skills.at(RNG::RandomInt(skills.size()));
+}
+
+} /* namespace Entities::NPC::Behavior */
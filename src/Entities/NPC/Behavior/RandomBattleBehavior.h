@@ -0,0 +1,29 @@
+#pragma once
+
+#include "IBattleBehavior.h"
+
+namespace Entities::NPC::Behavior
+{
+
+/**
+ * @brief Uses a uniformly random skill every turn
+ */
+class RandomBattleBehavior : public IBattleBehavior
+{
+public:
+    /**
+     * @brief Choose a random skill out of the character's skills
+     *
+     * @param self character whose turn it is
+     * @param selfProfile battle profile of the character
+     * @param opponent opposing character
+     * @param opponentProfile battle profile of the opposing character
+     * @return const Battle::Skill& chosen skill
+     */
+    virtual const Battle::Skill& ChooseSkill(const Character& self,
+                                             const Battle::BattleProfile& selfProfile,
+                                             const Character& opponent,
+                                             const Battle::BattleProfile& opponentProfile) override;
+};
+
+} /* namespace Entities::NPC::Behavior */
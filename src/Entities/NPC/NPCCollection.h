@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Battle/SkillCollection.h"
+#include "Behavior/ExpectedValueBattleBehavior.h"
 #include "Character.h"
 #include "UI/ColorPairs.h"
 #include <cmath>
@@ -23,8 +24,10 @@ public:
     FadingSpirit(int level)
         : Character("Fading Spirit", "Apparition", 's' | COLOR_PAIR(UI::ColorPairs::BlackOnDefault) | A_BOLD, 4)
     {
-        m_Stats = CalculateBaseStatsForLevel(level);
+        m_Stats          = CalculateBaseStatsForLevel(level);
+        m_BattleBehavior = std::make_unique<NPC::Behavior::ExpectedValueBattleBehavior>();
         GrantSkill<Battle::SkillCollection::Wail>();
+        GrantSkill<Battle::SkillCollection::Brace>();
     }
 
     Stats CalculateBaseStatsForLevel(int level) const override
@@ -35,8 +35,12 @@ std::unique_ptr<Character> NPCGenerator::CreateRandomEnemy()
 std::unique_ptr<Character> NPCGenerator::CreateRandomEnemyAtLevel(int level)
 {
     NPCCollection::Type selectedType = World1EnemyTypes[RNG::RandomInt(World1EnemyTypes.size())];
+    return CreateEnemy(selectedType, level);
+}
 
-    switch (selectedType)
+std::unique_ptr<Character> NPCGenerator::CreateEnemy(NPCCollection::Type type, int level)
+{
+    switch (type)
     {
     case NPCCollection::Type::FadingSpirit:
         return std::unique_ptr<Character>(new NPCCollection::FadingSpirit(level));
@@ -47,4 +51,15 @@ std::unique_ptr<Character> NPCGenerator::CreateRandomEnemyAtLevel(int level)
     }
 }
 
+std::unique_ptr<Character> NPCGenerator::CreateEnemy(const std::string& name, int level)
+{
+    // CreateEnemy() returns null past the last type
+    for (int type = 0;; type++)
+    {
+        auto enemy = CreateEnemy(static_cast<NPCCollection::Type>(type), level);
+        if (enemy == nullptr || enemy->GetName() == name)
+            return enemy;
+    }
+}
+
 } /* namespace Entities::NPC */
\ No newline at end of file
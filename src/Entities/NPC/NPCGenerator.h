@@ -4,12 +4,18 @@
 #include "Player.h"
 #include "Worlds/WorldManager.h"
 #include <memory>
+#include <string>
 
 namespace Entities
 {
 class EntityManager;
 }
 
+namespace Entities::NPCCollection
+{
+enum class Type;
+}
+
 namespace Entities::NPC
 {
 
@@ -35,6 +41,24 @@ public:
      */
     std::unique_ptr<Character> CreateRandomEnemy();
 
+    /**
+     * @brief Create an enemy NPC of the given type and level
+     *
+     * @param type enemy type
+     * @param level enemy level
+     * @return std::unique_ptr<Character> new NPC
+     */
+    static std::unique_ptr<Character> CreateEnemy(NPCCollection::Type type, int level);
+
+    /**
+     * @brief Create an enemy NPC by the name of its type, e.g. to rebuild one from a battle record
+     *
+     * @param name enemy name
+     * @param level enemy level
+     * @return std::unique_ptr<Character> new NPC, null if no enemy type has the name
+     */
+    static std::unique_ptr<Character> CreateEnemy(const std::string& name, int level);
+
 private:
     EntityManager& m_EntityManager;
     const Player& m_Player;
@@ -73,6 +73,18 @@ void Player::SetMana(int value)
     m_Stats.Mana = value;
 }
 
+void Player::SetLevel(int level)
+{
+    if (level < 1 || level > Entities::LevelCap)
+    {
+        throw InvalidArgumentException("Player::SetLevel() failed - level " + std::to_string(level) + " out of range");
+    }
+
+    m_Stats       = CalculateBaseStatsForLevel(level);
+    m_XP          = 0;
+    m_XPToLevelUp = level == Entities::LevelCap ? 0 : CalculateXPToNextLevel(level);
+}
+
 bool Player::GrantXP(int howMuch)
 {
     if (m_Stats.Level == Entities::LevelCap)
@@ -68,6 +68,14 @@ public:
      */
     void SetMana(int value);
 
+    /**
+     * @brief Set the player level directly, resetting stats and XP progress, e.g. for simulations
+     *
+     * @param level level in range [1, LevelCap]
+     * @throw InvalidArgumentException if the level is out of range
+     */
+    void SetLevel(int level);
+
     /**
      * @brief Grant the player a set amount of XP
      *
@@ -53,4 +53,22 @@ class NotSupportedException : public CustomException
 {
 public:
     NotSupportedException(const std::string& message) : CustomException(message) {}
-};
\ No newline at end of file
+};
+
+/**
+ * @brief Thrown when the command line arguments are invalid
+ */
+class InvalidArgumentException : public CustomException
+{
+public:
+    InvalidArgumentException(const std::string& message) : CustomException(message) {}
+};
+
+/**
+ * @brief Thrown when a replayed session runs out of recorded input
+ */
+class ReplayFinishedException : public CustomException
+{
+public:
+    ReplayFinishedException(const std::string& message) : CustomException(message) {}
+};
@@ -0,0 +1,97 @@
+#include "Histogram.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+Histogram::Histogram()
+{
+    Reset();
+}
+
+void Histogram::Record(uint64_t value)
+{
+    m_Buckets[BucketIndex(value)]++;
+    m_Count++;
+    m_Sum += value;
+    m_Min = std::min(m_Min, value);
+    m_Max = std::max(m_Max, value);
+}
+
+void Histogram::Reset()
+{
+    m_Buckets.fill(0);
+    m_Count = 0;
+    m_Sum   = 0;
+    m_Min   = std::numeric_limits<uint64_t>::max();
+    m_Max   = 0;
+}
+
+uint64_t Histogram::Count() const
+{
+    return m_Count;
+}
+
+uint64_t Histogram::Sum() const
+{
+    return m_Sum;
+}
+
+uint64_t Histogram::Min() const
+{
+    return m_Count > 0 ? m_Min : 0;
+}
+
+uint64_t Histogram::Max() const
+{
+    return m_Max;
+}
+
+uint64_t Histogram::Percentile(double fraction) const
+{
+    if (m_Count == 0)
+    {
+        return 0;
+    }
+
+    fraction        = std::clamp(fraction, 0.0, 1.0);
+    uint64_t target = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(fraction * m_Count)));
+    uint64_t seen   = 0;
+    for (int i = 0; i < BucketCount; i++)
+    {
+        seen += m_Buckets[i];
+        if (seen >= target)
+        {
+            return std::clamp(BucketUpperBound(i), Min(), m_Max);
+        }
+    }
+
+    return m_Max;
+}
+
+int Histogram::BucketIndex(uint64_t value)
+{
+    // Values below SubBucketCount map directly, everything above is grouped
+    // by its highest set bit and then by the next SubBucketBits bits
+    if (value < SubBucketCount)
+    {
+        return static_cast<int>(value);
+    }
+
+    int highestBit = 63 - __builtin_clzll(value);
+    int shift      = highestBit - SubBucketBits;
+    int subBucket  = static_cast<int>((value >> shift) & (SubBucketCount - 1));
+    return (shift + 1) * SubBucketCount + subBucket;
+}
+
+uint64_t Histogram::BucketUpperBound(int index)
+{
+    if (index < SubBucketCount)
+    {
+        return static_cast<uint64_t>(index);
+    }
+
+    int shift          = index / SubBucketCount - 1;
+    uint64_t subBucket = static_cast<uint64_t>(index % SubBucketCount);
+    uint64_t lower     = (static_cast<uint64_t>(SubBucketCount) | subBucket) << shift;
+    return lower + ((uint64_t(1) << shift) - 1);
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+/**
+ * @brief Log-bucketed histogram of non-negative integer samples
+ * Every power-of-two range is split into a fixed number of linear sub-buckets,
+ * so percentiles are accurate to within 1/SubBucketCount of the true value
+ * while recording stays constant-time and allocation-free.
+ */
+class Histogram
+{
+public:
+    /**
+     * @brief Number of linear sub-buckets per power of two
+     */
+    constexpr static const int SubBucketCount = 16;
+
+    /**
+     * @brief Constructor
+     */
+    Histogram();
+
+    /**
+     * @brief Record a sample
+     * 
+     * @param value sample value
+     */
+    void Record(uint64_t value);
+
+    /**
+     * @brief Remove all samples
+     */
+    void Reset();
+
+    /**
+     * @brief Get the number of samples recorded
+     * 
+     * @return uint64_t sample count
+     */
+    uint64_t Count() const;
+
+    /**
+     * @brief Get the sum of all samples recorded
+     * 
+     * @return uint64_t sample sum
+     */
+    uint64_t Sum() const;
+
+    /**
+     * @brief Get the smallest sample recorded
+     * 
+     * @return uint64_t smallest sample, 0 if empty
+     */
+    uint64_t Min() const;
+
+    /**
+     * @brief Get the largest sample recorded
+     * 
+     * @return uint64_t largest sample, 0 if empty
+     */
+    uint64_t Max() const;
+
+    /**
+     * @brief Get the value below which the given fraction of samples falls
+     * The result is the upper bound of the bucket containing the percentile,
+     * clamped to the recorded minimum and maximum.
+     * 
+     * @param fraction fraction in range [0, 1], e.g. 0.99 for p99
+     * @return uint64_t percentile value, 0 if empty
+     */
+    uint64_t Percentile(double fraction) const;
+
+private:
+    constexpr static const int SubBucketBits = 4;
+    constexpr static const int BucketCount   = (64 - SubBucketBits + 1) * SubBucketCount;
+
+    std::array<uint64_t, BucketCount> m_Buckets;
+    uint64_t m_Count;
+    uint64_t m_Sum;
+    uint64_t m_Min;
+    uint64_t m_Max;
+
+    /**
+     * @brief Get the index of the bucket the value falls into
+     * 
+     * @param value value
+     * @return int bucket index
+     */
+    static int BucketIndex(uint64_t value);
+
+    /**
+     * @brief Get the largest value that falls into the bucket with the given index
+     * 
+     * @param index bucket index
+     * @return uint64_t bucket upper bound
+     */
+    static uint64_t BucketUpperBound(int index);
+};
@@ -0,0 +1,187 @@
+#pragma once
+
+#include "Exceptions.h"
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief Vector with a fixed capacity whose elements are stored inside the object itself
+ * Never allocates, so it suits small per-turn collections which are created and modified often.
+ *
+ * @tparam T element type
+ * @tparam Capacity maximum number of elements
+ */
+template <typename T, size_t Capacity>
+class InlineVector
+{
+public:
+    /**
+     * @brief Constructor
+     */
+    InlineVector() : m_Size(0) {}
+
+    /**
+     * @brief Copy constructor
+     *
+     * @param other vector to copy
+     */
+    InlineVector(const InlineVector& other) : m_Size(0)
+    {
+        for (const auto& element : other)
+            EmplaceBack(element);
+    }
+
+    /**
+     * @brief Copy assignment
+     *
+     * @param other vector to copy
+     * @return InlineVector& this
+     */
+    InlineVector& operator=(const InlineVector& other)
+    {
+        if (this != &other)
+        {
+            Clear();
+            for (const auto& element : other)
+                EmplaceBack(element);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Move constructor
+     * Moves the elements one by one, since they live inside the object; the moved-from vector keeps its size.
+     *
+     * @param other vector to move from
+     */
+    InlineVector(InlineVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>) : m_Size(0)
+    {
+        for (auto& element : other)
+        {
+            new (Slot(m_Size)) T(std::move(element));
+            m_Size++;
+        }
+    }
+
+    /**
+     * @brief Move assignment
+     *
+     * @param other vector to move from
+     * @return InlineVector& this
+     */
+    InlineVector& operator=(InlineVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+    {
+        if (this != &other)
+        {
+            Clear();
+            for (auto& element : other)
+            {
+                new (Slot(m_Size)) T(std::move(element));
+                m_Size++;
+            }
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Destructor
+     */
+    ~InlineVector() { Clear(); }
+
+    /**
+     * @brief Construct a new element at the end
+     *
+     * @param args constructor arguments
+     * @return T& new element
+     * @throw CustomException if the vector is full
+     */
+    template <typename... Args>
+    T& EmplaceBack(Args&&... args)
+    {
+        if (m_Size == Capacity)
+        {
+            throw CustomException("InlineVector::EmplaceBack() failed - capacity exceeded");
+        }
+        T* element = new (Slot(m_Size)) T(std::forward<Args>(args)...);
+        m_Size++;
+        return *element;
+    }
+
+    /**
+     * @brief Remove all elements satisfying the predicate, keeping the order of the rest
+     *
+     * @param predicate predicate
+     */
+    template <typename Predicate>
+    void RemoveIf(Predicate predicate)
+    {
+        size_t kept = 0;
+        for (size_t i = 0; i < m_Size; i++)
+        {
+            if (predicate((*this)[i]))
+                continue;
+            if (kept != i)
+                (*this)[kept] = std::move((*this)[i]);
+            kept++;
+        }
+        while (m_Size > kept)
+        {
+            (*this)[--m_Size].~T();
+        }
+    }
+
+    /**
+     * @brief Remove all elements
+     */
+    void Clear()
+    {
+        while (m_Size > 0)
+        {
+            (*this)[--m_Size].~T();
+        }
+    }
+
+    /**
+     * @brief Access an element
+     *
+     * @param index index
+     * @return T& element
+     */
+    T& operator[](size_t index) { return *std::launder(reinterpret_cast<T*>(Slot(index))); }
+
+    /**
+     * @brief Access an element
+     *
+     * @param index index
+     * @return const T& element
+     */
+    const T& operator[](size_t index) const { return *std::launder(reinterpret_cast<const T*>(Slot(index))); }
+
+    T* begin() { return &(*this)[0]; }
+    T* end() { return &(*this)[0] + m_Size; }
+    const T* begin() const { return &(*this)[0]; }
+    const T* end() const { return &(*this)[0] + m_Size; }
+
+    /**
+     * @brief Get the number of elements
+     *
+     * @return size_t size
+     */
+    size_t Size() const { return m_Size; }
+
+    /**
+     * @brief Check whether there are no elements
+     *
+     * @return true if empty
+     */
+    bool Empty() const { return m_Size == 0; }
+
+private:
+    alignas(T) unsigned char m_Storage[sizeof(T) * Capacity];
+    size_t m_Size;
+
+    void* Slot(size_t index) { return m_Storage + index * sizeof(T); }
+    const void* Slot(size_t index) const { return m_Storage + index * sizeof(T); }
+};
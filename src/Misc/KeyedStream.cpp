@@ -0,0 +1,64 @@
+#include "KeyedStream.h"
+
+namespace RNG
+{
+
+KeyedStream::KeyedStream(uint64_t seed, const StreamKey& key)
+    : m_Key { static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32) },
+      m_Counter { 0,
+                  key.Tick,
+                  key.Entity,
+                  static_cast<uint32_t>(key.World) << 16 | static_cast<uint32_t>(static_cast<uint8_t>(key.Room.Y)) << 8
+                      | static_cast<uint8_t>(key.Room.X) },
+      m_Block {},
+      m_Used(m_Block.size())
+{
+}
+
+int KeyedStream::RandomInt(int high)
+{
+    return RandomInt(0, high);
+}
+
+int KeyedStream::RandomInt(int low, int high)
+{
+    // Lemire's nearly divisionless method, as in RNG::RandomInt
+    uint32_t range = static_cast<uint32_t>(high) - static_cast<uint32_t>(low);
+    if (range == 0)
+    {
+        return low;
+    }
+
+    uint64_t product = static_cast<uint64_t>(Next()) * range;
+    if (static_cast<uint32_t>(product) < range)
+    {
+        uint32_t threshold = -range % range;
+        while (static_cast<uint32_t>(product) < threshold)
+        {
+            product = static_cast<uint64_t>(Next()) * range;
+        }
+    }
+    return static_cast<int>(static_cast<uint32_t>(low) + static_cast<uint32_t>(product >> 32));
+}
+
+double KeyedStream::RandomDouble()
+{
+    uint64_t bits = static_cast<uint64_t>(Next()) << 32 | Next();
+    return static_cast<double>(bits >> 11) * 0x1.0p-53;
+}
+
+bool KeyedStream::Chance(double threshold)
+{
+    if (threshold >= 1.)
+    {
+        return true;
+    }
+    else if (threshold <= 0.)
+    {
+        return false;
+    }
+
+    return RandomDouble() < threshold;
+}
+
+} /* namespace RNG */
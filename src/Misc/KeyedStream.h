@@ -0,0 +1,95 @@
+#pragma once
+
+#include "Coords.h"
+#include "Philox.h"
+#include <cstdint>
+
+namespace RNG
+{
+
+/**
+ * @brief Identifies what a keyed stream of random numbers is used for
+ * Fields that do not apply stay 0. Room coordinates must fit in 8 bits each and the world number in 16 bits,
+ * which covers the whole world grid.
+ */
+struct StreamKey
+{
+    int World       = 0;
+    Coords Room     = Coords(0, 0);
+    uint32_t Entity = 0;
+    uint32_t Tick   = 0;
+};
+
+/**
+ * @brief Sequence of random numbers which is a pure function of a game seed and a stream key
+ * Draws come from Philox4x32 with the seed as the key and the stream key and draw index packed into the counter,
+ * so the same seed and stream key always produce the same values, no matter which thread draws them or what was
+ * drawn elsewhere before. Draws do not pass through the thread's tape.
+ */
+class KeyedStream
+{
+public:
+    /**
+     * @brief Constructor
+     *
+     * @param seed game seed
+     * @param key stream key
+     */
+    KeyedStream(uint64_t seed, const StreamKey& key);
+
+    /**
+     * @brief Draw the next 32 random bits
+     *
+     * @return uint32_t random bits
+     */
+    inline uint32_t Next()
+    {
+        if (m_Used == m_Block.size())
+        {
+            m_Block = Philox4x32::Block(m_Counter, m_Key);
+            m_Counter[0]++;
+            m_Used = 0;
+        }
+        return m_Block[m_Used++];
+    }
+
+    /**
+     * @brief Get a random int in range [0, high)
+     *
+     * @param high upper bound
+     * @return int random int
+     */
+    int RandomInt(int high);
+
+    /**
+     * @brief Get a random int in range [low, high)
+     *
+     * @param low lower bound
+     * @param high upper bound
+     * @return int random int, low if the range is empty
+     */
+    int RandomInt(int low, int high);
+
+    /**
+     * @brief Get a random double in range [0, 1)
+     *
+     * @return double random double
+     */
+    double RandomDouble();
+
+    /**
+     * @brief Decide whether the given chance shall be satisfied
+     *
+     * @param threshold chance
+     * @return true if satisfied
+     */
+    bool Chance(double threshold);
+
+private:
+    Philox4x32::Key m_Key;
+    Philox4x32::Counter m_Counter;
+    Philox4x32::Counter m_Block;
+    size_t m_Used;
+};
+
+} /* namespace RNG */
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+namespace RNG
+{
+
+/**
+ * @brief Philox4x32-10 counter-based generator by Salmon et al.
+ * Every output block is a pure function of a 128-bit counter and a 64-bit key, so any block can be computed
+ * directly, in any order and on any thread, without carrying state from previous draws.
+ */
+class Philox4x32
+{
+public:
+    using Counter = std::array<uint32_t, 4>;
+    using Key     = std::array<uint32_t, 2>;
+
+    /**
+     * @brief Number of rounds
+     */
+    constexpr static const int Rounds = 10;
+
+    /**
+     * @brief Compute the block of random bits for a counter
+     *
+     * @param counter counter
+     * @param key key
+     * @return Counter four random words
+     */
+    static inline Counter Block(Counter counter, Key key)
+    {
+        for (int round = 0; round < Rounds; round++)
+        {
+            if (round > 0)
+            {
+                key[0] += 0x9E3779B9u;
+                key[1] += 0xBB67AE85u;
+            }
+            uint64_t product0 = static_cast<uint64_t>(0xD2511F53u) * counter[0];
+            uint64_t product1 = static_cast<uint64_t>(0xCD9E8D57u) * counter[2];
+            counter = { static_cast<uint32_t>(product1 >> 32) ^ counter[1] ^ key[0],
+                        static_cast<uint32_t>(product1),
+                        static_cast<uint32_t>(product0 >> 32) ^ counter[3] ^ key[1],
+                        static_cast<uint32_t>(product0) };
+        }
+        return counter;
+    }
+};
+
+} /* namespace RNG */
@@ -0,0 +1,75 @@
+#include "Profiler.h"
+#include <fstream>
+#include <iomanip>
+#include <list>
+
+namespace Profiler
+{
+
+/**
+ * @brief Get the storage of all sections
+ * A list is used so that references handed out never get invalidated.
+ * 
+ * @return std::list<Section>& sections
+ */
+static std::list<Section>& Sections()
+{
+    static std::list<Section> sections;
+    return sections;
+}
+
+Section& GetSection(const std::string& name)
+{
+    for (auto& section : Sections())
+    {
+        if (section.Name == name)
+        {
+            return section;
+        }
+    }
+    Sections().push_back({ name, Histogram() });
+    return Sections().back();
+}
+
+void Dump(std::ostream& os)
+{
+    auto toMicroseconds = [](uint64_t ns) { return ns / 1000.0; };
+
+    os << "# Dun-geon subsystem timings (us)\n";
+    if (!IsEnabled())
+    {
+        os << "# Profiling is disabled in this build, rebuild with `make PROFILE=1` to enable it.\n";
+    }
+    os << std::left << std::setw(32) << "subsystem" << std::right << std::setw(10) << "count" << std::setw(12)
+       << "p50" << std::setw(12) << "p99" << std::setw(12) << "max" << std::setw(14) << "total" << '\n';
+    os << std::fixed << std::setprecision(1);
+    for (const auto& section : Sections())
+    {
+        const auto& hist = section.Durations;
+        os << std::left << std::setw(32) << section.Name << std::right << std::setw(10) << hist.Count()
+           << std::setw(12) << toMicroseconds(hist.Percentile(0.5)) << std::setw(12)
+           << toMicroseconds(hist.Percentile(0.99)) << std::setw(12) << toMicroseconds(hist.Max()) << std::setw(14)
+           << toMicroseconds(hist.Sum()) << '\n';
+    }
+}
+
+bool DumpToFile(const std::string& filename)
+{
+    std::ofstream file(filename);
+    if (!file.good())
+    {
+        return false;
+    }
+    Dump(file);
+    return file.good();
+}
+
+void Reset()
+{
+    for (auto& section : Sections())
+    {
+        section.Durations.Reset();
+    }
+}
+
+} /* namespace Profiler */
@@ -0,0 +1,125 @@
+#pragma once
+
+#include "Histogram.h"
+#include <chrono>
+#include <iostream>
+#include <string>
+
+/**
+ * @brief Scoped subsystem timers
+ * The PROFILE_SCOPE macro only does anything when the game is built with DUNGEON_PROFILING
+ * defined (`make PROFILE=1`), otherwise it expands to nothing and has no overhead.
+ */
+namespace Profiler
+{
+
+/**
+ * @brief File the report is written to on exit and on demand
+ */
+static const std::string ReportFilename = "data/profile.txt";
+
+/**
+ * @brief Timing data of a single named subsystem
+ */
+struct Section
+{
+    /**
+     * @brief Subsystem name
+     */
+    std::string Name;
+
+    /**
+     * @brief Durations in nanoseconds
+     */
+    Histogram Durations;
+};
+
+/**
+ * @brief Timer recording its lifetime into a section on destruction
+ */
+class ScopedTimer
+{
+public:
+    /**
+     * @brief Constructor
+     * 
+     * @param section section to record into
+     */
+    explicit ScopedTimer(Section& section) : m_Section(section), m_Start(std::chrono::steady_clock::now())
+    {
+    }
+
+    /**
+     * @brief Destructor
+     */
+    ~ScopedTimer()
+    {
+        auto elapsed = std::chrono::steady_clock::now() - m_Start;
+        m_Section.Durations.Record(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+    Section& m_Section;
+    std::chrono::steady_clock::time_point m_Start;
+};
+
+/**
+ * @brief Check whether the profiling instrumentation was compiled in
+ * 
+ * @return true if enabled
+ */
+constexpr bool IsEnabled()
+{
+#ifdef DUNGEON_PROFILING
+    return true;
+#else
+    return false;
+#endif
+}
+
+/**
+ * @brief Get the section with the given name, creating it if it does not exist yet
+ * References stay valid for the lifetime of the program.
+ * 
+ * @param name subsystem name
+ * @return Section& section
+ */
+Section& GetSection(const std::string& name);
+
+/**
+ * @brief Write a report of all sections into the given stream
+ * 
+ * @param os output stream
+ */
+void Dump(std::ostream& os);
+
+/**
+ * @brief Write a report of all sections into the file with the given name
+ * 
+ * @param filename filename
+ * @return true if written successfully
+ */
+bool DumpToFile(const std::string& filename);
+
+/**
+ * @brief Remove all recorded samples
+ */
+void Reset();
+
+} /* namespace Profiler */
+
+#ifdef DUNGEON_PROFILING
+#define PROFILE_CONCAT_IMPL(a, b) a##b
+#define PROFILE_CONCAT(a, b)      PROFILE_CONCAT_IMPL(a, b)
+/**
+ * @brief Time the rest of the enclosing scope under the given subsystem name
+ */
+#define PROFILE_SCOPE(name)                                                                                 \
+    static Profiler::Section& PROFILE_CONCAT(profilerSection, __LINE__) = Profiler::GetSection(name);      \
+    Profiler::ScopedTimer PROFILE_CONCAT(profilerTimer, __LINE__)(PROFILE_CONCAT(profilerSection, __LINE__))
+#else
+#define PROFILE_SCOPE(name)
+#endif
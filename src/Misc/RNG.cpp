@@ -1,41 +1,124 @@
 #include "RNG.h"
+#include "Xoshiro256x4.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <mutex>
 #include <random>
 
 namespace RNG
 {
 
 /**
- * @brief Used to seed the MT
+ * @brief Draw a seed from the random device, which is shared between threads
+ *
+ * @return uint64_t seed
  */
-static std::random_device rd;
+static uint64_t DeviceSeed()
+{
+    static std::random_device rd;
+    static std::mutex mutex;
+    std::lock_guard<std::mutex> lock(mutex);
+    return static_cast<uint64_t>(rd()) << 32 | rd();
+}
+
+/**
+ * @brief Calling thread's generator
+ */
+static thread_local Engine engine(DeviceSeed());
+
+/**
+ * @brief Calling thread's generator for bulk draws
+ */
+static thread_local Xoshiro256x4 bulkEngine(DeviceSeed());
+
+/**
+ * @brief Raw bits drawn by a bulk generator per step of a fill
+ */
+constexpr static const size_t BulkBlock = 256;
+
+/**
+ * @brief Tape attached to the calling thread
+ */
+static thread_local Tape* tape = nullptr;
+
+/**
+ * @brief Draw a uniform value in [0, range) with Lemire's nearly divisionless method
+ * The upper 32 bits of a draw are scaled by multiplication; only draws landing in the biased low part of a
+ * product need the modulo to decide whether to retry.
+ *
+ * @param range range size, at least 1
+ * @return uint32_t value
+ */
+static inline uint32_t Bounded(uint32_t range)
+{
+    uint64_t product = (engine() >> 32) * range;
+    uint32_t low     = static_cast<uint32_t>(product);
+    if (low < range)
+    {
+        uint32_t threshold = -range % range;
+        while (low < threshold)
+        {
+            product = (engine() >> 32) * range;
+            low     = static_cast<uint32_t>(product);
+        }
+    }
+    return static_cast<uint32_t>(product >> 32);
+}
 
 /**
- * @brief The PRNG
+ * @brief Draw a uniform double in [0, 1) from the upper 53 bits of a draw
+ *
+ * @return double value
  */
-static std::mt19937 mt(rd());
+static inline double Unit()
+{
+    return static_cast<double>(engine() >> 11) * 0x1.0p-53;
+}
+
+Engine& ThreadEngine()
+{
+    return engine;
+}
+
+void SetTape(Tape* newTape)
+{
+    tape = newTape;
+}
+
+Tape* GetTape()
+{
+    return tape;
+}
+
+void Seed(uint64_t seed)
+{
+    engine.Seed(seed);
+    bulkEngine.Seed(seed);
+}
 
 int RandomInt(int high)
 {
-    std::uniform_int_distribution<int> dist(0, high - 1);
-    return dist(mt);
+    return RandomInt(0, high);
 }
 
 int RandomInt(int low, int high)
 {
-    std::uniform_int_distribution<int> dist(low, high - 1);
-    return dist(mt);
+    uint32_t range = static_cast<uint32_t>(high) - static_cast<uint32_t>(low);
+    int value      = range == 0 ? low : static_cast<int>(static_cast<uint32_t>(low) + Bounded(range));
+    return tape ? tape->TapeInt(value, low, high) : value;
 }
 
 double RandomDouble()
 {
-    static std::uniform_real_distribution<double> dist;
-    return dist(mt);
+    double value = Unit();
+    return tape ? tape->TapeDouble(value) : value;
 }
 
 double RandomDouble(double low, double high)
 {
-    std::uniform_real_distribution<double> dist(low, high);
-    return dist(mt);
+    double value = low + (high - low) * Unit();
+    return tape ? tape->TapeDouble(value) : value;
 }
 
 bool Chance(double threshold)
@@ -52,4 +135,71 @@ bool Chance(double threshold)
     return RandomDouble() < threshold;
 }
 
-} /* namespace RNG */
\ No newline at end of file
+void FillRandomInt(int* out, size_t count, int low, int high)
+{
+    uint32_t range = static_cast<uint32_t>(high) - static_cast<uint32_t>(low);
+    if (tape || range == 0)
+    {
+        for (size_t i = 0; i < count; i++)
+            out[i] = RandomInt(low, high);
+        return;
+    }
+
+    // Lemire's method on both 32-bit halves of every draw, with the rejection threshold computed once
+    alignas(32) uint64_t bits[BulkBlock];
+    uint32_t threshold = -range % range;
+    size_t filled      = 0;
+    while (filled < count)
+    {
+        bulkEngine.Fill(bits, BulkBlock);
+        for (size_t i = 0; i < 2 * BulkBlock && filled < count; i++)
+        {
+            uint64_t product = static_cast<uint32_t>(bits[i / 2] >> (i % 2 * 32)) * static_cast<uint64_t>(range);
+            // Branchless: the slot is overwritten by the next value if this one is rejected
+            out[filled] = static_cast<int>(static_cast<uint32_t>(low) + static_cast<uint32_t>(product >> 32));
+            filled += static_cast<uint32_t>(product) >= threshold;
+        }
+    }
+}
+
+void FillRandomDouble(double* out, size_t count)
+{
+    if (tape)
+    {
+        for (size_t i = 0; i < count; i++)
+            out[i] = RandomDouble();
+        return;
+    }
+
+    alignas(32) uint64_t bits[BulkBlock];
+    for (size_t filled = 0; filled < count; filled += BulkBlock)
+    {
+        size_t size = std::min(BulkBlock, count - filled);
+        bulkEngine.Fill(bits, BulkBlock);
+        for (size_t i = 0; i < size; i++)
+            out[filled + i] = static_cast<double>(static_cast<int64_t>(bits[i] >> 11)) * 0x1.0p-53;
+    }
+}
+
+void FillChance(uint8_t* out, size_t count, double threshold)
+{
+    if (tape || threshold >= 1. || threshold <= 0.)
+    {
+        for (size_t i = 0; i < count; i++)
+            out[i] = Chance(threshold);
+        return;
+    }
+
+    // Same outcome as comparing the 53-bit double to the threshold, without converting
+    uint64_t limit = static_cast<uint64_t>(std::ceil(threshold * 0x1.0p53));
+    alignas(32) uint64_t bits[BulkBlock];
+    for (size_t filled = 0; filled < count; filled += BulkBlock)
+    {
+        size_t size = std::min(BulkBlock, count - filled);
+        bulkEngine.Fill(bits, BulkBlock);
+        for (size_t i = 0; i < size; i++)
+            out[filled + i] = (bits[i] >> 11) < limit;
+    }
+}
+
+} /* namespace RNG */
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief Fixed-capacity circular buffer which overwrites its oldest element once full
+ * All storage is allocated up front. Overwritten slots keep their previous value so that
+ * elements owning buffers (e.g. strings) can reuse them.
+ * 
+ * @tparam T element type
+ */
+template <typename T>
+class RingBuffer
+{
+public:
+    /**
+     * @brief Constructor
+     * 
+     * @param capacity maximum number of elements, must be positive
+     */
+    explicit RingBuffer(size_t capacity) : m_Data(capacity), m_Head(0), m_Size(0) {}
+
+    /**
+     * @brief Append a new newest element, evicting the oldest one if the buffer is full
+     * 
+     * @return T& slot of the new element, still holding whatever value was evicted from it
+     */
+    T& PushBack()
+    {
+        size_t index = (m_Head + m_Size) % m_Data.size();
+        if (m_Size < m_Data.size())
+            m_Size++;
+        else
+            m_Head = (m_Head + 1) % m_Data.size();
+        return m_Data[index];
+    }
+
+    /**
+     * @brief Remove all elements
+     */
+    void Clear()
+    {
+        m_Head = 0;
+        m_Size = 0;
+    }
+
+    /**
+     * @brief Access an element
+     * 
+     * @param index index, 0 being the oldest element
+     * @return const T& element
+     */
+    const T& operator[](size_t index) const { return m_Data[(m_Head + index) % m_Data.size()]; }
+
+    /**
+     * @brief Get the number of elements
+     * 
+     * @return size_t size
+     */
+    size_t Size() const { return m_Size; }
+
+    /**
+     * @brief Get the maximum number of elements
+     * 
+     * @return size_t capacity
+     */
+    size_t Capacity() const { return m_Data.size(); }
+
+private:
+    std::vector<T> m_Data;
+    size_t m_Head;
+    size_t m_Size;
+};
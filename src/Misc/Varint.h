@@ -0,0 +1,115 @@
+#pragma once
+
+#include "Exceptions.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief LEB128 variable-length integer encoding
+ * Every byte carries 7 bits of the value, least significant group first, with the high bit set on all but the
+ * last byte. Signed values are zigzag-mapped first so that small negative numbers stay short as well.
+ */
+namespace Varint
+{
+
+/**
+ * @brief Append an unsigned value
+ *
+ * @param out output buffer
+ * @param value value
+ */
+inline void Write(std::vector<uint8_t>& out, uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        out.push_back(static_cast<uint8_t>(value) | 0x80);
+        value >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(value));
+}
+
+/**
+ * @brief Append a signed value
+ *
+ * @param out output buffer
+ * @param value value
+ */
+inline void WriteSigned(std::vector<uint8_t>& out, int64_t value)
+{
+    Write(out, (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+}
+
+/**
+ * @brief Sequential reader of an encoded buffer
+ */
+class Reader
+{
+public:
+    /**
+     * @brief Constructor
+     *
+     * @param data encoded data, must outlive the reader
+     * @param size data size in bytes
+     */
+    Reader(const uint8_t* data, size_t size) : m_Data(data), m_Size(size), m_Position(0) {}
+
+    /**
+     * @brief Read an unsigned value
+     *
+     * @return uint64_t value
+     * @throw InvalidArgumentException if the data ends in the middle of the value or the value is too long
+     */
+    uint64_t Read()
+    {
+        uint64_t value = 0;
+        for (int shift = 0; shift < 64; shift += 7)
+        {
+            uint8_t byte = ReadByte();
+            value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+            if ((byte & 0x80) == 0)
+                return value;
+        }
+        throw InvalidArgumentException("Varint::Reader::Read() failed - value too long");
+    }
+
+    /**
+     * @brief Read a signed value
+     *
+     * @return int64_t value
+     */
+    int64_t ReadSigned()
+    {
+        uint64_t value = Read();
+        return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+    }
+
+    /**
+     * @brief Read a single raw byte
+     *
+     * @return uint8_t byte
+     * @throw InvalidArgumentException at the end of the data
+     */
+    uint8_t ReadByte()
+    {
+        if (m_Position >= m_Size)
+        {
+            throw InvalidArgumentException("Varint::Reader::ReadByte() failed - unexpected end of data");
+        }
+        return m_Data[m_Position++];
+    }
+
+    /**
+     * @brief Check whether all data has been read
+     *
+     * @return true if at the end
+     */
+    bool AtEnd() const { return m_Position >= m_Size; }
+
+private:
+    const uint8_t* m_Data;
+    size_t m_Size;
+    size_t m_Position;
+};
+
+} /* namespace Varint */
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+
+namespace RNG
+{
+
+/**
+ * @brief xoshiro256** pseudorandom generator by Blackman and Vigna
+ * 32 bytes of state and a handful of shifts, rotations and multiplications per 64-bit output, with a period of
+ * 2^256 - 1. Meets the UniformRandomBitGenerator requirements, so it also works with the standard distributions.
+ */
+class Xoshiro256
+{
+public:
+    using result_type = uint64_t;
+
+    /**
+     * @brief Constructor
+     *
+     * @param seed seed, expanded into the full state with SplitMix64
+     */
+    explicit Xoshiro256(uint64_t seed = 0) { Seed(seed); }
+
+    /**
+     * @brief Reseed
+     *
+     * @param seed seed, expanded into the full state with SplitMix64
+     */
+    void Seed(uint64_t seed)
+    {
+        for (auto& word : m_State)
+        {
+            seed += 0x9E3779B97F4A7C15ull;
+            uint64_t z = seed;
+            z          = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z          = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            word       = z ^ (z >> 31);
+        }
+    }
+
+    /**
+     * @brief Draw the next 64 random bits
+     *
+     * @return uint64_t random bits
+     */
+    inline uint64_t operator()()
+    {
+        uint64_t result = Rotl(m_State[1] * 5, 7) * 9;
+        uint64_t t      = m_State[1] << 17;
+
+        m_State[2] ^= m_State[0];
+        m_State[3] ^= m_State[1];
+        m_State[1] ^= m_State[2];
+        m_State[0] ^= m_State[3];
+        m_State[2] ^= t;
+        m_State[3] = Rotl(m_State[3], 45);
+
+        return result;
+    }
+
+    /**
+     * @brief Advance the state by 2^128 draws, which gives up to 2^128 non-overlapping streams
+     */
+    void Jump()
+    {
+        constexpr uint64_t Polynomial[] = { 0x180EC6D33CFD0ABAull,
+                                            0xD5A61266F0C9392Cull,
+                                            0xA9582618E03FC9AAull,
+                                            0x39ABDC4529B1661Cull };
+
+        uint64_t jumped[4] = { 0, 0, 0, 0 };
+        for (uint64_t word : Polynomial)
+        {
+            for (int bit = 0; bit < 64; bit++)
+            {
+                if (word & (1ull << bit))
+                {
+                    for (int i = 0; i < 4; i++)
+                        jumped[i] ^= m_State[i];
+                }
+                (*this)();
+            }
+        }
+        for (int i = 0; i < 4; i++)
+            m_State[i] = jumped[i];
+    }
+
+    static constexpr uint64_t min() { return 0; }
+    static constexpr uint64_t max() { return std::numeric_limits<uint64_t>::max(); }
+
+private:
+    friend class Xoshiro256x4;
+
+    uint64_t m_State[4];
+
+    static inline uint64_t Rotl(uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+};
+
+} /* namespace RNG */
@@ -0,0 +1,135 @@
+#include "Xoshiro256x4.h"
+#include "Exceptions.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define DUNGEON_XOSHIRO_X86
+#endif
+
+namespace RNG
+{
+
+/**
+ * @brief Step every lane once per iteration with plain loops
+ *
+ * @param state state words of every lane
+ * @param out output buffer
+ * @param count number of values, a multiple of Xoshiro256x4::Lanes
+ */
+static void FillPortable(uint64_t (&state)[4][Xoshiro256x4::Lanes], uint64_t* out, size_t count)
+{
+    constexpr size_t Lanes = Xoshiro256x4::Lanes;
+    for (size_t i = 0; i < count; i += Lanes)
+    {
+        for (size_t lane = 0; lane < Lanes; lane++)
+        {
+            uint64_t scaled = state[1][lane] * 5;
+            uint64_t result = (scaled << 7 | scaled >> 57) * 9;
+            uint64_t t      = state[1][lane] << 17;
+
+            state[2][lane] ^= state[0][lane];
+            state[3][lane] ^= state[1][lane];
+            state[1][lane] ^= state[2][lane];
+            state[0][lane] ^= state[3][lane];
+            state[2][lane] ^= t;
+            state[3][lane] = state[3][lane] << 45 | state[3][lane] >> 19;
+
+            out[i + lane] = result;
+        }
+    }
+}
+
+#ifdef DUNGEON_XOSHIRO_X86
+
+/**
+ * @brief Rotate every 64-bit element left
+ */
+#define ROTL_AVX2(x, k) _mm256_or_si256(_mm256_slli_epi64(x, k), _mm256_srli_epi64(x, 64 - (k)))
+
+/**
+ * @brief Step all four lanes at once in AVX2 registers
+ * AVX2 has no 64-bit multiplication, so the multiplications by 5 and 9 are done as shifts and additions.
+ *
+ * @param state state words of every lane
+ * @param out output buffer
+ * @param count number of values, a multiple of Xoshiro256x4::Lanes
+ */
+__attribute__((target("avx2"))) static void FillAVX2(uint64_t (&state)[4][Xoshiro256x4::Lanes],
+                                                     uint64_t* out,
+                                                     size_t count)
+{
+    __m256i s0 = _mm256_load_si256(reinterpret_cast<const __m256i*>(state[0]));
+    __m256i s1 = _mm256_load_si256(reinterpret_cast<const __m256i*>(state[1]));
+    __m256i s2 = _mm256_load_si256(reinterpret_cast<const __m256i*>(state[2]));
+    __m256i s3 = _mm256_load_si256(reinterpret_cast<const __m256i*>(state[3]));
+
+    for (size_t i = 0; i < count; i += Xoshiro256x4::Lanes)
+    {
+        __m256i scaled  = _mm256_add_epi64(_mm256_slli_epi64(s1, 2), s1);
+        __m256i rotated = ROTL_AVX2(scaled, 7);
+        __m256i result  = _mm256_add_epi64(_mm256_slli_epi64(rotated, 3), rotated);
+        __m256i t       = _mm256_slli_epi64(s1, 17);
+
+        s2 = _mm256_xor_si256(s2, s0);
+        s3 = _mm256_xor_si256(s3, s1);
+        s1 = _mm256_xor_si256(s1, s2);
+        s0 = _mm256_xor_si256(s0, s3);
+        s2 = _mm256_xor_si256(s2, t);
+        s3 = ROTL_AVX2(s3, 45);
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), result);
+    }
+
+    _mm256_store_si256(reinterpret_cast<__m256i*>(state[0]), s0);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(state[1]), s1);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(state[2]), s2);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(state[3]), s3);
+}
+
+#undef ROTL_AVX2
+
+#endif /* DUNGEON_XOSHIRO_X86 */
+
+void Xoshiro256x4::Seed(uint64_t seed)
+{
+    Xoshiro256 lane(seed);
+    for (size_t i = 0; i < Lanes; i++)
+    {
+        for (int word = 0; word < 4; word++)
+            m_State[word][i] = lane.m_State[word];
+        lane.Jump();
+    }
+}
+
+bool Xoshiro256x4::SupportsAVX2()
+{
+#ifdef DUNGEON_XOSHIRO_X86
+    static const bool supported = __builtin_cpu_supports("avx2");
+    return supported;
+#else
+    return false;
+#endif
+}
+
+void Xoshiro256x4::Fill(uint64_t* out, size_t count, bool useAVX2)
+{
+    if (count % Lanes != 0)
+    {
+        throw InvalidArgumentException("Xoshiro256x4::Fill() failed - count is not a multiple of the lane count");
+    }
+    if (useAVX2 && !SupportsAVX2())
+    {
+        throw InvalidArgumentException("Xoshiro256x4::Fill() failed - AVX2 not supported");
+    }
+
+#ifdef DUNGEON_XOSHIRO_X86
+    if (useAVX2)
+    {
+        FillAVX2(m_State, out, count);
+        return;
+    }
+#endif
+    FillPortable(m_State, out, count);
+}
+
+} /* namespace RNG */
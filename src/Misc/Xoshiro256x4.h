@@ -0,0 +1,62 @@
+#pragma once
+
+#include "Xoshiro256.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace RNG
+{
+
+/**
+ * @brief Four interleaved xoshiro256** generators stepped together
+ * The state is laid out word by word across the lanes, so one step is a handful of vector instructions. Lane i
+ * starts i jumps of 2^128 draws after the seed's stream, so the lanes never overlap. Output is the same on every
+ * CPU; AVX2 is used where available.
+ */
+class Xoshiro256x4
+{
+public:
+    /**
+     * @brief Number of lanes, every fill produces a multiple of it
+     */
+    constexpr static const size_t Lanes = 4;
+
+    /**
+     * @brief Constructor
+     *
+     * @param seed seed, expanded with SplitMix64 as in Xoshiro256
+     */
+    explicit Xoshiro256x4(uint64_t seed = 0) { Seed(seed); }
+
+    /**
+     * @brief Reseed
+     *
+     * @param seed seed, expanded with SplitMix64 as in Xoshiro256
+     */
+    void Seed(uint64_t seed);
+
+    /**
+     * @brief Check whether the CPU can run the AVX2 path
+     *
+     * @return true if supported
+     */
+    static bool SupportsAVX2();
+
+    /**
+     * @brief Draw random bits, lane by lane: out[k * Lanes + i] is the k-th draw of lane i
+     *
+     * @param out output buffer
+     * @param count number of values, a multiple of Lanes
+     * @param useAVX2 use the AVX2 path, at most what the CPU supports
+     * @throw InvalidArgumentException if count is not a multiple of Lanes or AVX2 is not supported
+     */
+    void Fill(uint64_t* out, size_t count, bool useAVX2 = SupportsAVX2());
+
+private:
+    /**
+     * @brief State words of every lane, m_State[word][lane]
+     */
+    alignas(32) uint64_t m_State[4][Lanes];
+};
+
+} /* namespace RNG */
@@ -8,6 +8,7 @@
 #include "Worlds/Field.h"
 #include "Worlds/WorldManager.h"
 #include <sstream>
+#include <vector>
 
 namespace Player
 {
@@ -19,7 +20,9 @@ Controller::Controller(Entities::EntityManager& entityManager,
     : m_EntityManager(entityManager),
       m_WorldManager(worldManager),
       m_PlayerEntity(playerEntity),
-      m_Screen(screen)
+      m_Screen(screen),
+      m_BattleCount(0),
+      m_VictoryCount(0)
 {
 }
 
@@ -72,17 +75,38 @@ bool Controller::TryFight(Direction dir)
     // TODO: try to remove the cast
     Entities::Character& targetedCharacter = dynamic_cast<Entities::Character&>(*approaching);
 
-    Battle::Battle battle(m_PlayerEntity, targetedCharacter);
+    // The targeted character leads, everything else fightable around the player joins in
+    std::vector<Entities::Character*> enemies { &targetedCharacter };
+    for (auto other : Direction::All)
+    {
+        auto neighbor = m_EntityManager.Approaching(m_PlayerEntity, other);
+        if (neighbor != nullptr && neighbor != approaching && neighbor->Fightable())
+            enemies.push_back(&dynamic_cast<Entities::Character&>(*neighbor));
+    }
+
+    // Battle records hold a single enemy
+    Battle::BattleRecord record;
+    Battle::Battle battle(m_PlayerEntity, enemies);
+    if (enemies.size() == 1)
+        battle.SetRecord(&record);
     m_Screen.OpenBattleScreen(battle);
     Battle::Battle::Result result = battle.DoBattle();
     m_Screen.CloseSubscreen();
+    if (enemies.size() == 1 && !record.SaveToFile(Battle::BattleRecord::LastBattleFilename))
+        m_Screen.PostMessage("Could not write " + Battle::BattleRecord::LastBattleFilename + ".");
+    m_BattleCount++;
 
     switch (result)
     {
     case Battle::Battle::Result::Victory:
     {
-        int xpGain = targetedCharacter.CalculateXPReward();
-        m_EntityManager.KillEntity(targetedCharacter);
+        m_VictoryCount++;
+        int xpGain = 0;
+        for (auto enemy : enemies)
+        {
+            xpGain += enemy->CalculateXPReward();
+            m_EntityManager.KillEntity(*enemy);
+        }
 
         const auto oldPlayerStats = m_PlayerEntity.GetStats();
         bool leveledUp = m_PlayerEntity.GrantXP(xpGain);
@@ -104,7 +128,8 @@ bool Controller::TryFight(Direction dir)
         epitaph << m_PlayerEntity.GetName() << " did not make it past\n"
                 << "World " << m_WorldManager.CurrentWorld().GetWorldNumber() << " of the Dun-geon.\n"
                 << "The duelist was defeated\n"
-                << "in battle by " << targetedCharacter.GetName() << ".";
+                << "in battle by " << targetedCharacter.GetName()
+                << (enemies.size() > 1 ? " and co." : "") << ".";
         m_Screen.GameOver(epitaph.str());
         break;
     }
@@ -48,6 +48,7 @@ public:
 
     /**
      * @brief Try to fight something in the given direction
+     * Other fightable characters next to the player join the battle on the enemy side.
      * 
      * @param dir direction
      * @return true if there is something to fight, false otherwise
@@ -61,11 +62,27 @@ public:
      */
     void TurnPlayer(Direction dir);
 
+    /**
+     * @brief Get the number of battles the player has fought
+     * 
+     * @return int battle count
+     */
+    inline int GetBattleCount() const { return m_BattleCount; }
+
+    /**
+     * @brief Get the number of battles the player has won
+     * 
+     * @return int victory count
+     */
+    inline int GetVictoryCount() const { return m_VictoryCount; }
+
 private:
     Entities::EntityManager& m_EntityManager;
     Worlds::WorldManager& m_WorldManager;
     Entities::Player& m_PlayerEntity;
     UI::Screen& m_Screen;
+    int m_BattleCount;
+    int m_VictoryCount;
 };
 
 } /* namespace Player */
@@ -0,0 +1,153 @@
+#include "Animation.h"
+#include <algorithm>
+#include <cmath>
+
+namespace UI::Animation
+{
+
+double Linear(double progress)
+{
+    return progress;
+}
+
+double EaseOut(double progress)
+{
+    double inverse = 1.0 - progress;
+    return 1.0 - inverse * inverse * inverse;
+}
+
+void Animation::Finish()
+{
+    Seek(Length());
+}
+
+Frame::Frame(std::function<void()> action) : m_Action(std::move(action)), m_IsDone(false)
+{
+}
+
+int Frame::Length() const
+{
+    return 0;
+}
+
+void Frame::Seek(int timeMs)
+{
+    if (!m_IsDone && timeMs >= 0)
+    {
+        m_IsDone = true;
+        m_Action();
+    }
+}
+
+Delay::Delay(int lengthMs) : m_Length(std::max(lengthMs, 0))
+{
+}
+
+int Delay::Length() const
+{
+    return m_Length;
+}
+
+void Delay::Seek(int timeMs)
+{
+}
+
+Tween::Tween(int lengthMs, int from, int to, std::function<void(int)> setter, Easing easing)
+    : m_Length(std::max(lengthMs, 0)),
+      m_From(from),
+      m_To(to),
+      m_Setter(std::move(setter)),
+      m_Easing(std::move(easing)),
+      m_HasStarted(false),
+      m_LastValue(from)
+{
+}
+
+int Tween::Length() const
+{
+    return m_Length;
+}
+
+void Tween::Seek(int timeMs)
+{
+    if (timeMs < 0)
+        return;
+
+    int value = m_To;
+    if (timeMs < m_Length)
+    {
+        double progress = m_Easing(static_cast<double>(timeMs) / m_Length);
+        value           = m_From + static_cast<int>(std::lround((m_To - m_From) * progress));
+    }
+
+    if (!m_HasStarted || value != m_LastValue)
+    {
+        m_HasStarted = true;
+        m_LastValue  = value;
+        m_Setter(value);
+    }
+}
+
+int Sequence::Length() const
+{
+    int length = 0;
+    for (const auto& animation : m_Animations)
+    {
+        length += animation->Length();
+    }
+    return length;
+}
+
+void Sequence::Seek(int timeMs)
+{
+    int start = 0;
+    for (auto& animation : m_Animations)
+    {
+        if (timeMs < start)
+            break;
+        animation->Seek(timeMs - start);
+        start += animation->Length();
+    }
+}
+
+Sequence& Sequence::Then(std::unique_ptr<Animation> animation)
+{
+    m_Animations.push_back(std::move(animation));
+    return *this;
+}
+
+Sequence& Sequence::Do(std::function<void()> action)
+{
+    return Then(std::make_unique<Frame>(std::move(action)));
+}
+
+Sequence& Sequence::Wait(int lengthMs)
+{
+    return Then(std::make_unique<Delay>(lengthMs));
+}
+
+int Parallel::Length() const
+{
+    int length = 0;
+    for (const auto& animation : m_Animations)
+    {
+        length = std::max(length, animation->Length());
+    }
+    return length;
+}
+
+void Parallel::Seek(int timeMs)
+{
+    for (auto& animation : m_Animations)
+    {
+        animation->Seek(timeMs);
+    }
+}
+
+Parallel& Parallel::With(std::unique_ptr<Animation> animation)
+{
+    m_Animations.push_back(std::move(animation));
+    return *this;
+}
+
+} /* namespace UI::Animation */
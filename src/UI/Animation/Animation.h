@@ -0,0 +1,193 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace UI::Animation
+{
+
+/**
+ * @brief Easing curve mapping linear progress in range [0, 1] onto eased progress
+ */
+using Easing = std::function<double(double)>;
+
+/**
+ * @brief Linear easing
+ * 
+ * @param progress progress
+ * @return double eased progress
+ */
+double Linear(double progress);
+
+/**
+ * @brief Cubic ease-out, fast at the start and slowing down towards the end
+ * 
+ * @param progress progress
+ * @return double eased progress
+ */
+double EaseOut(double progress);
+
+/**
+ * @brief Animation which can be advanced to any point in time
+ * Time only ever moves forward. Seeking past the end puts the animation into its final state,
+ * which is how animations get skipped.
+ */
+class Animation
+{
+public:
+    /**
+     * @brief Destructor
+     */
+    virtual ~Animation() = default;
+
+    /**
+     * @brief Get the length of the animation
+     * 
+     * @return int length in milliseconds
+     */
+    virtual int Length() const = 0;
+
+    /**
+     * @brief Advance the animation to the given point in time
+     * 
+     * @param timeMs time since the start of the animation in milliseconds
+     */
+    virtual void Seek(int timeMs) = 0;
+
+    /**
+     * @brief Advance the animation to its final state
+     */
+    void Finish();
+};
+
+/**
+ * @brief Instant action performed once its point in time is reached
+ */
+class Frame : public Animation
+{
+public:
+    /**
+     * @brief Constructor
+     * 
+     * @param action action to perform
+     */
+    explicit Frame(std::function<void()> action);
+
+    virtual int Length() const override;
+    virtual void Seek(int timeMs) override;
+
+private:
+    std::function<void()> m_Action;
+    bool m_IsDone;
+};
+
+/**
+ * @brief Pause doing nothing
+ */
+class Delay : public Animation
+{
+public:
+    /**
+     * @brief Constructor
+     * 
+     * @param lengthMs length in milliseconds
+     */
+    explicit Delay(int lengthMs);
+
+    virtual int Length() const override;
+    virtual void Seek(int timeMs) override;
+
+private:
+    int m_Length;
+};
+
+/**
+ * @brief Gradual transition of an integer value
+ * The setter is called whenever the interpolated value changes, and always with the final value at the end.
+ */
+class Tween : public Animation
+{
+public:
+    /**
+     * @brief Constructor
+     * 
+     * @param lengthMs length in milliseconds
+     * @param from starting value
+     * @param to final value
+     * @param setter function applying the value
+     * @param easing easing curve (default: ease-out)
+     */
+    Tween(int lengthMs, int from, int to, std::function<void(int)> setter, Easing easing = EaseOut);
+
+    virtual int Length() const override;
+    virtual void Seek(int timeMs) override;
+
+private:
+    int m_Length;
+    int m_From, m_To;
+    std::function<void(int)> m_Setter;
+    Easing m_Easing;
+    bool m_HasStarted;
+    int m_LastValue;
+};
+
+/**
+ * @brief Animations played one after another
+ */
+class Sequence : public Animation
+{
+public:
+    virtual int Length() const override;
+    virtual void Seek(int timeMs) override;
+
+    /**
+     * @brief Append an animation
+     * 
+     * @param animation animation
+     * @return Sequence& this sequence
+     */
+    Sequence& Then(std::unique_ptr<Animation> animation);
+
+    /**
+     * @brief Append an instant action
+     * 
+     * @param action action
+     * @return Sequence& this sequence
+     */
+    Sequence& Do(std::function<void()> action);
+
+    /**
+     * @brief Append a pause
+     * 
+     * @param lengthMs length in milliseconds
+     * @return Sequence& this sequence
+     */
+    Sequence& Wait(int lengthMs);
+
+private:
+    std::vector<std::unique_ptr<Animation>> m_Animations;
+};
+
+/**
+ * @brief Animations played at the same time
+ */
+class Parallel : public Animation
+{
+public:
+    virtual int Length() const override;
+    virtual void Seek(int timeMs) override;
+
+    /**
+     * @brief Add an animation
+     * 
+     * @param animation animation
+     * @return Parallel& this group
+     */
+    Parallel& With(std::unique_ptr<Animation> animation);
+
+private:
+    std::vector<std::unique_ptr<Animation>> m_Animations;
+};
+
+} /* namespace UI::Animation */
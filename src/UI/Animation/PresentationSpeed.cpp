@@ -0,0 +1,47 @@
+#include "PresentationSpeed.h"
+#include "Misc/Exceptions.h"
+
+namespace UI::Animation
+{
+
+std::string PresentationSpeedName(PresentationSpeed speed)
+{
+    switch (speed)
+    {
+    case PresentationSpeed::Normal:
+        return "normal";
+    case PresentationSpeed::Fast:
+        return "fast";
+    case PresentationSpeed::Instant:
+        return "instant";
+    default:
+        throw InvalidEnumValueException("Invalid presentation speed");
+    }
+}
+
+std::optional<PresentationSpeed> ParsePresentationSpeed(const std::string& name)
+{
+    for (auto speed : { PresentationSpeed::Normal, PresentationSpeed::Fast, PresentationSpeed::Instant })
+    {
+        if (PresentationSpeedName(speed) == name)
+            return speed;
+    }
+    return std::nullopt;
+}
+
+PresentationSpeed NextPresentationSpeed(PresentationSpeed speed)
+{
+    switch (speed)
+    {
+    case PresentationSpeed::Normal:
+        return PresentationSpeed::Fast;
+    case PresentationSpeed::Fast:
+        return PresentationSpeed::Instant;
+    case PresentationSpeed::Instant:
+        return PresentationSpeed::Normal;
+    default:
+        throw InvalidEnumValueException("Invalid presentation speed");
+    }
+}
+
+} /* namespace UI::Animation */
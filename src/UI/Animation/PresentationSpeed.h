@@ -0,0 +1,54 @@
+#pragma once
+
+#include <optional>
+#include <string>
+
+namespace UI::Animation
+{
+
+/**
+ * @brief How animations are presented
+ */
+enum class PresentationSpeed
+{
+    /**
+     * @brief Animations play at their natural pace
+     */
+    Normal,
+
+    /**
+     * @brief Animations play several times faster
+     */
+    Fast,
+
+    /**
+     * @brief Animations skip straight to their final state
+     */
+    Instant
+};
+
+/**
+ * @brief Get the name of a presentation speed
+ * 
+ * @param speed speed
+ * @return std::string lowercase name
+ */
+std::string PresentationSpeedName(PresentationSpeed speed);
+
+/**
+ * @brief Parse a presentation speed from its name
+ * 
+ * @param name lowercase name
+ * @return std::optional<PresentationSpeed> speed or nothing if the name is not recognized
+ */
+std::optional<PresentationSpeed> ParsePresentationSpeed(const std::string& name);
+
+/**
+ * @brief Get the next faster presentation speed, wrapping around to Normal after Instant
+ * 
+ * @param speed speed
+ * @return PresentationSpeed next speed
+ */
+PresentationSpeed NextPresentationSpeed(PresentationSpeed speed);
+
+} /* namespace UI::Animation */
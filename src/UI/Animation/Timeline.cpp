@@ -0,0 +1,68 @@
+#include "Timeline.h"
+#include <chrono>
+
+namespace UI::Animation
+{
+
+Timeline::Timeline(Render::RenderBackend& backend) : m_Backend(backend), m_Speed(PresentationSpeed::Normal)
+{
+}
+
+bool Timeline::Play(Animation& animation)
+{
+    using Clock = std::chrono::steady_clock;
+    using std::chrono::duration_cast;
+    using std::chrono::milliseconds;
+
+    constexpr auto frameLength = milliseconds(1000 / FrameRate);
+
+    if (m_Speed == PresentationSpeed::Instant)
+    {
+        animation.Finish();
+        m_Backend.Flush();
+        return false;
+    }
+
+    const int  timeScale = m_Speed == PresentationSpeed::Fast ? FastSpeedFactor : 1;
+    const int  length    = animation.Length();
+    const auto startTime = Clock::now();
+    auto       nextFrame = startTime;
+    bool       isSkipped = false;
+
+    animation.Seek(0);
+    m_Backend.Flush();
+
+    while (true)
+    {
+        int elapsedMs = duration_cast<milliseconds>(Clock::now() - startTime).count() * timeScale;
+        if (elapsedMs >= length)
+            break;
+
+        nextFrame += frameLength;
+        int waitMs = duration_cast<milliseconds>(nextFrame - Clock::now()).count();
+        if (m_Backend.PollKey(waitMs) != Render::RenderBackend::NoKey)
+        {
+            isSkipped = true;
+            break;
+        }
+
+        animation.Seek(duration_cast<milliseconds>(Clock::now() - startTime).count() * timeScale);
+        m_Backend.Flush();
+    }
+
+    animation.Finish();
+    m_Backend.Flush();
+    return isSkipped;
+}
+
+PresentationSpeed Timeline::GetSpeed() const
+{
+    return m_Speed;
+}
+
+void Timeline::SetSpeed(PresentationSpeed speed)
+{
+    m_Speed = speed;
+}
+
+} /* namespace UI::Animation */
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "Animation.h"
+#include "PresentationSpeed.h"
+#include "Render/RenderBackend.h"
+
+namespace UI::Animation
+{
+
+/**
+ * @brief Drives animations at a fixed frame rate and lets the player skip them
+ */
+class Timeline
+{
+public:
+    /**
+     * @brief Frames per second
+     */
+    constexpr static const int FrameRate = 60;
+
+    /**
+     * @brief How many times faster animations play at PresentationSpeed::Fast
+     */
+    constexpr static const int FastSpeedFactor = 4;
+
+    /**
+     * @brief Constructor
+     * 
+     * @param backend render backend to flush frames to and poll input from
+     */
+    explicit Timeline(Render::RenderBackend& backend);
+
+    /**
+     * @brief Play an animation until it ends or any key is pressed, in which case it skips to the end state
+     * 
+     * @param animation animation
+     * @return true if the animation was skipped
+     */
+    bool Play(Animation& animation);
+
+    /**
+     * @brief Get the presentation speed
+     * 
+     * @return PresentationSpeed speed
+     */
+    PresentationSpeed GetSpeed() const;
+
+    /**
+     * @brief Set the presentation speed
+     * 
+     * @param speed speed
+     */
+    void SetSpeed(PresentationSpeed speed);
+
+private:
+    Render::RenderBackend& m_Backend;
+    PresentationSpeed m_Speed;
+};
+
+} /* namespace UI::Animation */
@@ -1,15 +1,38 @@
 #include "BattleScreen.h"
+#include "Animation/Animation.h"
 #include "Components/FillBar.h"
 #include "Misc/Utils.h"
+#include "Render/RenderBackend.h"
+#include "Render/RenderTarget.h"
 #include <algorithm>
+#include <cmath>
 #include <ncurses.h>
 #include <sstream>
+#include <variant>
 
 using BattleResult = Battle::Battle::Result;
 
 namespace UI
 {
 
+/**
+ * @brief Action menu entry of a skill category
+ */
+struct CategoryAction
+{
+    Battle::Skill::Category Category;
+    int Code;
+    const char* Name;
+};
+
+/**
+ * @brief Action menu entries of all selectable skill categories; codes determine the menu layout
+ */
+static const std::array<CategoryAction, 4> CategoryActions { { { Battle::Skill::Category::Melee, 0, "Melee" },
+                                                               { Battle::Skill::Category::Ranged, 1, "Ranged" },
+                                                               { Battle::Skill::Category::Spell, 2, "Spell" },
+                                                               { Battle::Skill::Category::Special, 5, "Special" } } };
+
 BattleScreen::BattleScreen(Battle::Battle& battle, Screen& screen, InputHandler& inputHandler)
     : Subscreen(screen, inputHandler),
       m_Battle(battle),
@@ -18,14 +41,21 @@ BattleScreen::BattleScreen(Battle::Battle& battle, Screen& screen, InputHandler&
       m_StatPanelWindow(nullptr),
       m_PlayerActiveEffectsWindow(nullptr),
       m_EnemyActiveEffectsWindow(nullptr),
-      m_PlayerNameplate(m_Battle.GetPlayer(),
+      m_PlayerNameplate(m_Screen.GetRenderBackend(),
+                        m_Battle.GetPlayer(),
                         (ArenaPanelWidth - ArenaNameplateWidth) / 2,
                         2 + Components::Nameplate::Height + 3,
                         ArenaNameplateWidth,
                         false),
-      m_EnemyNameplate(m_Battle.GetEnemy(), (ArenaPanelWidth - ArenaNameplateWidth) / 2, 2, ArenaNameplateWidth, true),
-      m_LogWindow(ArenaPanelWidth, 0, LogPanelWidth, TopPanelHeight)
+      m_EnemyNameplate(m_Screen.GetRenderBackend(),
+                       m_Battle.GetEnemy(),
+                       (ArenaPanelWidth - ArenaNameplateWidth) / 2,
+                       2,
+                       ArenaNameplateWidth,
+                       true),
+      m_LogWindow(m_Screen.GetRenderBackend(), ArenaPanelWidth, 0, LogPanelWidth, TopPanelHeight)
 {
+    BuildMenuOptions();
     Init();
 }
 
@@ -34,20 +64,46 @@ BattleScreen::~BattleScreen()
     Terminate();
 }
 
+void BattleScreen::BuildMenuOptions()
+{
+    const auto& player = m_Battle.GetPlayer();
+    for (const auto& action : CategoryActions)
+    {
+        if (!player.HasSkillCategory(action.Category))
+            continue;
+
+        m_ActionOptions[action.Code] = action.Name;
+        auto& options                = m_SkillOptions[static_cast<int>(action.Category)];
+        options[RethinkCode]         = "<rethink>";
+        int index                    = 0;
+        for (const auto* skill : player.GetSkillsOfCategory(action.Category))
+        {
+            options[index++] = skill->GetName();
+        }
+    }
+    m_ActionOptions[EscapeCode] = "Escape";
+}
+
+bool BattleScreen::IsOnNameplate(size_t index) const
+{
+    return index == Battle::Battle::PlayerIndex || &m_Battle.GetCombatant(index).Character == &m_Battle.GetEnemy();
+}
+
 void BattleScreen::Init()
 {
+    auto& backend = m_Screen.GetRenderBackend();
     if (m_ArenaPanelWindow == nullptr)
-        m_ArenaPanelWindow = newwin(
+        m_ArenaPanelWindow = backend.CreateTarget(
             Components::Nameplate::Height * 2 + 3, ArenaNameplateWidth, 2, (ArenaPanelWidth - ArenaNameplateWidth) / 2);
     if (m_BottomPanelWindow == nullptr)
-        m_BottomPanelWindow = newwin(BottomPanelHeight, ArenaPanelWidth, TopPanelHeight, 0);
+        m_BottomPanelWindow = backend.CreateTarget(BottomPanelHeight, ArenaPanelWidth, TopPanelHeight, 0);
     if (m_StatPanelWindow == nullptr)
-        m_StatPanelWindow = newwin(BottomPanelHeight, LogPanelWidth, TopPanelHeight, ArenaPanelWidth);
+        m_StatPanelWindow = backend.CreateTarget(BottomPanelHeight, LogPanelWidth, TopPanelHeight, ArenaPanelWidth);
 
     if (m_PlayerActiveEffectsWindow == nullptr)
-        m_PlayerActiveEffectsWindow = newwin(1, ArenaPanelWidth, TopPanelHeight - 1, 0);
+        m_PlayerActiveEffectsWindow = backend.CreateTarget(1, ArenaPanelWidth, TopPanelHeight - 1, 0);
     if (m_EnemyActiveEffectsWindow == nullptr)
-        m_EnemyActiveEffectsWindow = newwin(1, ArenaPanelWidth, 0, 0);
+        m_EnemyActiveEffectsWindow = backend.CreateTarget(1, ArenaPanelWidth, 0, 0);
 
     m_Screen.Clear();
 
@@ -57,29 +113,130 @@ void BattleScreen::Init()
 
 void BattleScreen::Terminate()
 {
-    werase(m_ArenaPanelWindow);
-    wrefresh(m_ArenaPanelWindow);
-    delwin(m_ArenaPanelWindow);
+    m_ArenaPanelWindow->Erase();
+    m_ArenaPanelWindow->Present();
+    m_ArenaPanelWindow.reset();
 
-    werase(m_BottomPanelWindow);
-    wrefresh(m_BottomPanelWindow);
-    delwin(m_BottomPanelWindow);
+    m_BottomPanelWindow->Erase();
+    m_BottomPanelWindow->Present();
+    m_BottomPanelWindow.reset();
 
-    werase(m_StatPanelWindow);
-    wrefresh(m_StatPanelWindow);
-    delwin(m_StatPanelWindow);
+    m_StatPanelWindow->Erase();
+    m_StatPanelWindow->Present();
+    m_StatPanelWindow.reset();
 
-    werase(m_PlayerActiveEffectsWindow);
-    wrefresh(m_PlayerActiveEffectsWindow);
-    delwin(m_PlayerActiveEffectsWindow);
+    m_PlayerActiveEffectsWindow->Erase();
+    m_PlayerActiveEffectsWindow->Present();
+    m_PlayerActiveEffectsWindow.reset();
 
-    werase(m_EnemyActiveEffectsWindow);
-    wrefresh(m_EnemyActiveEffectsWindow);
-    delwin(m_EnemyActiveEffectsWindow);
+    m_EnemyActiveEffectsWindow->Erase();
+    m_EnemyActiveEffectsWindow->Present();
+    m_EnemyActiveEffectsWindow.reset();
 
     AnimateBattleEnd();
 }
 
+Battle::Skill* BattleScreen::ChooseSkill(const Battle::Battle& battle)
+{
+    const auto& player = battle.GetPlayer();
+    while (true)
+    {
+        PostMessage("What will " + player.GetName() + " do?");
+
+        int choice = SelectPlayerAction(m_ActionOptions);
+        if (choice == EscapeCode)
+            return nullptr;
+
+        auto action = std::find_if(CategoryActions.begin(), CategoryActions.end(), [&](const auto& categoryAction) {
+            return categoryAction.Code == choice;
+        });
+        if (action == CategoryActions.end())
+            continue;
+
+        PostMessage("Which skill?");
+        auto skills     = player.GetSkillsOfCategory(action->Category);
+        int skillChoice = SelectWithHoverAction(m_SkillOptions[static_cast<int>(action->Category)], [&](auto it) {
+            ClearProjectionArea();
+            ClearThumbnailArea();
+            if (it->first == RethinkCode)
+                return;
+
+            ShowSkillHover(skills[it->first]);
+        });
+
+        if (skillChoice != RethinkCode)
+            return &skills[skillChoice];
+    }
+}
+
+size_t BattleScreen::ChooseTarget(const Battle::Battle& battle, const Battle::Skill& skill)
+{
+    std::map<int, std::string> targetOptions;
+    for (size_t index = 0; index < battle.GetCombatantCount(); index++)
+    {
+        const auto& combatant = battle.GetCombatant(index);
+        if (!combatant.IsPlayerSide && !combatant.IsDefeated)
+            targetOptions[static_cast<int>(index)] = combatant.Character.GetName();
+    }
+    if (targetOptions.size() <= 1)
+        return battle.SuggestTarget(true);
+
+    PostMessage("Use " + skill.GetName() + " on whom?");
+    return SelectWithHoverAction(targetOptions);
+}
+
+void BattleScreen::OnEffectsUpdated()
+{
+    DisplayPlayerActiveEffects();
+    DisplayEnemyActiveEffects();
+}
+
+void BattleScreen::OnSkillChosen(const Battle::Skill& skill, size_t user)
+{
+    const auto& userName = m_Battle.GetCombatant(user).Character.GetName();
+    if (user == Battle::Battle::PlayerIndex)
+    {
+        PostMessage(userName + " uses " + skill.GetName() + "!");
+        ClearProjectionArea();
+        ClearThumbnailArea();
+    }
+    else
+    {
+        PostMessage(userName + " attacks!");
+    }
+}
+
+void BattleScreen::OnSkillApplied(const Battle::Skill& skill,
+                                  const Battle::SkillResult& result,
+                                  size_t user,
+                                  size_t target)
+{
+    if (IsOnNameplate(user) && IsOnNameplate(target))
+    {
+        std::visit(
+            [&](const auto& displayData) {
+                if (user == Battle::Battle::PlayerIndex)
+                    AnimatePlayerAttack(displayData);
+                else
+                    AnimateEnemyAttack(displayData, skill.GetName());
+            },
+            result);
+        return;
+    }
+
+    // The arena only has room for the player and the first enemy, so others' skills just go to the log
+    const auto& userName = m_Battle.GetCombatant(user).Character.GetName();
+    if (const auto* attackResult = std::get_if<Battle::AttackSkillResult>(&result))
+        LogAttack(*attackResult, userName, m_Battle.GetCombatant(target).Character.GetName());
+    else
+        AppendToLog(userName + " uses " + skill.GetName() + "!");
+}
+
+void BattleScreen::OnBattleEnd(Battle::Battle::Result result)
+{
+    BattleEndMessage(result);
+}
+
 int BattleScreen::SelectPlayerAction(const std::map<int, std::string>& actions)
 {
     constexpr int numColumns = 3;
@@ -91,138 +248,192 @@ int BattleScreen::SelectPlayerAction(const std::map<int, std::string>& actions)
           + 4;
     const int width = (columnWidth + 1) * numColumns - 1;
 
-    return Screen::SelectViaMenu(
-        actions, (ArenaPanelWidth - width) / 2 - 1, TopPanelHeight + 2, width + 2, 5, false, 0, 0, "", true, false);
+    return m_Screen.SelectViaMenu(actions,
+                                  (ArenaPanelWidth - width) / 2 - 1,
+                                  TopPanelHeight + 2,
+                                  width + 2,
+                                  5,
+                                  false,
+                                  0,
+                                  0,
+                                  "",
+                                  true,
+                                  false,
+                                  {},
+                                  [this](int direction) { ScrollLog(direction); });
 }
 
 int BattleScreen::SelectWithHoverAction(const std::map<int, std::string>& options,
-                                        std::function<void(std::map<int, std::string>::iterator)> hoverAction)
+                                        std::function<void(std::map<int, std::string>::const_iterator)> hoverAction)
 {
     constexpr int width = 20;
-    return Screen::SelectViaMenu(
-        options, 2, TopPanelHeight + 2, width, BottomPanelHeight - 3, true, 0, 0, "", false, true, hoverAction);
+    return m_Screen.SelectViaMenu(options,
+                                  2,
+                                  TopPanelHeight + 2,
+                                  width,
+                                  BottomPanelHeight - 3,
+                                  true,
+                                  0,
+                                  0,
+                                  "",
+                                  false,
+                                  true,
+                                  hoverAction,
+                                  [this](int direction) { ScrollLog(direction); });
 }
 
 void BattleScreen::PostMessage(const std::string& message)
 {
-    mvwhline(m_BottomPanelWindow, 1, 1, ' ', ArenaPanelWidth - 2);
-    mvwprintw(m_BottomPanelWindow, 1, 2, message.c_str());
-    wrefresh(m_BottomPanelWindow);
+    m_BottomPanelWindow->HLine(1, 1, ' ', ArenaPanelWidth - 2);
+    m_BottomPanelWindow->AddString(1, 2, message);
+    m_BottomPanelWindow->Present();
+}
+
+void BattleScreen::ShowSkillHover(const Battle::Skill& skill)
+{
+    if (const auto* attackSkill = dynamic_cast<const Battle::AttackSkill*>(&skill))
+    {
+        ProjectSkillUse(*attackSkill);
+        PrintSkillHoverThumbnailInfo(*attackSkill);
+    }
+    else if (const auto* applyEffectOnlySkill = dynamic_cast<const Battle::ApplyEffectOnlySkillBase*>(&skill))
+    {
+        PrintSkillHoverThumbnailInfo(*applyEffectOnlySkill);
+    }
 }
 
 void BattleScreen::ProjectSkillUse(const Battle::AttackSkill& attackSkill)
 {
     constexpr size_t arrowXPos = ArenaNameplateWidth / 2 + 6;
-    int hitChancePercent = attackSkill.CalculateHitChance(m_Battle.GetPlayerProfile(), m_Battle.GetEnemyProfile());
-    wattron(m_ArenaPanelWindow, COLOR_PAIR(ColorPairs::BlackOnDefault) | A_BOLD);
-    mvwaddch(m_ArenaPanelWindow, Components::Nameplate::Height, arrowXPos, ACS_UARROW);
-    mvwaddch(m_ArenaPanelWindow, Components::Nameplate::Height + 1, arrowXPos, '|');
-    mvwaddch(m_ArenaPanelWindow, Components::Nameplate::Height + 2, arrowXPos, '|');
-    mvwprintw(m_ArenaPanelWindow, Components::Nameplate::Height, arrowXPos - 5, "Hit:");
-    mvwprintw(m_ArenaPanelWindow, Components::Nameplate::Height + 1, arrowXPos - 5, "%3d%%", hitChancePercent);
-    wattroff(m_ArenaPanelWindow, A_COLOR | A_BOLD);
-    wrefresh(m_ArenaPanelWindow);
+    auto outcome = m_OutcomeCache.Get(attackSkill, m_Battle.GetPlayerProfile(), m_Battle.GetEnemyProfile());
+    int killChancePercent = lround(outcome.KillProbability(m_Battle.GetEnemyProfile().Stats.Health) * 100);
+    m_ArenaPanelWindow->AttrOn(COLOR_PAIR(ColorPairs::BlackOnDefault) | A_BOLD);
+    m_ArenaPanelWindow->AddChar(Components::Nameplate::Height, arrowXPos, ACS_UARROW);
+    m_ArenaPanelWindow->AddChar(Components::Nameplate::Height + 1, arrowXPos, '|');
+    m_ArenaPanelWindow->AddChar(Components::Nameplate::Height + 2, arrowXPos, '|');
+    m_ArenaPanelWindow->Print(Components::Nameplate::Height, arrowXPos - 5, "Hit:");
+    m_ArenaPanelWindow->Print(Components::Nameplate::Height + 1, arrowXPos - 5, "%3d%%", outcome.GetHitChance());
+    m_ArenaPanelWindow->Print(Components::Nameplate::Height, arrowXPos + 2, "Dmg %.1f", outcome.GetExpectedDamage());
+    m_ArenaPanelWindow->Print(Components::Nameplate::Height + 1, arrowXPos + 2, "Kill %d%%", killChancePercent);
+    m_ArenaPanelWindow->AttrOff(A_COLOR | A_BOLD);
+    m_ArenaPanelWindow->Present();
 }
 
 void BattleScreen::ClearProjectionArea()
 {
     for (int i = 0; i < 3; i++)
     {
-        mvwhline(m_ArenaPanelWindow, Components::Nameplate::Height + i, 0, ' ', ArenaNameplateWidth);
+        m_ArenaPanelWindow->HLine(Components::Nameplate::Height + i, 0, ' ', ArenaNameplateWidth);
     }
-    wrefresh(m_ArenaPanelWindow);
+    m_ArenaPanelWindow->Present();
 }
 
 void BattleScreen::ClearThumbnailArea()
 {
     for (int i = 0; i < BottomPanelHeight - 2; i++)
     {
-        mvwhline(m_BottomPanelWindow, i + 1, 22, ' ', ArenaPanelWidth - 22);
+        m_BottomPanelWindow->HLine(i + 1, 22, ' ', ArenaPanelWidth - 22);
     }
-    mvwhline(m_BottomPanelWindow, 0, 23, ACS_HLINE, ArenaPanelWidth - 23);
-    mvwvline(m_BottomPanelWindow, 1, 23, ' ', BottomPanelHeight - 1);
-    mvwhline(m_BottomPanelWindow, BottomPanelHeight - 1, 23, ACS_HLINE, ArenaPanelWidth - 23);
-    wrefresh(m_BottomPanelWindow);
+    m_BottomPanelWindow->HLine(0, 23, ACS_HLINE, ArenaPanelWidth - 23);
+    m_BottomPanelWindow->VLine(1, 23, ' ', BottomPanelHeight - 1);
+    m_BottomPanelWindow->HLine(BottomPanelHeight - 1, 23, ACS_HLINE, ArenaPanelWidth - 23);
+    m_BottomPanelWindow->Present();
 }
 
-void BattleScreen::AnimatePlayerAttack(const Battle::AttackSkill::AttackSkillResult& displayData)
+void BattleScreen::AnimatePlayerAttack(const Battle::AttackSkillResult& displayData)
 {
     // Constants
     constexpr size_t arrowXPos      = ArenaNameplateWidth / 2 + 6;
     constexpr int animationPeriodMs = 100;
     constexpr int postAttackDelayMs = 600;
 
-    // Begin drawing the arrow
-    wattron(m_ArenaPanelWindow, COLOR_PAIR(ColorPairs::YellowOnDefault) | A_BOLD);
+    Render::RenderTarget& arena = *m_ArenaPanelWindow;
+    Animation::Sequence animation;
 
-    Sleep(animationPeriodMs);
-    mvwaddch(m_ArenaPanelWindow, Components::Nameplate::Height + 2, arrowXPos, '|');
-    wrefresh(m_ArenaPanelWindow);
-    Sleep(animationPeriodMs);
+    // Begin drawing the arrow
+    animation.Do([&] { arena.AttrOn(COLOR_PAIR(ColorPairs::YellowOnDefault) | A_BOLD); })
+        .Wait(animationPeriodMs)
+        .Do([&] {
+            arena.AddChar(Components::Nameplate::Height + 2, arrowXPos, '|');
+            arena.Present();
+        })
+        .Wait(animationPeriodMs);
 
     if (displayData.IsHit)
     {
         // Finish drawing the arrow
-        mvwaddch(m_ArenaPanelWindow, Components::Nameplate::Height + 1, arrowXPos, '|');
-        wrefresh(m_ArenaPanelWindow);
-        Sleep(animationPeriodMs);
-
-        mvwaddch(m_ArenaPanelWindow, Components::Nameplate::Height, arrowXPos, ACS_UARROW);
-        wrefresh(m_ArenaPanelWindow);
-        Sleep(animationPeriodMs);
-
-        // "Hit!"
-        wattron(m_ArenaPanelWindow, COLOR_PAIR(ColorPairs::RedOnDefault));
-        mvwprintw(m_ArenaPanelWindow, Components::Nameplate::Height + 1, arrowXPos - 5, "Hit!");
-
-        // Damage number
-        short asteriskColor = displayData.Damage.GetDamageType().TextColor();
-        wattron(m_ArenaPanelWindow, COLOR_PAIR(asteriskColor));
-        mvwaddch(m_ArenaPanelWindow, Components::Nameplate::Height + 1, arrowXPos + 2, '*');
-        wattron(m_ArenaPanelWindow, COLOR_PAIR(ColorPairs::YellowOnDefault));
-        wprintw(m_ArenaPanelWindow, " %d ", displayData.Damage.GetValue());
-        waddch(m_ArenaPanelWindow, '*' | COLOR_PAIR(asteriskColor));
-
-        // "Crit!"
-        if (displayData.IsCrit)
-        {
-            mvwaddstr(m_ArenaPanelWindow, Components::Nameplate::Height, arrowXPos + 2, "Critical!");
-        }
-        wrefresh(m_ArenaPanelWindow);
-
-        // Log
-        LogAttack(displayData, m_Battle.GetPlayer().GetName(), m_Battle.GetEnemy().GetName());
+        animation
+            .Do([&] {
+                arena.AddChar(Components::Nameplate::Height + 1, arrowXPos, '|');
+                arena.Present();
+            })
+            .Wait(animationPeriodMs)
+            .Do([&] {
+                arena.AddChar(Components::Nameplate::Height, arrowXPos, ACS_UARROW);
+                arena.Present();
+            })
+            .Wait(animationPeriodMs)
+            .Do([&] {
+                // "Hit!"
+                arena.AttrOn(COLOR_PAIR(ColorPairs::RedOnDefault));
+                arena.Print(Components::Nameplate::Height + 1, arrowXPos - 5, "Hit!");
+
+                // Damage number
+                short asteriskColor = displayData.Damage.GetDamageType().TextColor();
+                arena.AttrOn(COLOR_PAIR(asteriskColor));
+                arena.AddChar(Components::Nameplate::Height + 1, arrowXPos + 2, '*');
+                arena.AttrOn(COLOR_PAIR(ColorPairs::YellowOnDefault));
+                arena.Print(" %d ", displayData.Damage.GetValue());
+                arena.AddChar('*' | COLOR_PAIR(asteriskColor));
+
+                // "Crit!"
+                if (displayData.IsCrit)
+                {
+                    arena.AddString(Components::Nameplate::Height, arrowXPos + 2, "Critical!");
+                }
+                arena.Present();
+
+                // Log
+                LogAttack(displayData, m_Battle.GetPlayer().GetName(), m_Battle.GetEnemy().GetName());
+            });
 
         // Nameplate animations
         if (displayData.Damage.GetValue() > 0)
         {
-            m_EnemyNameplate.FlashBorder(ColorPairs::RedOnDefault, 2, animationPeriodMs);
-            m_EnemyNameplate.HealthBar.RollBy(-displayData.Damage.GetValue());
+            animation.Then(m_EnemyNameplate.FlashBorderAnimation(ColorPairs::RedOnDefault, 2, animationPeriodMs))
+                .Then(m_EnemyNameplate.HealthBar.RollAnimation(-displayData.Damage.GetValue()));
         }
         else
         {
-            Sleep(animationPeriodMs * 3);
+            animation.Wait(animationPeriodMs * 3);
         }
     }
     else
     {
         // Draw X and "Miss!" text
-        wattron(m_ArenaPanelWindow, COLOR_PAIR(ColorPairs::RedOnDefault));
-        mvwaddch(m_ArenaPanelWindow, Components::Nameplate::Height + 1, arrowXPos, 'X');
-        wrefresh(m_ArenaPanelWindow);
-        Sleep(animationPeriodMs);
-        mvwprintw(m_ArenaPanelWindow, Components::Nameplate::Height + 1, arrowXPos - 6, "Miss!");
-        wrefresh(m_ArenaPanelWindow);
-
-        // Log
-        LogAttack(displayData, m_Battle.GetPlayer().GetName(), m_Battle.GetEnemy().GetName());
+        animation
+            .Do([&] {
+                arena.AttrOn(COLOR_PAIR(ColorPairs::RedOnDefault));
+                arena.AddChar(Components::Nameplate::Height + 1, arrowXPos, 'X');
+                arena.Present();
+            })
+            .Wait(animationPeriodMs)
+            .Do([&] {
+                arena.Print(Components::Nameplate::Height + 1, arrowXPos - 6, "Miss!");
+                arena.Present();
+
+                // Log
+                LogAttack(displayData, m_Battle.GetPlayer().GetName(), m_Battle.GetEnemy().GetName());
+            });
     }
 
     // Wait a bit, delay is shorter if hit due to animations
-    Sleep(postAttackDelayMs / (displayData.IsHit ? 2 : 0.75));
-    wattroff(m_ArenaPanelWindow, A_COLOR | A_BOLD);
-    wrefresh(m_ArenaPanelWindow);
+    animation.Wait(postAttackDelayMs / (displayData.IsHit ? 2 : 0.75)).Do([&] {
+        arena.AttrOff(A_COLOR | A_BOLD);
+        arena.Present();
+    });
 
+    m_Screen.PlayAnimation(animation);
     ClearProjectionArea();
 }
 
@@ -231,7 +442,7 @@ void BattleScreen::AnimatePlayerAttack(const Battle::ApplyEffectOnlySkillResult&
     // TODO
 }
 
-void BattleScreen::AnimateEnemyAttack(const Battle::AttackSkill::AttackSkillResult& displayData,
+void BattleScreen::AnimateEnemyAttack(const Battle::AttackSkillResult& displayData,
                                       const std::string& skillName)
 {
     // Constants
@@ -240,80 +451,99 @@ void BattleScreen::AnimateEnemyAttack(const Battle::AttackSkill::AttackSkillResu
     constexpr int postAttackDelayMs = 600;
     constexpr int preAttackDelayMs  = 400;
 
+    Render::RenderTarget& arena = *m_ArenaPanelWindow;
+    Animation::Sequence animation;
+
     // Skill name
-    std::string nameYell = skillName + "!";
-    wattron(m_ArenaPanelWindow, A_BOLD);
-    mvwaddstr(m_ArenaPanelWindow, Components::Nameplate::Height, arrowXPos + 2, nameYell.c_str());
-    wrefresh(m_ArenaPanelWindow);
-    Sleep(preAttackDelayMs);
+    animation
+        .Do([&] {
+            std::string nameYell = skillName + "!";
+            arena.AttrOn(A_BOLD);
+            arena.AddString(Components::Nameplate::Height, arrowXPos + 2, nameYell);
+            arena.Present();
+        })
+        .Wait(preAttackDelayMs);
 
     // Begin drawing the arrow
-    wattron(m_ArenaPanelWindow, COLOR_PAIR(ColorPairs::YellowOnDefault));
-
-    Sleep(animationPeriodMs);
-    mvwaddch(m_ArenaPanelWindow, Components::Nameplate::Height, arrowXPos, '|');
-    wrefresh(m_ArenaPanelWindow);
-    Sleep(animationPeriodMs);
+    animation.Do([&] { arena.AttrOn(COLOR_PAIR(ColorPairs::YellowOnDefault)); })
+        .Wait(animationPeriodMs)
+        .Do([&] {
+            arena.AddChar(Components::Nameplate::Height, arrowXPos, '|');
+            arena.Present();
+        })
+        .Wait(animationPeriodMs);
 
     if (displayData.IsHit)
     {
         // Finish drawing the arrow
-        mvwaddch(m_ArenaPanelWindow, Components::Nameplate::Height + 1, arrowXPos, '|');
-        wrefresh(m_ArenaPanelWindow);
-        Sleep(animationPeriodMs);
-
-        mvwaddch(m_ArenaPanelWindow, Components::Nameplate::Height + 2, arrowXPos, ACS_DARROW);
-        wrefresh(m_ArenaPanelWindow);
-        Sleep(animationPeriodMs);
-
-        // Damage number
-        short asteriskColor = displayData.Damage.GetDamageType().TextColor();
-        wattron(m_ArenaPanelWindow, COLOR_PAIR(asteriskColor));
-        mvwaddch(m_ArenaPanelWindow, Components::Nameplate::Height + 1, arrowXPos + 2, '*');
-        wattron(m_ArenaPanelWindow, COLOR_PAIR(ColorPairs::YellowOnDefault));
-        wprintw(m_ArenaPanelWindow, " %d ", displayData.Damage.GetValue());
-        waddch(m_ArenaPanelWindow, '*' | COLOR_PAIR(asteriskColor));
-
-        // "Crit!"
-        if (displayData.IsCrit)
-        {
-            mvwaddstr(m_ArenaPanelWindow, Components::Nameplate::Height + 2, arrowXPos + 2, "Critical!");
-        }
-        wrefresh(m_ArenaPanelWindow);
-
-        // Log
-        LogAttack(displayData, m_Battle.GetEnemy().GetName(), m_Battle.GetPlayer().GetName());
+        animation
+            .Do([&] {
+                arena.AddChar(Components::Nameplate::Height + 1, arrowXPos, '|');
+                arena.Present();
+            })
+            .Wait(animationPeriodMs)
+            .Do([&] {
+                arena.AddChar(Components::Nameplate::Height + 2, arrowXPos, ACS_DARROW);
+                arena.Present();
+            })
+            .Wait(animationPeriodMs)
+            .Do([&] {
+                // Damage number
+                short asteriskColor = displayData.Damage.GetDamageType().TextColor();
+                arena.AttrOn(COLOR_PAIR(asteriskColor));
+                arena.AddChar(Components::Nameplate::Height + 1, arrowXPos + 2, '*');
+                arena.AttrOn(COLOR_PAIR(ColorPairs::YellowOnDefault));
+                arena.Print(" %d ", displayData.Damage.GetValue());
+                arena.AddChar('*' | COLOR_PAIR(asteriskColor));
+
+                // "Crit!"
+                if (displayData.IsCrit)
+                {
+                    arena.AddString(Components::Nameplate::Height + 2, arrowXPos + 2, "Critical!");
+                }
+                arena.Present();
+
+                // Log
+                LogAttack(displayData, m_Battle.GetEnemy().GetName(), m_Battle.GetPlayer().GetName());
+            });
 
         // Nameplate animations
         if (displayData.Damage.GetValue() > 0)
         {
-            m_PlayerNameplate.FlashBorder(ColorPairs::RedOnDefault, 2, animationPeriodMs);
-            m_PlayerNameplate.HealthBar.RollBy(-displayData.Damage.GetValue());
+            animation.Then(m_PlayerNameplate.FlashBorderAnimation(ColorPairs::RedOnDefault, 2, animationPeriodMs))
+                .Then(m_PlayerNameplate.HealthBar.RollAnimation(-displayData.Damage.GetValue()));
         }
         else
         {
-            Sleep(animationPeriodMs * 3);
+            animation.Wait(animationPeriodMs * 3);
         }
     }
     else
     {
         // Draw X and "Miss!" text
-        wattron(m_ArenaPanelWindow, COLOR_PAIR(ColorPairs::RedOnDefault));
-        mvwaddch(m_ArenaPanelWindow, Components::Nameplate::Height + 1, arrowXPos, 'X');
-        wrefresh(m_ArenaPanelWindow);
-        Sleep(animationPeriodMs);
-        mvwprintw(m_ArenaPanelWindow, Components::Nameplate::Height + 1, arrowXPos + 2, "Miss!");
-        wrefresh(m_ArenaPanelWindow);
-
-        // Log
-        LogAttack(displayData, m_Battle.GetEnemy().GetName(), m_Battle.GetPlayer().GetName());
+        animation
+            .Do([&] {
+                arena.AttrOn(COLOR_PAIR(ColorPairs::RedOnDefault));
+                arena.AddChar(Components::Nameplate::Height + 1, arrowXPos, 'X');
+                arena.Present();
+            })
+            .Wait(animationPeriodMs)
+            .Do([&] {
+                arena.Print(Components::Nameplate::Height + 1, arrowXPos + 2, "Miss!");
+                arena.Present();
+
+                // Log
+                LogAttack(displayData, m_Battle.GetEnemy().GetName(), m_Battle.GetPlayer().GetName());
+            });
     }
 
     // Wait a bit, delay is shorter if hit due to animations
-    Sleep(postAttackDelayMs / (displayData.IsHit ? 2 : 0.75));
-    wattroff(m_ArenaPanelWindow, A_COLOR | A_BOLD);
-    wrefresh(m_ArenaPanelWindow);
+    animation.Wait(postAttackDelayMs / (displayData.IsHit ? 2 : 0.75)).Do([&] {
+        arena.AttrOff(A_COLOR | A_BOLD);
+        arena.Present();
+    });
 
+    m_Screen.PlayAnimation(animation);
     ClearProjectionArea();
 }
 
@@ -330,30 +560,28 @@ void BattleScreen::BattleEndMessage(BattleResult result)
     switch (result)
     {
     case BattleResult::Victory:
-        mvwprintw(m_BottomPanelWindow,
-                  1,
-                  2,
-                  "%s has defeated %s!",
-                  m_Battle.GetPlayer().GetName().c_str(),
-                  m_Battle.GetEnemy().GetName().c_str());
+        m_BottomPanelWindow->Print(1,
+                                   2,
+                                   "%s has defeated %s!",
+                                   m_Battle.GetPlayer().GetName().c_str(),
+                                   m_Battle.GetEnemy().GetName().c_str());
         break;
     case BattleResult::GameOver:
-        mvwprintw(m_BottomPanelWindow,
-                  1,
-                  2,
-                  "%s has been slain by %s...",
-                  m_Battle.GetPlayer().GetName().c_str(),
-                  m_Battle.GetEnemy().GetName().c_str());
+        m_BottomPanelWindow->Print(1,
+                                   2,
+                                   "%s has been slain by %s...",
+                                   m_Battle.GetPlayer().GetName().c_str(),
+                                   m_Battle.GetEnemy().GetName().c_str());
         break;
     case BattleResult::Escape:
-        mvwprintw(m_BottomPanelWindow, 1, 2, "%s runs away from the battle!", m_Battle.GetPlayer().GetName().c_str());
+        m_BottomPanelWindow->Print(1, 2, "%s runs away from the battle!", m_Battle.GetPlayer().GetName().c_str());
         break;
     default:
         break;
     }
-    wrefresh(m_BottomPanelWindow);
+    m_BottomPanelWindow->Present();
 
-    wgetch(m_BottomPanelWindow);
+    m_Screen.GetRenderBackend().ReadKey(*m_BottomPanelWindow);
 }
 
 void BattleScreen::DisplayPlayerStats()
@@ -362,58 +590,101 @@ void BattleScreen::DisplayPlayerStats()
 
     for (int i = 1; i <= 6; i++)
     {
-        mvwhline(m_StatPanelWindow, i, 1, ' ', LogPanelWidth - 2);
+        m_StatPanelWindow->HLine(i, 1, ' ', LogPanelWidth - 2);
     }
 
-    mvwaddstr(m_StatPanelWindow, 2, 5, "Strength: ");
-    wattron(m_StatPanelWindow, A_BOLD | COLOR_PAIR(ColorPairs::RedOnDefault));
-    wprintw(m_StatPanelWindow, "%9d", stats.Strength);
-    wattroff(m_StatPanelWindow, A_BOLD | A_COLOR);
+    m_StatPanelWindow->AddString(2, 5, "Strength: ");
+    m_StatPanelWindow->AttrOn(A_BOLD | COLOR_PAIR(ColorPairs::RedOnDefault));
+    m_StatPanelWindow->Print("%9d", stats.Strength);
+    m_StatPanelWindow->AttrOff(A_BOLD | A_COLOR);
 
-    mvwaddstr(m_StatPanelWindow, 3, 5, "Dexterity: ");
-    wattron(m_StatPanelWindow, A_BOLD | COLOR_PAIR(ColorPairs::GreenOnDefault));
-    wprintw(m_StatPanelWindow, "%8d", stats.Dexterity);
-    wattroff(m_StatPanelWindow, A_BOLD | A_COLOR);
+    m_StatPanelWindow->AddString(3, 5, "Dexterity: ");
+    m_StatPanelWindow->AttrOn(A_BOLD | COLOR_PAIR(ColorPairs::GreenOnDefault));
+    m_StatPanelWindow->Print("%8d", stats.Dexterity);
+    m_StatPanelWindow->AttrOff(A_BOLD | A_COLOR);
 
-    mvwaddstr(m_StatPanelWindow, 4, 5, "Sorcery: ");
-    wattron(m_StatPanelWindow, A_BOLD | COLOR_PAIR(ColorPairs::MagentaOnDefault));
-    wprintw(m_StatPanelWindow, "%10d", stats.Sorcery);
-    wattroff(m_StatPanelWindow, A_BOLD | A_COLOR);
+    m_StatPanelWindow->AddString(4, 5, "Sorcery: ");
+    m_StatPanelWindow->AttrOn(A_BOLD | COLOR_PAIR(ColorPairs::MagentaOnDefault));
+    m_StatPanelWindow->Print("%10d", stats.Sorcery);
+    m_StatPanelWindow->AttrOff(A_BOLD | A_COLOR);
 
-    mvwaddstr(m_StatPanelWindow, 5, 5, "Wisdom: ");
-    wattron(m_StatPanelWindow, A_BOLD | COLOR_PAIR(ColorPairs::BlueOnDefault));
-    wprintw(m_StatPanelWindow, "%11d", stats.Wisdom);
-    wattroff(m_StatPanelWindow, A_BOLD | A_COLOR);
+    m_StatPanelWindow->AddString(5, 5, "Wisdom: ");
+    m_StatPanelWindow->AttrOn(A_BOLD | COLOR_PAIR(ColorPairs::BlueOnDefault));
+    m_StatPanelWindow->Print("%11d", stats.Wisdom);
+    m_StatPanelWindow->AttrOff(A_BOLD | A_COLOR);
 
-    wrefresh(m_StatPanelWindow);
+    m_StatPanelWindow->Present();
 }
 
 void BattleScreen::DrawSkillHoverThumbnailBase(const Battle::Skill& skill)
 {
     // Borders
-    mvwvline(m_BottomPanelWindow, 1, SkillHoverThumbnailXPos, ACS_VLINE, BottomPanelHeight - 1);
-    mvwaddch(m_BottomPanelWindow, 0, SkillHoverThumbnailXPos, ACS_TTEE);
-    mvwaddch(m_BottomPanelWindow, BottomPanelHeight - 1, SkillHoverThumbnailXPos, ACS_BTEE);
+    m_BottomPanelWindow->VLine(1, SkillHoverThumbnailXPos, ACS_VLINE, BottomPanelHeight - 1);
+    m_BottomPanelWindow->AddChar(0, SkillHoverThumbnailXPos, ACS_TTEE);
+    m_BottomPanelWindow->AddChar(BottomPanelHeight - 1, SkillHoverThumbnailXPos, ACS_BTEE);
 
     // Thumbnail title
     std::string title = " " + skill.GetName() + " ";
-    wattron(m_BottomPanelWindow, A_REVERSE);
-    mvwaddstr(m_BottomPanelWindow, 0, (SkillHoverThumbnailXPos + ArenaPanelWidth - title.size()) / 2, title.c_str());
-    wattroff(m_BottomPanelWindow, A_REVERSE);
+    m_BottomPanelWindow->AttrOn(A_REVERSE);
+    m_BottomPanelWindow->AddString(0, (SkillHoverThumbnailXPos + ArenaPanelWidth - title.size()) / 2, title);
+    m_BottomPanelWindow->AttrOff(A_REVERSE);
 
     // Cost
     int manaCost = 0;
     if (manaCost > 0)
     {
-        mvwaddstr(m_BottomPanelWindow, 5, SkillHoverThumbnailXPos + 2, "Cost: ");
-        wattron(m_BottomPanelWindow, COLOR_PAIR(ColorPairs::BlueOnDefault) | A_BOLD);
-        wprintw(m_BottomPanelWindow, "%d", manaCost);
-        wattroff(m_BottomPanelWindow, A_COLOR | A_BOLD);
+        m_BottomPanelWindow->AddString(5, SkillHoverThumbnailXPos + 2, "Cost: ");
+        m_BottomPanelWindow->AttrOn(COLOR_PAIR(ColorPairs::BlueOnDefault) | A_BOLD);
+        m_BottomPanelWindow->Print("%d", manaCost);
+        m_BottomPanelWindow->AttrOff(A_COLOR | A_BOLD);
     }
     // Flavor text
-    mvwaddstr(m_BottomPanelWindow, 6, SkillHoverThumbnailXPos + 2, skill.GetFlavorText().c_str());
+    m_BottomPanelWindow->AddString(6, SkillHoverThumbnailXPos + 2, skill.GetFlavorText());
+
+    m_BottomPanelWindow->Present();
+}
+
+void BattleScreen::PrintSkillHoverThumbnailInfo(const Battle::ApplyEffectOnlySkillBase& applyEffectOnlySkill)
+{
+    DrawSkillHoverThumbnailBase(applyEffectOnlySkill);
+
+    // Target type
+    std::string targetTypeName;
+    short targetTypeColor;
+    switch (applyEffectOnlySkill.GetTargetType())
+    {
+    case Battle::Skill::Target::Opponent:
+        targetTypeName = "Opponent";
+        targetTypeColor = ColorPairs::RedOnDefault;
+        break;
+    case Battle::Skill::Target::Self:
+        targetTypeName = "Self";
+        targetTypeColor = ColorPairs::GreenOnDefault;
+        break;
+    case Battle::Skill::Target::Choice:
+        targetTypeName = "Choice";
+        targetTypeColor = ColorPairs::CyanOnDefault;
+        break;
+    case Battle::Skill::Target::Both:
+        targetTypeName = "Both";
+        targetTypeColor = ColorPairs::YellowOnDefault;
+        break;
+    }
+    m_BottomPanelWindow->AddString(1, SkillHoverThumbnailXPos + 2, "Target ");
+    m_BottomPanelWindow->AttrOn(A_BOLD | COLOR_PAIR(targetTypeColor));
+    m_BottomPanelWindow->AddString(targetTypeName);
+    m_BottomPanelWindow->AttrOff(A_BOLD | A_COLOR);
+
+    auto descriptionLines = SplitStringIntoLines(applyEffectOnlySkill.GetEffectDescription(),
+                                                 ArenaPanelWidth - SkillHoverThumbnailXPos - 4);
+    int counter           = 0;
+    for (const auto& line : descriptionLines)
+    {
+        m_BottomPanelWindow->AddString(3 + counter, SkillHoverThumbnailXPos + 2, line);
+        counter++;
+    }
 
-    wrefresh(m_BottomPanelWindow);
+    m_BottomPanelWindow->Present();
 }
 
 void BattleScreen::PrintSkillHoverThumbnailInfo(const Battle::AttackSkill& attackSkill)
@@ -426,23 +697,23 @@ void BattleScreen::PrintSkillHoverThumbnailInfo(const Battle::AttackSkill& attac
 
     // Weapon
     std::string weaponName = "Unarmed"; // TODO: add once items are added
-    mvwaddstr(m_BottomPanelWindow, 1, SkillHoverThumbnailXPos + 2, weaponName.c_str());
+    m_BottomPanelWindow->AddString(1, SkillHoverThumbnailXPos + 2, weaponName);
 
     // Attack damage
-    wattron(m_BottomPanelWindow, A_BOLD | COLOR_PAIR(attackSkill.GetDamageType().TextColor()));
-    mvwprintw(m_BottomPanelWindow, 2, SkillHoverThumbnailXPos + 2, "%d", damageRange.first);
-    wattroff(m_BottomPanelWindow, A_BOLD | A_COLOR);
-    waddstr(m_BottomPanelWindow, " - ");
-    wattron(m_BottomPanelWindow, A_BOLD | COLOR_PAIR(attackSkill.GetDamageType().TextColor()));
-    wprintw(m_BottomPanelWindow, "%d ", damageRange.second);
-    waddstr(m_BottomPanelWindow, attackSkill.GetDamageType().ToString().c_str());
-    wattroff(m_BottomPanelWindow, A_BOLD | A_COLOR);
+    m_BottomPanelWindow->AttrOn(A_BOLD | COLOR_PAIR(attackSkill.GetDamageType().TextColor()));
+    m_BottomPanelWindow->Print(2, SkillHoverThumbnailXPos + 2, "%d", damageRange.first);
+    m_BottomPanelWindow->AttrOff(A_BOLD | A_COLOR);
+    m_BottomPanelWindow->AddString(" - ");
+    m_BottomPanelWindow->AttrOn(A_BOLD | COLOR_PAIR(attackSkill.GetDamageType().TextColor()));
+    m_BottomPanelWindow->Print("%d ", damageRange.second);
+    m_BottomPanelWindow->AddString(attackSkill.GetDamageType().ToString());
+    m_BottomPanelWindow->AttrOff(A_BOLD | A_COLOR);
 
     // Hit & crit
     int hitChance  = attackSkill.CalculateHitChance(m_Battle.GetPlayerProfile(), m_Battle.GetEnemyProfile());
     int critChance = attackSkill.CalculateCritChance(m_Battle.GetPlayerProfile(), m_Battle.GetEnemyProfile());
-    mvwaddstr(m_BottomPanelWindow, 4, SkillHoverThumbnailXPos + 2, "Hit:");
-    mvwaddstr(m_BottomPanelWindow, 4, SkillHoverThumbnailXPos + 16, "Crit:");
+    m_BottomPanelWindow->AddString(4, SkillHoverThumbnailXPos + 2, "Hit:");
+    m_BottomPanelWindow->AddString(4, SkillHoverThumbnailXPos + 16, "Crit:");
     short hitColor  = ColorPairs::GreenOnDefault;
     short critColor = ColorPairs::GreenOnDefault;
 
@@ -450,18 +721,18 @@ void BattleScreen::PrintSkillHoverThumbnailInfo(const Battle::AttackSkill& attac
         hitColor = ColorPairs::YellowOnDefault;
     if (hitChance <= 40)
         hitColor = ColorPairs::RedOnDefault;
-    wattron(m_BottomPanelWindow, COLOR_PAIR(hitColor) | A_BOLD);
-    mvwprintw(m_BottomPanelWindow, 4, SkillHoverThumbnailXPos + 7, "%3d%%", hitChance);
+    m_BottomPanelWindow->AttrOn(COLOR_PAIR(hitColor) | A_BOLD);
+    m_BottomPanelWindow->Print(4, SkillHoverThumbnailXPos + 7, "%3d%%", hitChance);
 
     if (critChance <= 25)
         critColor = ColorPairs::YellowOnDefault;
     if (critChance <= 10)
         critColor = ColorPairs::RedOnDefault;
-    wattron(m_BottomPanelWindow, COLOR_PAIR(critColor));
-    mvwprintw(m_BottomPanelWindow, 4, SkillHoverThumbnailXPos + 22, "%3d%%", critChance);
-    wattroff(m_BottomPanelWindow, A_COLOR | A_BOLD);
+    m_BottomPanelWindow->AttrOn(COLOR_PAIR(critColor));
+    m_BottomPanelWindow->Print(4, SkillHoverThumbnailXPos + 22, "%3d%%", critChance);
+    m_BottomPanelWindow->AttrOff(A_COLOR | A_BOLD);
 
-    wrefresh(m_BottomPanelWindow);
+    m_BottomPanelWindow->Present();
 }
 
 void BattleScreen::AppendToLog(const std::string& message)
@@ -470,38 +741,49 @@ void BattleScreen::AppendToLog(const std::string& message)
     m_LogWindow.RefreshContent();
 }
 
+void BattleScreen::ScrollLog(int direction)
+{
+    if (direction < 0)
+        m_LogWindow.PageUp();
+    else
+        m_LogWindow.PageDown();
+    m_LogWindow.RefreshContent();
+}
+
 void BattleScreen::DisplayPlayerActiveEffects()
 {
-    werase(m_PlayerActiveEffectsWindow);
+    m_PlayerActiveEffectsWindow->Erase();
     bool first          = true;
     const auto& effects = m_Battle.GetPlayerProfile().ActiveEffects;
-    for (const auto& effect : effects)
+    for (const auto& activeEffect : effects)
     {
+        const auto& effect = Battle::AsEffect(activeEffect);
         if (!first)
-            waddstr(m_PlayerActiveEffectsWindow, ", ");
+            m_PlayerActiveEffectsWindow->AddString(", ");
         else
-            mvwaddstr(m_PlayerActiveEffectsWindow, 0, 1, "Effects: ");
+            m_PlayerActiveEffectsWindow->AddString(0, 1, "Effects: ");
         first = false;
-        wprintw(m_PlayerActiveEffectsWindow, "%s(%d)", effect->GetName().c_str(), effect->GetRemainingDuration());
+        m_PlayerActiveEffectsWindow->Print("%s(%d)", effect.GetName(), effect.GetRemainingDuration());
     }
-    wrefresh(m_PlayerActiveEffectsWindow);
+    m_PlayerActiveEffectsWindow->Present();
 }
 
 void BattleScreen::DisplayEnemyActiveEffects()
 {
-    werase(m_EnemyActiveEffectsWindow);
+    m_EnemyActiveEffectsWindow->Erase();
     bool first          = true;
     const auto& effects = m_Battle.GetEnemyProfile().ActiveEffects;
-    for (const auto& effect : effects)
+    for (const auto& activeEffect : effects)
     {
+        const auto& effect = Battle::AsEffect(activeEffect);
         if (!first)
-            waddstr(m_EnemyActiveEffectsWindow, ", ");
+            m_EnemyActiveEffectsWindow->AddString(", ");
         else
-            mvwaddstr(m_EnemyActiveEffectsWindow, 0, 1, "Effects: ");
+            m_EnemyActiveEffectsWindow->AddString(0, 1, "Effects: ");
         first = false;
-        wprintw(m_EnemyActiveEffectsWindow, "%s(%d)", effect->GetName().c_str(), effect->GetRemainingDuration());
+        m_EnemyActiveEffectsWindow->Print("%s(%d)", effect.GetName(), effect.GetRemainingDuration());
     }
-    wrefresh(m_EnemyActiveEffectsWindow);
+    m_EnemyActiveEffectsWindow->Present();
 }
 
 void BattleScreen::DrawScreenLayout()
@@ -514,8 +796,8 @@ void BattleScreen::DrawScreenLayout()
 
 void BattleScreen::DrawArenaPanel()
 {
-    werase(m_ArenaPanelWindow);
-    wrefresh(m_ArenaPanelWindow);
+    m_ArenaPanelWindow->Erase();
+    m_ArenaPanelWindow->Present();
 
     m_PlayerNameplate.Draw();
     m_EnemyNameplate.Draw();
@@ -523,105 +805,114 @@ void BattleScreen::DrawArenaPanel()
 
 void BattleScreen::DrawLogPanel()
 {
-    WINDOW* logWindow = m_LogWindow.Draw();
+    Render::RenderTarget& logWindow = m_LogWindow.Draw();
     // Connect borders with the stat panel
-    mvwhline(logWindow, TopPanelHeight - 1, 1, ' ', LogPanelWidth - 2);
-    mvwaddch(logWindow, TopPanelHeight - 1, 0, ACS_VLINE);
-    mvwaddch(logWindow, TopPanelHeight - 1, LogPanelWidth - 1, ACS_VLINE);
-    wrefresh(logWindow);
+    logWindow.HLine(TopPanelHeight - 1, 1, ' ', LogPanelWidth - 2);
+    logWindow.AddChar(TopPanelHeight - 1, 0, ACS_VLINE);
+    logWindow.AddChar(TopPanelHeight - 1, LogPanelWidth - 1, ACS_VLINE);
+    logWindow.Present();
 }
 
 void BattleScreen::DrawBottomPanel()
 {
-    werase(m_BottomPanelWindow);
-    wborder(m_BottomPanelWindow, 0, ' ', 0, 0, 0, ACS_HLINE, 0, ACS_HLINE);
-    wrefresh(m_BottomPanelWindow);
+    m_BottomPanelWindow->Erase();
+    m_BottomPanelWindow->Border(0, ' ', 0, 0, 0, ACS_HLINE, 0, ACS_HLINE);
+    m_BottomPanelWindow->Present();
 }
 
 void BattleScreen::DrawStatPanel()
 {
-    wborder(m_StatPanelWindow, 0, 0, 0, 0, ACS_PLUS, ACS_RTEE, ACS_BTEE, 0);
-    wattron(m_StatPanelWindow, A_REVERSE);
-    Screen::PrintCenter(m_StatPanelWindow, " About " + m_Battle.GetPlayer().GetName() + " ", 0);
-    wattroff(m_StatPanelWindow, A_REVERSE);
+    m_StatPanelWindow->Border(0, 0, 0, 0, ACS_PLUS, ACS_RTEE, ACS_BTEE, 0);
+    m_StatPanelWindow->AttrOn(A_REVERSE);
+    m_StatPanelWindow->PrintCenter(0, " About " + m_Battle.GetPlayer().GetName() + " ");
+    m_StatPanelWindow->AttrOff(A_REVERSE);
     DisplayPlayerStats();
-    wrefresh(m_StatPanelWindow);
+    m_StatPanelWindow->Present();
 }
 
 void BattleScreen::ClearBottomPanel()
 {
     for (int i = 1; i < BottomPanelHeight - 1; i++)
     {
-        mvwhline(m_BottomPanelWindow, i, 1, ' ', ArenaPanelWidth - 2);
+        m_BottomPanelWindow->HLine(i, 1, ' ', ArenaPanelWidth - 2);
     }
-    wrefresh(m_BottomPanelWindow);
+    m_BottomPanelWindow->Present();
 }
 
 void BattleScreen::AnimateBattleStart()
 {
     constexpr int animationPeriodMs = 120;
 
-    WINDOW* tempSideWindow = newwin(Screen::ScreenHeight, LogPanelWidth, 0, ArenaPanelWidth);
-    box(tempSideWindow, 0, 0);
-    wrefresh(tempSideWindow);
-    delwin(tempSideWindow);
+    auto& backend       = m_Screen.GetRenderBackend();
+    auto tempSideWindow = backend.CreateTarget(Screen::ScreenHeight, LogPanelWidth, 0, ArenaPanelWidth);
+    tempSideWindow->Box();
+    tempSideWindow->Present();
+    tempSideWindow.reset();
 
-    WINDOW* tempBottomWindow = newwin(BottomPanelHeight - 3, Screen::ScreenWidth, TopPanelHeight + 3, 0);
+    auto tempBottomWindow = backend.CreateTarget(BottomPanelHeight - 3, Screen::ScreenWidth, TopPanelHeight + 3, 0);
 
+    Animation::Sequence animation;
     for (int i = 3; i >= 0; i--)
     {
-        werase(tempBottomWindow);
-        mvwin(tempBottomWindow, TopPanelHeight + i, 0);
-        wresize(tempBottomWindow, BottomPanelHeight - i, Screen::ScreenWidth);
-        box(tempBottomWindow, 0, 0);
-        mvwaddch(tempBottomWindow, 0, ArenaPanelWidth, ACS_PLUS);
-        mvwaddch(tempBottomWindow, 0, Screen::ScreenWidth - 1, ACS_RTEE);
-        mvwvline(tempBottomWindow, 1, ArenaPanelWidth, ACS_VLINE, BottomPanelHeight - i - 2);
-        mvwaddch(tempBottomWindow, BottomPanelHeight - i - 1, ArenaPanelWidth, ACS_BTEE);
-
-        wrefresh(tempBottomWindow);
+        animation.Do([&, i] {
+            tempBottomWindow->Erase();
+            tempBottomWindow->MoveTo(TopPanelHeight + i, 0);
+            tempBottomWindow->Resize(BottomPanelHeight - i, Screen::ScreenWidth);
+            tempBottomWindow->Box();
+            tempBottomWindow->AddChar(0, ArenaPanelWidth, ACS_PLUS);
+            tempBottomWindow->AddChar(0, Screen::ScreenWidth - 1, ACS_RTEE);
+            tempBottomWindow->VLine(1, ArenaPanelWidth, ACS_VLINE, BottomPanelHeight - i - 2);
+            tempBottomWindow->AddChar(BottomPanelHeight - i - 1, ArenaPanelWidth, ACS_BTEE);
+
+            tempBottomWindow->Present();
+        });
         if (i > 0)
-            Sleep(animationPeriodMs);
+            animation.Wait(animationPeriodMs);
     }
-    delwin(tempBottomWindow);
+    m_Screen.PlayAnimation(animation);
 }
 
 void BattleScreen::AnimateBattleEnd()
 {
     constexpr int animationPeriodMs = 120;
 
-    WINDOW* tempSideWindow = newwin(Screen::ScreenHeight, LogPanelWidth, 0, ArenaPanelWidth);
-    box(tempSideWindow, 0, 0);
-    wrefresh(tempSideWindow);
+    auto& backend       = m_Screen.GetRenderBackend();
+    auto tempSideWindow = backend.CreateTarget(Screen::ScreenHeight, LogPanelWidth, 0, ArenaPanelWidth);
+    tempSideWindow->Box();
+    tempSideWindow->Present();
 
-    WINDOW* tempBottomWindow = newwin(BottomPanelHeight - 3, Screen::ScreenWidth, TopPanelHeight + 3, 0);
+    auto tempBottomWindow = backend.CreateTarget(BottomPanelHeight - 3, Screen::ScreenWidth, TopPanelHeight + 3, 0);
 
+    Animation::Sequence animation;
     for (int i = 0; i < 4; i++)
     {
-        mvwhline(tempBottomWindow, 0, 0, ' ', Screen::ScreenWidth);
-        wrefresh(tempBottomWindow);
-        wresize(tempBottomWindow, BottomPanelHeight - i, Screen::ScreenWidth);
-        mvwin(tempBottomWindow, TopPanelHeight + i, 0);
-        box(tempSideWindow, 0, 0);
-        wrefresh(tempSideWindow);
-        box(tempBottomWindow, 0, 0);
-        mvwaddch(tempBottomWindow, 0, ArenaPanelWidth, ACS_PLUS);
-        mvwaddch(tempBottomWindow, 0, Screen::ScreenWidth - 1, ACS_RTEE);
-        mvwvline(tempBottomWindow, 1, ArenaPanelWidth, ACS_VLINE, BottomPanelHeight - i - 2);
-        mvwaddch(tempBottomWindow, BottomPanelHeight - i - 1, ArenaPanelWidth, ACS_BTEE);
-
-        wrefresh(tempBottomWindow);
-        Sleep(animationPeriodMs);
+        animation
+            .Do([&, i] {
+                tempBottomWindow->HLine(0, 0, ' ', Screen::ScreenWidth);
+                tempBottomWindow->Present();
+                tempBottomWindow->Resize(BottomPanelHeight - i, Screen::ScreenWidth);
+                tempBottomWindow->MoveTo(TopPanelHeight + i, 0);
+                tempSideWindow->Box();
+                tempSideWindow->Present();
+                tempBottomWindow->Box();
+                tempBottomWindow->AddChar(0, ArenaPanelWidth, ACS_PLUS);
+                tempBottomWindow->AddChar(0, Screen::ScreenWidth - 1, ACS_RTEE);
+                tempBottomWindow->VLine(1, ArenaPanelWidth, ACS_VLINE, BottomPanelHeight - i - 2);
+                tempBottomWindow->AddChar(BottomPanelHeight - i - 1, ArenaPanelWidth, ACS_BTEE);
+
+                tempBottomWindow->Present();
+            })
+            .Wait(animationPeriodMs);
     }
-    werase(tempBottomWindow);
-    wrefresh(tempBottomWindow);
-    werase(tempSideWindow);
-    wrefresh(tempSideWindow);
-    delwin(tempSideWindow);
-    delwin(tempBottomWindow);
+    m_Screen.PlayAnimation(animation);
+
+    tempBottomWindow->Erase();
+    tempBottomWindow->Present();
+    tempSideWindow->Erase();
+    tempSideWindow->Present();
 }
 
-void BattleScreen::LogAttack(const Battle::AttackSkill::AttackSkillResult& result,
+void BattleScreen::LogAttack(const Battle::AttackSkillResult& result,
                              const std::string& attacker,
                              const std::string& target)
 {
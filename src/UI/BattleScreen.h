@@ -3,23 +3,26 @@
 #include "Battle/ApplyEffectOnlySkill.h"
 #include "Battle/AttackSkill.h"
 #include "Battle/Battle.h"
+#include "Battle/BattleObserver.h"
+#include "Battle/OutcomeCache.h"
+#include "Battle/PlayerDecision.h"
 #include "Battle/Skill.h"
 #include "ColorPairs.h"
 #include "Components/LogWindow.h"
 #include "Components/Nameplate.h"
-#include "Misc/Utils.h"
+#include "Render/RenderTarget.h"
 #include "Screen.h"
 #include "Subscreen.h"
-
-namespace Battle
-{
-class ApplyEffectOnlySkillResult;
-}
+#include <array>
+#include <map>
 
 namespace UI
 {
 
-class BattleScreen : public Subscreen
+/**
+ * @brief Battle UI, which presents the battle and lets the player make their choices via menus
+ */
+class BattleScreen : public Subscreen, public Battle::BattleObserver, public Battle::PlayerDecision
 {
 public:
     /**
@@ -85,7 +88,7 @@ public:
      * @return int option code
      */
     int SelectWithHoverAction(const std::map<int, std::string>& options,
-                              std::function<void(std::map<int, std::string>::iterator)> hoverAction = {});
+                              std::function<void(std::map<int, std::string>::const_iterator)> hoverAction = {});
 
     /**
      * @brief Write a message in the upper left corner of the bottom panel
@@ -94,6 +97,13 @@ public:
      */
     void PostMessage(const std::string& message);
 
+    /**
+     * @brief Show the projection and thumbnail of the skill hovered over in the skill menu
+     *
+     * @param skill skill being hovered over
+     */
+    void ShowSkillHover(const Battle::Skill& skill);
+
     /**
      * @brief Project an attack against the enemy
      *
@@ -116,7 +126,7 @@ public:
      *
      * @param displayData result data to display
      */
-    void AnimatePlayerAttack(const Battle::AttackSkill::AttackSkillResult& displayData);
+    void AnimatePlayerAttack(const Battle::AttackSkillResult& displayData);
 
     /**
      * @brief Animate a player attack
@@ -131,7 +141,7 @@ public:
      * @param displayData result data to display
      * @param skillName name of skill used
      */
-    void AnimateEnemyAttack(const Battle::AttackSkill::AttackSkillResult& displayData, const std::string& skillName);
+    void AnimateEnemyAttack(const Battle::AttackSkillResult& displayData, const std::string& skillName);
 
     /**
      * @brief Animate an enemy attack
@@ -160,48 +170,12 @@ public:
      */
     void DrawSkillHoverThumbnailBase(const Battle::Skill& skill);
 
-    template<typename EffectType>
-    void PrintSkillHoverThumbnailInfo(const Battle::ApplyEffectOnlySkill<EffectType>& applyEffectOnlySkill)
-    {
-        DrawSkillHoverThumbnailBase(applyEffectOnlySkill);
-
-        // Target type
-        std::string targetTypeName;
-        short targetTypeColor;
-        switch (applyEffectOnlySkill.GetTargetType())
-        {
-        case Battle::Skill::Target::Opponent:
-            targetTypeName = "Opponent";
-            targetTypeColor = ColorPairs::RedOnDefault;
-            break;
-        case Battle::Skill::Target::Self:
-            targetTypeName = "Self";
-            targetTypeColor = ColorPairs::GreenOnDefault;
-            break;
-        case Battle::Skill::Target::Choice:
-            targetTypeName = "Choice";
-            targetTypeColor = ColorPairs::CyanOnDefault;
-            break;
-        case Battle::Skill::Target::Both:
-            targetTypeName = "Both";
-            targetTypeColor = ColorPairs::YellowOnDefault;
-            break;
-        }
-        mvwaddstr(m_BottomPanelWindow, 1, SkillHoverThumbnailXPos + 2, "Target ");
-        wattron(m_BottomPanelWindow, A_BOLD | COLOR_PAIR(targetTypeColor));
-        waddstr(m_BottomPanelWindow, targetTypeName.c_str());
-        wattroff(m_BottomPanelWindow, A_BOLD | A_COLOR);
-
-        auto descriptionLines = SplitStringIntoLines(applyEffectOnlySkill.GetEffectDescription(), ArenaPanelWidth - SkillHoverThumbnailXPos - 4);
-        int counter           = 0;
-        for (const auto& line : descriptionLines)
-        {
-            mvwaddstr(m_BottomPanelWindow, 3 + counter, SkillHoverThumbnailXPos + 2, line.c_str());
-            counter++;
-        }
-
-        wrefresh(m_BottomPanelWindow);
-    }
+    /**
+     * @brief Display additional thumbnail info for a given skill type
+     *
+     * @param applyEffectOnlySkill apply-effect-only skill being hovered over
+     */
+    void PrintSkillHoverThumbnailInfo(const Battle::ApplyEffectOnlySkillBase& applyEffectOnlySkill);
 
     /**
      * @brief Display additional thumbnail info for a given skill type
@@ -227,22 +201,111 @@ public:
      */
     void DisplayEnemyActiveEffects();
 
+    /**
+     * @brief Let the player choose a skill via the action and skill menus
+     *
+     * @param battle battle in progress
+     * @return Battle::Skill* chosen skill, or null to escape
+     */
+    virtual Battle::Skill* ChooseSkill(const Battle::Battle& battle) override;
+
+    /**
+     * @brief Let the player choose the enemy to target via a menu if more than one is still standing
+     *
+     * @param battle battle in progress
+     * @param skill chosen skill
+     * @return size_t combatant index of the chosen enemy
+     */
+    virtual size_t ChooseTarget(const Battle::Battle& battle, const Battle::Skill& skill) override;
+
+    /**
+     * @brief Display the updated active effects
+     */
+    virtual void OnEffectsUpdated() override;
+
+    /**
+     * @brief Announce the skill about to be used
+     *
+     * @param skill chosen skill
+     * @param user combatant index of the user
+     */
+    virtual void OnSkillChosen(const Battle::Skill& skill, size_t user) override;
+
+    /**
+     * @brief Animate the result of the skill usage between the player and the enemy on the nameplate, or log the
+     * result of any other one
+     *
+     * @param skill applied skill
+     * @param result result of the skill usage
+     * @param user combatant index of the user
+     * @param target combatant index of the target
+     */
+    virtual void OnSkillApplied(const Battle::Skill& skill,
+                                const Battle::SkillResult& result,
+                                size_t user,
+                                size_t target) override;
+
+    /**
+     * @brief Display the battle end message
+     *
+     * @param result battle result
+     */
+    virtual void OnBattleEnd(Battle::Battle::Result result) override;
+
 private:
     /**
      * @brief X position of the skill hover thumbnail
      */
     constexpr static const int SkillHoverThumbnailXPos = 23;
 
+    /**
+     * @brief Action menu code of escaping
+     */
+    constexpr static const int EscapeCode = 20;
+
+    /**
+     * @brief Skill menu code of going back to the action menu
+     */
+    constexpr static const int RethinkCode = 1000;
+
     Battle::Battle& m_Battle;
-    WINDOW* m_ArenaPanelWindow;
-    WINDOW* m_BottomPanelWindow;
-    WINDOW* m_StatPanelWindow;
-    WINDOW* m_PlayerActiveEffectsWindow;
-    WINDOW* m_EnemyActiveEffectsWindow;
+    std::unique_ptr<Render::RenderTarget> m_ArenaPanelWindow;
+    std::unique_ptr<Render::RenderTarget> m_BottomPanelWindow;
+    std::unique_ptr<Render::RenderTarget> m_StatPanelWindow;
+    std::unique_ptr<Render::RenderTarget> m_PlayerActiveEffectsWindow;
+    std::unique_ptr<Render::RenderTarget> m_EnemyActiveEffectsWindow;
     Components::Nameplate m_PlayerNameplate;
     Components::Nameplate m_EnemyNameplate;
     Components::LogWindow m_LogWindow;
 
+    /**
+     * @brief Outcome distributions of the attacks projected while hovering over the skill menu
+     */
+    Battle::OutcomeCache m_OutcomeCache;
+
+    /**
+     * @brief Action menu options, built once per battle from the player's skill categories
+     */
+    std::map<int, std::string> m_ActionOptions;
+
+    /**
+     * @brief Skill menu options per category, keyed by index into the category's skills
+     */
+    std::array<std::map<int, std::string>, Battle::Skill::CategoryCount> m_SkillOptions;
+
+    /**
+     * @brief Build the action and skill menu options
+     */
+    void BuildMenuOptions();
+
+    /**
+     * @brief Check if a combatant is shown on one of the nameplates
+     *
+     * @param index combatant index
+     * @return true if the combatant is the player or the first enemy
+     */
+    bool IsOnNameplate(size_t index) const;
+
     /**
      * @brief Draw the layout of the panels
      */
@@ -258,6 +321,13 @@ private:
      */
     void DrawLogPanel();
 
+    /**
+     * @brief Page through the battle log history
+     *
+     * @param direction -1 to page towards older messages, 1 towards newer ones
+     */
+    void ScrollLog(int direction);
+
     /**
      * @brief Draw the bottom panel
      */
@@ -286,7 +356,7 @@ private:
     /**
      * @brief Log an attack
      */
-    void LogAttack(const Battle::AttackSkill::AttackSkillResult& result,
+    void LogAttack(const Battle::AttackSkillResult& result,
                    const std::string& attacker,
                    const std::string& target);
 };
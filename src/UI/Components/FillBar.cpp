@@ -6,7 +6,7 @@
 namespace UI::Components
 {
 
-FillBar::FillBar(WINDOW* window,
+FillBar::FillBar(Render::RenderTarget& parent,
                  int size,
                  int xPos,
                  int yPos,
@@ -15,7 +15,7 @@ FillBar::FillBar(WINDOW* window,
                  short fillColorPair,
                  bool showText,
                  bool textInPercent)
-    : m_Window(derwin(window, 1, size, yPos, xPos)),
+    : m_Target(parent.CreateSubTarget(1, size, yPos, xPos)),
       m_Size(size),
       m_Value(value),
       m_MaxValue(maxValue),
@@ -25,28 +25,25 @@ FillBar::FillBar(WINDOW* window,
 {
 }
 
-FillBar::~FillBar()
-{
-    delwin(m_Window);
-}
+FillBar::~FillBar() = default;
 
 void FillBar::Draw(int highlightFillBeyondValue)
 {
-    werase(m_Window);
-    mvwaddch(m_Window, 0, 0, '[' | A_BOLD);
-    mvwaddch(m_Window, 0, m_Size - 1, ']' | A_BOLD);
+    m_Target->Erase();
+    m_Target->AddChar(0, 0, '[' | A_BOLD);
+    m_Target->AddChar(0, m_Size - 1, ']' | A_BOLD);
 
     if (m_MaxValue == 0)
     {
-        mvwaddstr(m_Window, 0, (m_Size - 3) / 2, "N/A");
-        wrefresh(m_Window);
+        m_Target->AddString(0, (m_Size - 3) / 2, "N/A");
+        m_Target->Present();
         return;
     }
 
     if (m_FillColorPair != 0)
-        wattron(m_Window, COLOR_PAIR(m_FillColorPair) | A_BOLD);
+        m_Target->AttrOn(COLOR_PAIR(m_FillColorPair) | A_BOLD);
     else
-        wattron(m_Window, A_REVERSE);
+        m_Target->AttrOn(A_REVERSE);
 
     std::string text         = TextRepresentation();
     int filledLength         = FilledLength();
@@ -63,25 +60,25 @@ void FillBar::Draw(int highlightFillBeyondValue)
     {
         if (i == nonHighlightedLength)
         {
-            wattroff(m_Window, A_COLOR);
-            wattron(m_Window, A_REVERSE);
+            m_Target->AttrOff(A_COLOR);
+            m_Target->AttrOn(A_REVERSE);
         }
 
         if (i == filledLength)
-            wattroff(m_Window, A_COLOR | A_REVERSE);
+            m_Target->AttrOff(A_COLOR | A_REVERSE);
 
         if (i < textBeginPos || i >= textBeginPos + static_cast<int>(text.size()))
         {
-            mvwaddch(m_Window, 0, i + 1, ' ');
+            m_Target->AddChar(0, i + 1, ' ');
         }
         else
         {
-            mvwaddch(m_Window, 0, i + 1, text[i - textBeginPos]);
+            m_Target->AddChar(0, i + 1, text[i - textBeginPos]);
         }
     }
 
-    wattroff(m_Window, A_COLOR | A_REVERSE | A_BOLD);
-    wrefresh(m_Window);
+    m_Target->AttrOff(A_COLOR | A_REVERSE | A_BOLD);
+    m_Target->Present();
 }
 
 void FillBar::MoveBy(int value)
@@ -94,29 +91,18 @@ void FillBar::MoveBy(int value)
     Draw();
 }
 
-void FillBar::RollBy(int value)
+std::unique_ptr<Animation::Animation> FillBar::RollAnimation(int value)
 {
-    constexpr int variableDelayMs = 160;
-    int targetValue               = m_Value + value;
-    if (targetValue < 0)
-        targetValue = 0;
-    else if (targetValue > m_MaxValue)
-        targetValue = m_MaxValue;
-    int sgn = value >= 0 ? 1 : -1;
-
-    while (m_Value != targetValue)
-    {
-        int diff = abs(m_Value - targetValue);
-        m_Value += diff != 1 ? sgn * ceil(diff / 7.5) : sgn;
-
-        if (sgn < 0 && m_Value < targetValue)
-            m_Value = targetValue;
-        if (sgn > 0 && m_Value > targetValue)
-            m_Value = targetValue;
+    constexpr int minimumLengthMs = 160;
+    constexpr int maximumLengthMs = 800;
+    int targetValue               = std::clamp(m_Value + value, 0, m_MaxValue);
+    int diff                      = abs(targetValue - m_Value);
+    int lengthMs = std::clamp(static_cast<int>(120 * log2(diff + 1)), minimumLengthMs, maximumLengthMs);
+
+    return std::make_unique<Animation::Tween>(lengthMs, m_Value, targetValue, [this, targetValue](int rolledValue) {
+        m_Value = rolledValue;
         Draw(targetValue);
-        if (m_Value != targetValue)
-            Sleep(variableDelayMs * std::clamp(1.0 / diff, 0.3, 1.0));
-    }
+    });
 }
 
 int FillBar::FilledLength() const
@@ -1,5 +1,8 @@
 #pragma once
 
+#include "Animation/Animation.h"
+#include "Render/RenderTarget.h"
+#include <memory>
 #include <ncurses.h>
 #include <string>
 
@@ -15,7 +18,7 @@ public:
     /**
      * @brief Constructor
      *
-     * @param window window
+     * @param parent target to draw the bar in
      * @param size length of the bar
      * @param xPos X position of the leftmost edge
      * @param yPos Y position of the leftmost edge
@@ -25,7 +28,7 @@ public:
      * @param showText whether or not to show the value and maximum in text (default: true = text enabled)
      * @param textInPercent whether or not to display only the percentage if text is enabled (default: false)
      */
-    FillBar(WINDOW* window,
+    FillBar(Render::RenderTarget& parent,
             int size,
             int xPos,
             int yPos,
@@ -55,11 +58,12 @@ public:
     void MoveBy(int value);
 
     /**
-     * @brief Roll the bar by the amount specified
+     * @brief Create an animation rolling the bar by the amount specified
      * 
      * @param value value
+     * @return std::unique_ptr<Animation::Animation> animation
      */
-    void RollBy(int value);
+    std::unique_ptr<Animation::Animation> RollAnimation(int value);
 
     /**
      * @brief Set the value
@@ -76,7 +80,7 @@ public:
     inline void SetMaxValue(int value) { m_MaxValue = value; }
 
 protected:
-    WINDOW* m_Window;
+    std::unique_ptr<Render::RenderTarget> m_Target;
     int m_Size, m_Value, m_MaxValue;
     short m_FillColorPair;
     bool m_ShowText, m_TextInPercent;
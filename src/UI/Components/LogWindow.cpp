@@ -1,93 +1,150 @@
 #include "LogWindow.h"
+#include <algorithm>
 #include <cctype>
 
 namespace UI::Components
 {
 
-LogWindow::LogWindow(int xPos, int yPos, int width, int height)
+LogWindow::LogWindow(Render::RenderBackend& backend, int xPos, int yPos, int width, int height)
     : m_Width(width),
       m_Height(height),
-      m_Window(newwin(height, width, yPos, xPos))
+      m_Target(backend.CreateTarget(height, width, yPos, xPos)),
+      m_Lines(HistoryCapacity),
+      m_ScrollOffset(0),
+      m_DrawnRows(std::max(height - 2, 0)),
+      m_AreDrawnRowsValid(false),
+      m_DrawnScrollOffset(0)
 {
 }
 
 LogWindow::~LogWindow()
 {
-    werase(m_Window);
-    wrefresh(m_Window);
-    delwin(m_Window);
+    m_Target->Erase();
+    m_Target->Present();
 }
 
 void LogWindow::Append(const std::string& message)
 {
-    auto lines = Split(message);
-    for (auto& line : lines)
+    const size_t maxLength = m_Width - 4 - SidePadding * 2;
+    size_t lineCount       = 0;
+    size_t begin           = 0;
+
+    while (message.size() - begin > maxLength)
     {
-        m_Log.push_back(std::move(line));
-        if (static_cast<int>(m_Log.size()) > m_Height - 2)
-            m_Log.pop_front();
+        size_t pos = begin + maxLength - 1;
+        while (pos > begin && !isspace(message[pos]))
+        {
+            pos--;
+        }
+        // A single word longer than the line gets broken up
+        if (pos == begin)
+            pos = begin + maxLength - 1;
+
+        AppendLine(lineCount == 0, message, begin, pos - begin);
+        lineCount++;
+        begin = pos;
     }
+
+    AppendLine(lineCount == 0, message, begin, message.size() - begin);
+    lineCount++;
+
+    // Keep the view on the same lines while scrolled back
+    if (m_ScrollOffset > 0)
+        m_ScrollOffset = std::min(m_ScrollOffset + static_cast<int>(lineCount), MaxScrollOffset());
 }
 
-WINDOW* LogWindow::Draw()
+Render::RenderTarget& LogWindow::Draw()
 {
-    werase(m_Window);
-    box(m_Window, 0, 0);
+    m_Target->Erase();
+    m_Target->Box();
+    m_AreDrawnRowsValid = false;
     RefreshContent();
 
-    return m_Window;
+    return *m_Target;
 }
 
 void LogWindow::RefreshContent()
 {
-    // Clear the text area
-    for (int i = 1 + SidePadding; i < m_Width - 2 - SidePadding; i++)
+    static const std::string blankLine;
+
+    const int rows    = TextRows();
+    const size_t end  = m_Lines.Size() - m_ScrollOffset;
+    const size_t last = end > static_cast<size_t>(rows) ? end - rows : 0;
+    bool hasChanged   = false;
+
+    for (int row = 0; row < rows; row++)
     {
-        mvwvline(m_Window, 1, i, ' ', m_Height - 2);
+        size_t index            = last + row;
+        const std::string& line = index < end ? m_Lines[index] : blankLine;
+        if (m_AreDrawnRowsValid && m_DrawnRows[row] == line)
+            continue;
+
+        m_Target->HLine(row + 1, 1, ' ', m_Width - 2);
+        m_Target->AddString(row + 1, SidePadding + 1, line);
+        m_DrawnRows[row] = line;
+        hasChanged       = true;
     }
 
-    int linum = 1;
-    for (const auto& line : m_Log)
+    if (!m_AreDrawnRowsValid || m_DrawnScrollOffset != m_ScrollOffset)
     {
-        mvwaddstr(m_Window, linum, SidePadding + 1, line.c_str());
-        linum++;
+        DrawScrollIndicator();
+        m_DrawnScrollOffset = m_ScrollOffset;
+        hasChanged          = true;
     }
+    m_AreDrawnRowsValid = true;
 
-    wrefresh(m_Window);
+    if (hasChanged)
+        m_Target->Present();
 }
 
-std::vector<std::string> LogWindow::Split(std::string message)
+void LogWindow::Scroll(int lines)
 {
-    const int maxLength = m_Width - 4 - SidePadding * 2;
-    std::vector<std::string> output;
+    m_ScrollOffset = std::clamp(m_ScrollOffset + lines, 0, MaxScrollOffset());
+}
 
-    bool first = true;
-    while (static_cast<int>(message.size()) > maxLength)
-    {
-        int pos = maxLength - 1;
-        while (!isspace(message.at(pos)))
-        {
-            // This will blow up if the message contains a single word longer than the maximum length
-            // but that is a risk I'm willing to undertake
-            pos--;
-        }
+void LogWindow::PageUp()
+{
+    Scroll(std::max(TextRows() - 1, 1));
+}
 
-        // Left-pad lines in a single message except the first for readability
-        if (first)
-        {
-            output.push_back("> " + message.substr(0, pos));
-        }
-        else
-        {
-            output.push_back(" " + message.substr(0, pos));
-        }
+void LogWindow::PageDown()
+{
+    Scroll(-std::max(TextRows() - 1, 1));
+}
 
-        message.erase(0, pos);
-        first = false;
-    }
+size_t LogWindow::LineCount() const
+{
+    return m_Lines.Size();
+}
 
-    output.push_back(first ? "> " + message : " " + message);
-    return output;
+const std::string& LogWindow::LineAt(size_t index) const
+{
+    return m_Lines[index];
+}
+
+int LogWindow::TextRows() const
+{
+    return static_cast<int>(m_DrawnRows.size());
+}
+
+int LogWindow::MaxScrollOffset() const
+{
+    return std::max(static_cast<int>(m_Lines.Size()) - TextRows(), 0);
+}
+
+void LogWindow::AppendLine(bool isFirst, const std::string& message, size_t pos, size_t length)
+{
+    // Left-pad lines in a single message except the first for readability
+    std::string& line = m_Lines.PushBack();
+    line.assign(isFirst ? "> " : " ");
+    line.append(message, pos, length);
+}
+
+void LogWindow::DrawScrollIndicator()
+{
+    m_Target->HLine(0, 1, ACS_HLINE, m_Width - 2);
+    if (m_ScrollOffset > 0)
+        m_Target->Print(0, m_Width - 12, " -%d ", m_ScrollOffset);
 }
 
-} // namespace UI::Components
\ No newline at end of file
+} /* namespace UI::Components */
@@ -1,7 +1,9 @@
 #pragma once
 
-#include <ncurses.h>
-#include <deque>
+#include "Misc/RingBuffer.h"
+#include "Render/RenderBackend.h"
+#include "Render/RenderTarget.h"
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -10,19 +12,26 @@ namespace UI::Components
 
 /**
  * @brief Window with support for appending text messages in logging
+ * Messages are wrapped once when appended and kept in a bounded scrollback history.
  */
 class LogWindow
 {
 public:
+    /**
+     * @brief Maximum number of wrapped lines kept in the history
+     */
+    constexpr static const size_t HistoryCapacity = 4096;
+
     /**
      * @brief Constructor
      *
+     * @param backend render backend
      * @param xPos X position
      * @param yPos Y position
      * @param width width
      * @param height height
      */
-    LogWindow(int xPos, int yPos, int width, int height);
+    LogWindow(Render::RenderBackend& backend, int xPos, int yPos, int width, int height);
 
     /**
      * @brief Destructor
@@ -39,28 +48,85 @@ public:
     /**
      * @brief Draw the log window
      * 
-     * @return WINDOW* window (for additional custom changes)
+     * @return Render::RenderTarget& target (for additional custom changes)
      */
-    WINDOW* Draw();
+    Render::RenderTarget& Draw();
 
     /**
-     * @brief Redraw the contents of the log
+     * @brief Redraw the lines of the log which have changed since they were last drawn
      */
     void RefreshContent();
 
+    /**
+     * @brief Scroll through the history, positive values scroll towards older lines
+     * 
+     * @param lines number of lines
+     */
+    void Scroll(int lines);
+
+    /**
+     * @brief Scroll one page towards older lines
+     */
+    void PageUp();
+
+    /**
+     * @brief Scroll one page towards newer lines
+     */
+    void PageDown();
+
+    /**
+     * @brief Get the number of wrapped lines in the history
+     * 
+     * @return size_t line count
+     */
+    size_t LineCount() const;
+
+    /**
+     * @brief Get a wrapped line from the history
+     * 
+     * @param index index, 0 being the oldest line kept
+     * @return const std::string& line
+     */
+    const std::string& LineAt(size_t index) const;
+
 private:
     constexpr static const int SidePadding = 1;
     int m_Width, m_Height;
-    WINDOW* m_Window;
-    std::deque<std::string> m_Log;
+    std::unique_ptr<Render::RenderTarget> m_Target;
+    RingBuffer<std::string> m_Lines;
+    int m_ScrollOffset;
+    std::vector<std::string> m_DrawnRows;
+    bool m_AreDrawnRowsValid;
+    int m_DrawnScrollOffset;
+
+    /**
+     * @brief Get the number of rows available for text
+     * 
+     * @return int row count
+     */
+    int TextRows() const;
+
+    /**
+     * @brief Get the largest allowed scroll offset
+     * 
+     * @return int maximum offset
+     */
+    int MaxScrollOffset() const;
 
     /**
-     * @brief Split a message into a list of sub-messages that fit the window's width.
+     * @brief Append a single wrapped line of a message to the history
      * 
+     * @param isFirst whether this is the first line of the message
      * @param message message
-     * @return std::vector<std::string> split message
+     * @param pos position of the line in the message
+     * @param length length of the line
+     */
+    void AppendLine(bool isFirst, const std::string& message, size_t pos, size_t length);
+
+    /**
+     * @brief Draw the scroll position indicator on the top border
      */
-    std::vector<std::string> Split(std::string message);
+    void DrawScrollIndicator();
 };
 
-} /* namespace UI::Components */
\ No newline at end of file
+} /* namespace UI::Components */
@@ -0,0 +1,89 @@
+#include "MenuWidget.h"
+#include "Misc/Exceptions.h"
+
+namespace UI::Components
+{
+
+MenuWidget::MenuWidget() : m_Menu(nullptr), m_ItemCount(0)
+{
+}
+
+MenuWidget::~MenuWidget()
+{
+    if (m_Menu != nullptr)
+    {
+        unpost_menu(m_Menu);
+        free_menu(m_Menu);
+    }
+    for (ITEM* item : m_ItemPool)
+    {
+        free_item(item);
+    }
+}
+
+void MenuWidget::ClearItems()
+{
+    // Detach the current item array before it gets overwritten
+    if (m_Menu != nullptr)
+    {
+        unpost_menu(m_Menu);
+        set_menu_items(m_Menu, nullptr);
+    }
+    m_ItemCount = 0;
+}
+
+void MenuWidget::AddItem(const std::string& label)
+{
+    // Items refer to their label, which the deque keeps in place as it grows
+    if (m_ItemCount == m_ItemPool.size())
+    {
+        m_Labels.push_back(label);
+        m_ItemPool.push_back(new_item(m_Labels.back().c_str(), m_Labels.back().c_str()));
+    }
+    else if (m_Labels[m_ItemCount] != label)
+    {
+        // Items are detached from the menu by ClearItems(), so this one can be replaced
+        free_item(m_ItemPool[m_ItemCount]);
+        m_Labels[m_ItemCount]   = label;
+        m_ItemPool[m_ItemCount] = new_item(m_Labels[m_ItemCount].c_str(), m_Labels[m_ItemCount].c_str());
+    }
+    m_ItemCount++;
+}
+
+MENU* MenuWidget::Open(int height, int width, int yPos, int xPos, int subHeight, int subWidth, int subYPos, int subXPos)
+{
+    WINDOW* window    = m_Window.Open(height, width, yPos, xPos);
+    WINDOW* subWindow = m_Window.OpenSub(subHeight, subWidth, subYPos, subXPos);
+
+    m_Items.assign(m_ItemPool.begin(), m_ItemPool.begin() + m_ItemCount);
+    m_Items.push_back(nullptr);
+    if (m_Menu == nullptr)
+    {
+        m_Menu = new_menu(m_Items.data());
+        if (m_Menu == nullptr)
+        {
+            throw DisplayException("Could not create a menu");
+        }
+    }
+    else if (set_menu_items(m_Menu, m_Items.data()) != E_OK)
+    {
+        throw DisplayException("Could not repopulate a menu");
+    }
+
+    set_menu_win(m_Menu, window);
+    set_menu_sub(m_Menu, subWindow);
+    return m_Menu;
+}
+
+void MenuWidget::Close()
+{
+    unpost_menu(m_Menu);
+    m_Window.Close();
+}
+
+WINDOW* MenuWidget::Window() const
+{
+    return m_Window.Window();
+}
+
+} /* namespace UI::Components */
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "WindowWidget.h"
+#include <cstddef>
+#include <deque>
+#include <menu.h>
+#include <string>
+#include <vector>
+
+namespace UI::Components
+{
+
+/**
+ * @brief Retained ncurses menu in its own window
+ * Items are kept by position and the menu is repopulated in place, so reopening a menu whose labels
+ * have not changed allocates nothing. An item is only recreated when the label at its position changes.
+ */
+class MenuWidget
+{
+public:
+    /**
+     * @brief Constructor
+     */
+    MenuWidget();
+
+    /**
+     * @brief Destructor
+     */
+    ~MenuWidget();
+
+    MenuWidget(const MenuWidget&) = delete;
+    MenuWidget& operator=(const MenuWidget&) = delete;
+
+    /**
+     * @brief Remove all items from the menu, must be called before adding the items of a new menu
+     * The items themselves are kept for reuse by the next menu.
+     */
+    void ClearItems();
+
+    /**
+     * @brief Append an item
+     * 
+     * @param label item label
+     */
+    void AddItem(const std::string& label);
+
+    /**
+     * @brief Place the menu with the items added since the last ClearItems() call
+     * The menu is left unposted for further configuration.
+     * 
+     * @param height window height
+     * @param width window width
+     * @param yPos window Y position on the screen
+     * @param xPos window X position on the screen
+     * @param subHeight item area height
+     * @param subWidth item area width
+     * @param subYPos item area Y position relative to the window
+     * @param subXPos item area X position relative to the window
+     * @return MENU* menu
+     * @throw DisplayException if the menu cannot be created or repopulated
+     */
+    MENU* Open(int height, int width, int yPos, int xPos, int subHeight, int subWidth, int subYPos, int subXPos);
+
+    /**
+     * @brief Unpost the menu and erase its window from the screen
+     */
+    void Close();
+
+    /**
+     * @brief Get the menu window
+     * 
+     * @return WINDOW* window
+     */
+    WINDOW* Window() const;
+
+private:
+    WindowWidget m_Window;
+    MENU* m_Menu;
+    std::deque<std::string> m_Labels;
+    std::vector<ITEM*> m_ItemPool;
+    size_t m_ItemCount;
+    std::vector<ITEM*> m_Items;
+};
+
+} /* namespace UI::Components */
@@ -2,85 +2,92 @@
 #include "ColorPairs.h"
 #include "FillBar.h"
 #include "Misc/Utils.h"
-#include "Screen.h"
 
 namespace UI::Components
 {
 
-Nameplate::Nameplate(const Entities::Character& character, int xPos, int yPos, int width, bool isTitleOnTop)
+Nameplate::Nameplate(Render::RenderBackend& backend,
+                     const Entities::Character& character,
+                     int xPos,
+                     int yPos,
+                     int width,
+                     bool isTitleOnTop)
     : m_Character(character),
       m_Width(width),
       m_IsTitleOnTop(isTitleOnTop),
-      m_Window(newwin(Height, width, yPos, xPos)),
-      HealthBar(m_Window,
+      m_Target(backend.CreateTarget(Height, width, yPos, xPos)),
+      HealthBar(*m_Target,
                 16,
                 8,
                 2,
                 m_Character.GetStats().Health,
                 m_Character.GetStats().MaxHealth,
                 ColorPairs::WhiteOnGreen),
-      ManaBar(m_Window, 16, 8, 3, m_Character.GetStats().Mana, m_Character.GetStats().MaxMana, ColorPairs::WhiteOnBlue)
+      ManaBar(*m_Target, 16, 8, 3, m_Character.GetStats().Mana, m_Character.GetStats().MaxMana, ColorPairs::WhiteOnBlue)
 {
 }
 
 Nameplate::~Nameplate()
 {
-    wclear(m_Window);
-    wrefresh(m_Window);
-    delwin(m_Window);
+    m_Target->Erase();
+    m_Target->Present();
 }
 
 void Nameplate::Draw()
 {
-    werase(m_Window);
+    m_Target->Erase();
     DrawBorder();
 
     int row = 0;
 
     // Top row
     row++;
-    mvwprintw(m_Window, row, 4, "Level %d", m_Character.GetStats().Level);
-    mvwprintw(
-        m_Window, row, m_Width - 4 - m_Character.GetDescription().size(), "%s", m_Character.GetDescription().c_str());
+    m_Target->Print(row, 4, "Level %d", m_Character.GetStats().Level);
+    m_Target->AddString(row, m_Width - 4 - m_Character.GetDescription().size(), m_Character.GetDescription());
 
     // Middle row
     row++;
-    mvwprintw(m_Window, row, 4, "HP:");
+    m_Target->AddString(row, 4, "HP:");
     HealthBar.Draw();
 
     // Bottom row
     row++;
-    mvwprintw(m_Window, row, 4, "MP:");
+    m_Target->AddString(row, 4, "MP:");
     ManaBar.Draw();
 
-    wrefresh(m_Window);
+    m_Target->Present();
 }
 
-void Nameplate::FlashBorder(short colorPair, int count, int periodMs)
+std::unique_ptr<Animation::Animation> Nameplate::FlashBorderAnimation(short colorPair, int count, int periodMs)
 {
+    auto animation = std::make_unique<Animation::Sequence>();
     for (int i = 0; i < count; i++)
     {
         if (i != 0)
-            Sleep(periodMs);
+            animation->Wait(periodMs);
 
-        wattron(m_Window, COLOR_PAIR(colorPair));
-        DrawBorder();
-
-        Sleep(periodMs);
-
-        wattroff(m_Window, A_COLOR);
-        DrawBorder();
+        animation
+            ->Do([this, colorPair] {
+                m_Target->AttrOn(COLOR_PAIR(colorPair));
+                DrawBorder();
+            })
+            .Wait(periodMs)
+            .Do([this] {
+                m_Target->AttrOff(A_COLOR);
+                DrawBorder();
+            });
     }
+    return animation;
 }
 
 void Nameplate::DrawBorder()
 {
-    box(m_Window, 0, 0);
+    m_Target->Box();
     std::string title = " " + m_Character.GetName() + " ";
-    wattron(m_Window, A_REVERSE);
-    Screen::PrintCenter(m_Window, title, m_IsTitleOnTop ? 0 : Height - 1);
-    wattroff(m_Window, A_REVERSE);
-    wrefresh(m_Window);
+    m_Target->AttrOn(A_REVERSE);
+    m_Target->PrintCenter(m_IsTitleOnTop ? 0 : Height - 1, title);
+    m_Target->AttrOff(A_REVERSE);
+    m_Target->Present();
 }
 
 } // namespace UI::Components
\ No newline at end of file
@@ -1,7 +1,11 @@
 #pragma once
 
+#include "Animation/Animation.h"
 #include "Entities/Character.h"
 #include "FillBar.h"
+#include "Render/RenderBackend.h"
+#include "Render/RenderTarget.h"
+#include <memory>
 #include <ncurses.h>
 
 namespace UI::Components
@@ -21,13 +25,19 @@ public:
     /**
      * @brief Constructor
      *
+     * @param backend render backend
      * @param character character displayed
      * @param xPos X position
      * @param yPos Y position
      * @param width width
      * @param isTitleOnTop true if title (name) should be on top, false if on bottom
      */
-    Nameplate(const Entities::Character& character, int xPos, int yPos, int width, bool isTitleOnTop);
+    Nameplate(Render::RenderBackend& backend,
+              const Entities::Character& character,
+              int xPos,
+              int yPos,
+              int width,
+              bool isTitleOnTop);
 
     /**
      * @brief Destructor
@@ -40,19 +50,20 @@ public:
     void Draw();
 
     /**
-     * @brief Flash the nameplate border
+     * @brief Create an animation flashing the nameplate border
      *
      * @param colorPair flash color
      * @param count how many times to flash
      * @param periodMs period between flashes in milliseconds
+     * @return std::unique_ptr<Animation::Animation> animation
      */
-    void FlashBorder(short colorPair, int count, int periodMs);
+    std::unique_ptr<Animation::Animation> FlashBorderAnimation(short colorPair, int count, int periodMs);
 
 private:
     const Entities::Character& m_Character;
     int m_Width;
     bool m_IsTitleOnTop;
-    WINDOW* m_Window;
+    std::unique_ptr<Render::RenderTarget> m_Target;
 
     /**
      * @brief Draw the border
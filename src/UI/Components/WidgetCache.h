@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace UI::Components
+{
+
+/**
+ * @brief Pool of retained widgets handed out for the duration of a single use
+ * Widgets are created the first time the pool runs dry and reused afterwards, so nested uses
+ * (e.g. a message box opened from a menu) each get their own widget.
+ * 
+ * @tparam Widget widget type
+ */
+template <typename Widget>
+class WidgetCache
+{
+public:
+    /**
+     * @brief Exclusive use of a widget, returned to the cache when destroyed
+     */
+    class Lease
+    {
+    public:
+        /**
+         * @brief Constructor
+         * 
+         * @param cache owning cache
+         * @param index widget index
+         */
+        Lease(WidgetCache& cache, size_t index) : m_Cache(cache), m_Index(index) {}
+
+        /**
+         * @brief Destructor
+         */
+        ~Lease() { m_Cache.m_IsInUse[m_Index] = false; }
+
+        Lease(const Lease&) = delete;
+        Lease& operator=(const Lease&) = delete;
+
+        Widget& operator*() const { return *m_Cache.m_Widgets[m_Index]; }
+        Widget* operator->() const { return m_Cache.m_Widgets[m_Index].get(); }
+
+    private:
+        WidgetCache& m_Cache;
+        size_t m_Index;
+    };
+
+    /**
+     * @brief Take a free widget from the cache, creating one if all are in use
+     * 
+     * @return Lease widget lease
+     */
+    Lease Acquire()
+    {
+        for (size_t i = 0; i < m_Widgets.size(); i++)
+        {
+            if (!m_IsInUse[i])
+            {
+                m_IsInUse[i] = true;
+                return Lease(*this, i);
+            }
+        }
+        m_Widgets.push_back(std::make_unique<Widget>());
+        m_IsInUse.push_back(true);
+        return Lease(*this, m_Widgets.size() - 1);
+    }
+
+    /**
+     * @brief Destroy all widgets, none of which may be in use
+     */
+    void Clear()
+    {
+        m_Widgets.clear();
+        m_IsInUse.clear();
+    }
+
+private:
+    std::vector<std::unique_ptr<Widget>> m_Widgets;
+    std::vector<bool> m_IsInUse;
+};
+
+} /* namespace UI::Components */
@@ -0,0 +1,92 @@
+#include "WindowWidget.h"
+
+namespace UI::Components
+{
+
+WindowWidget::WindowWidget() : m_Window(nullptr), m_SubWindow(nullptr)
+{
+}
+
+WindowWidget::~WindowWidget()
+{
+    DeleteSubWindow();
+    if (m_Window != nullptr)
+        delwin(m_Window);
+}
+
+WINDOW* WindowWidget::Open(int height, int width, int yPos, int xPos)
+{
+    if (m_Window != nullptr)
+    {
+        int currentHeight, currentWidth, currentYPos, currentXPos;
+        getmaxyx(m_Window, currentHeight, currentWidth);
+        getbegyx(m_Window, currentYPos, currentXPos);
+
+        bool isSameSize     = currentHeight == height && currentWidth == width;
+        bool isSamePosition = currentYPos == yPos && currentXPos == xPos;
+        if (isSameSize && isSamePosition)
+        {
+            werase(m_Window);
+            return m_Window;
+        }
+
+        // Moving a window does not move its subwindows, so only childless windows are moved in place
+        if (isSameSize && m_SubWindow == nullptr && mvwin(m_Window, yPos, xPos) == OK)
+        {
+            werase(m_Window);
+            return m_Window;
+        }
+
+        DeleteSubWindow();
+        delwin(m_Window);
+    }
+
+    m_Window = newwin(height, width, yPos, xPos);
+    keypad(m_Window, 1);
+    return m_Window;
+}
+
+WINDOW* WindowWidget::OpenSub(int height, int width, int yPos, int xPos)
+{
+    if (m_SubWindow != nullptr)
+    {
+        int currentHeight, currentWidth, currentYPos, currentXPos;
+        getmaxyx(m_SubWindow, currentHeight, currentWidth);
+        getparyx(m_SubWindow, currentYPos, currentXPos);
+        if (currentHeight == height && currentWidth == width && currentYPos == yPos && currentXPos == xPos)
+        {
+            return m_SubWindow;
+        }
+        DeleteSubWindow();
+    }
+
+    m_SubWindow = derwin(m_Window, height, width, yPos, xPos);
+    return m_SubWindow;
+}
+
+void WindowWidget::Close()
+{
+    werase(m_Window);
+    wrefresh(m_Window);
+}
+
+WINDOW* WindowWidget::Window() const
+{
+    return m_Window;
+}
+
+WINDOW* WindowWidget::SubWindow() const
+{
+    return m_SubWindow;
+}
+
+void WindowWidget::DeleteSubWindow()
+{
+    if (m_SubWindow != nullptr)
+    {
+        delwin(m_SubWindow);
+        m_SubWindow = nullptr;
+    }
+}
+
+} /* namespace UI::Components */
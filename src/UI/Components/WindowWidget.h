@@ -0,0 +1,80 @@
+#pragma once
+
+#include <ncurses.h>
+
+namespace UI::Components
+{
+
+/**
+ * @brief Retained ncurses window with an optional derived subwindow
+ * The windows are only reallocated when their size changes, so reopening the widget with the same
+ * geometry allocates nothing.
+ */
+class WindowWidget
+{
+public:
+    /**
+     * @brief Constructor
+     */
+    WindowWidget();
+
+    /**
+     * @brief Destructor
+     */
+    ~WindowWidget();
+
+    WindowWidget(const WindowWidget&) = delete;
+    WindowWidget& operator=(const WindowWidget&) = delete;
+
+    /**
+     * @brief Get a blank window with the given geometry
+     * 
+     * @param height height
+     * @param width width
+     * @param yPos Y position on the screen
+     * @param xPos X position on the screen
+     * @return WINDOW* window
+     */
+    WINDOW* Open(int height, int width, int yPos, int xPos);
+
+    /**
+     * @brief Get a subwindow of the window opened last
+     * 
+     * @param height height
+     * @param width width
+     * @param yPos Y position relative to the window
+     * @param xPos X position relative to the window
+     * @return WINDOW* subwindow
+     */
+    WINDOW* OpenSub(int height, int width, int yPos, int xPos);
+
+    /**
+     * @brief Erase the window from the screen, keeping it allocated
+     */
+    void Close();
+
+    /**
+     * @brief Get the window
+     * 
+     * @return WINDOW* window (null if never opened)
+     */
+    WINDOW* Window() const;
+
+    /**
+     * @brief Get the subwindow
+     * 
+     * @return WINDOW* subwindow (null if never opened)
+     */
+    WINDOW* SubWindow() const;
+
+private:
+    WINDOW* m_Window;
+    WINDOW* m_SubWindow;
+
+    /**
+     * @brief Delete the subwindow if there is one
+     */
+    void DeleteSubWindow();
+};
+
+} /* namespace UI::Components */
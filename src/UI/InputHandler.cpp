@@ -1,14 +1,17 @@
 #include "InputHandler.h"
 #include "ColorPairs.h"
+#include "InputLatency.h"
+#include "KeyInput.h"
 #include "Misc/Direction.h"
+#include "Misc/Profiler.h"
 #include "Misc/Utils.h"
 #include "Player/Controller.h"
 #include "Screen.h"
 #include "Worlds/Room.h"
 #include "Worlds/World.h"
 #include <algorithm>
-#include <cctype>
-#include <cstdlib>
+#include <array>
+#include <charconv>
 #include <fstream>
 #include <ncurses.h>
 #include <sstream>
@@ -16,67 +19,111 @@
 namespace UI
 {
 
+/**
+ * @brief Entry of the controls config file
+ */
+struct KeywordDefinition
+{
+    const char* Code;
+    Keyword Meaning;
+    const char* Keywords;
+    const char* Description;
+};
+
+using CommandType   = InputHandler::CommandType;
+using UICommandType = InputHandler::UICommandType;
+
+/**
+ * @brief Controls config entries with their default keywords, in file order
+ */
+static const std::array<KeywordDefinition, 22> KeywordDefinitions { {
+    { "NIL", { Keyword::Kind::Command, CommandType::None }, "wait nil", "Blank \"do nothing\" command." },
+    { "MOVE",
+      { Keyword::Kind::Command, CommandType::Move },
+      "go move walk g",
+      "Move the player character. Requires a direction argument." },
+    { "GET",
+      { Keyword::Kind::Command, CommandType::Get },
+      "get grab take loot acquire",
+      "Pick up an item next to the player. Requires a direction argument." },
+    { "BREAK",
+      { Keyword::Kind::Command, CommandType::Break },
+      "break smash destroy",
+      "Break a destructible object next to the player. Requires a direction argument." },
+    { "BATTLE",
+      { Keyword::Kind::Command, CommandType::Battle },
+      "battle fight duel challenge",
+      "Fight a combat-enabled character next to the player. Requires a direction argument." },
+    { "TALK",
+      { Keyword::Kind::Command, CommandType::Talk },
+      "speak talk hail",
+      "Talk to a character next to the player. Requires a direction argument." },
+    { "TRADE",
+      { Keyword::Kind::Command, CommandType::Trade },
+      "trade buy sell",
+      "Trade with a merchant character next to the player. Requires a direction argument." },
+    { "TURN",
+      { Keyword::Kind::Command, CommandType::Turn },
+      "turn t face",
+      "Turn your character around in place. Requires a direction argument." },
+    { "OPEN_INV",
+      { Keyword::Kind::UICommand, UICommandType::Inventory },
+      "i inv inventory items bag backpack",
+      "Open the player's inventory." },
+    { "OPEN_SKILLS",
+      { Keyword::Kind::UICommand, UICommandType::Skills },
+      "s skills abilities",
+      "Open the player's skill menu." },
+    { "OPEN_MAP", { Keyword::Kind::UICommand, UICommandType::Map }, "m map", "Display the world map." },
+    { "OPEN_HELP",
+      { Keyword::Kind::UICommand, UICommandType::Help },
+      "h help helpscreen f1",
+      "Display the ingame help section." },
+    { "PROFILE",
+      { Keyword::Kind::UICommand, UICommandType::Profile },
+      "profile",
+      "Write subsystem timings to data/profile.txt (builds with profiling enabled only)." },
+    { "SPEED",
+      { Keyword::Kind::UICommand, UICommandType::Speed },
+      "speed",
+      "Cycle the battle animation speed between normal, fast and instant." },
+    { "LATENCY",
+      { Keyword::Kind::UICommand, UICommandType::Latency },
+      "latency",
+      "Toggle the keypress-to-frame latency overlay." },
+    { "QUIT", { Keyword::Kind::UICommand, UICommandType::Quit }, "q quit exit", "Quit the game." },
+    { "UP", { Keyword::Kind::Direction, Direction::Value::Up }, "u up", "Keyword for direction UP." },
+    { "RIGHT", { Keyword::Kind::Direction, Direction::Value::Right }, "r right", "Keyword for direction RIGHT." },
+    { "DOWN", { Keyword::Kind::Direction, Direction::Value::Down }, "d down", "Keyword for direction DOWN." },
+    { "LEFT", { Keyword::Kind::Direction, Direction::Value::Left }, "l left", "Keyword for direction LEFT." },
+    { "AND", { Keyword::Kind::And, 0 }, "& and then", "Keyword for chaining commands." },
+    { "LAST", { Keyword::Kind::Last, 0 }, "a last repeat again", "Repeat the last single command." },
+} };
+
+/**
+ * @brief Add whitespace-separated keywords to a table
+ *
+ * @param table keyword table
+ * @param words keywords
+ * @param meaning meaning of the keywords
+ */
+static void AddKeywords(KeywordTable& table, std::string_view words, Keyword meaning)
+{
+    for (auto word = NextWord(words); !word.empty(); word = NextWord(words))
+    {
+        table.Add(word, meaning);
+    }
+}
+
 InputHandler::InputHandler(Screen& screen, Player::Controller& playerController)
     : m_Screen(screen),
       m_PlayerController(playerController),
       m_ShouldQuit(false)
 {
-    m_ShouldQuit              = false;
-    m_CmdDict["wait"]         = CommandType::None;
-    m_CmdDict["nil"]          = CommandType::None;
-    m_CmdDict["go"]           = CommandType::Move;
-    m_CmdDict["move"]         = CommandType::Move;
-    m_CmdDict["walk"]         = CommandType::Move;
-    m_CmdDict["g"]            = CommandType::Move;
-    m_CmdDict["get"]          = CommandType::Get;
-    m_CmdDict["grab"]         = CommandType::Get;
-    m_CmdDict["take"]         = CommandType::Get;
-    m_CmdDict["loot"]         = CommandType::Get;
-    m_CmdDict["acquire"]      = CommandType::Get;
-    m_CmdDict["break"]        = CommandType::Break;
-    m_CmdDict["smash"]        = CommandType::Break;
-    m_CmdDict["destroy"]      = CommandType::Break;
-    m_CmdDict["battle"]       = CommandType::Battle;
-    m_CmdDict["fight"]        = CommandType::Battle;
-    m_CmdDict["duel"]         = CommandType::Battle;
-    m_CmdDict["challenge"]    = CommandType::Battle;
-    m_CmdDict["speak"]        = CommandType::Talk;
-    m_CmdDict["talk"]         = CommandType::Talk;
-    m_CmdDict["hail"]         = CommandType::Talk;
-    m_CmdDict["trade"]        = CommandType::Trade;
-    m_CmdDict["buy"]          = CommandType::Trade;
-    m_CmdDict["sell"]         = CommandType::Trade;
-    m_CmdDict["turn"]         = CommandType::Turn;
-    m_CmdDict["t"]            = CommandType::Turn;
-    m_CmdDict["face"]         = CommandType::Turn;
-    m_UICmdDict["i"]          = UICommandType::Inventory;
-    m_UICmdDict["inv"]        = UICommandType::Inventory;
-    m_UICmdDict["inventory"]  = UICommandType::Inventory;
-    m_UICmdDict["items"]      = UICommandType::Inventory;
-    m_UICmdDict["bag"]        = UICommandType::Inventory;
-    m_UICmdDict["backpack"]   = UICommandType::Inventory;
-    m_UICmdDict["s"]          = UICommandType::Skills;
-    m_UICmdDict["skills"]     = UICommandType::Skills;
-    m_UICmdDict["abilities"]  = UICommandType::Skills;
-    m_UICmdDict["m"]          = UICommandType::Map;
-    m_UICmdDict["map"]        = UICommandType::Map;
-    m_UICmdDict["h"]          = UICommandType::Help;
-    m_UICmdDict["help"]       = UICommandType::Help;
-    m_UICmdDict["helpscreen"] = UICommandType::Help;
-    m_UICmdDict["f1"]         = UICommandType::Help;
-    m_UICmdDict["q"]          = UICommandType::Quit;
-    m_UICmdDict["quit"]       = UICommandType::Quit;
-    m_UICmdDict["exit"]       = UICommandType::Quit;
-    m_DirDict["u"]            = Direction::Up;
-    m_DirDict["up"]           = Direction::Up;
-    m_DirDict["r"]            = Direction::Right;
-    m_DirDict["right"]        = Direction::Right;
-    m_DirDict["d"]            = Direction::Down;
-    m_DirDict["down"]         = Direction::Down;
-    m_DirDict["l"]            = Direction::Left;
-    m_DirDict["left"]         = Direction::Left;
-    m_AndKeywords             = { "and", "&", "then" };
-    m_LastKeywords            = { "a", "last", "repeat", "again" };
+    for (const auto& definition : KeywordDefinitions)
+    {
+        AddKeywords(m_Keywords, definition.Keywords, definition.Meaning);
+    }
     makeKeyConf();
     loadKeyConf();
 }
@@ -100,34 +147,39 @@ void InputHandler::ExecCommandQueue()
     }
 }
 
-void InputHandler::Eval(const std::string& input)
+void InputHandler::Eval(std::string_view input)
 {
-    std::vector<std::string> words;
-    std::istringstream iss(input);
-    std::string buffer;
-    while (iss >> buffer)
+    // Interrupt if an UI command is detected
+    std::string_view rest = input;
+    size_t wordCount      = 0;
+    std::optional<UICommandType> uiCommand;
+    for (auto word = NextWord(rest); !word.empty(); word = NextWord(rest))
     {
-        // Interrupt if an UI command is detected
-        if (m_UICmdDict.count(buffer) > 0)
+        Keyword keyword = m_Keywords.Find(word);
+        if (keyword.Type == Keyword::Kind::UICommand && !uiCommand)
         {
-            std::string next;
-            if (words.empty() && !(iss >> next))
-            {
-                ExecUICommand(m_UICmdDict.at(buffer));
-            }
-            else
-            {
-                m_Screen.PostMessage("User interface commands such as \"quit\" cannot be chained or have parameters.");
-            }
-            return;
+            uiCommand = static_cast<UICommandType>(keyword.Code);
+        }
+        wordCount++;
+    }
+
+    if (uiCommand)
+    {
+        if (wordCount == 1)
+        {
+            ExecUICommand(*uiCommand);
+        }
+        else
+        {
+            m_Screen.PostMessage("User interface commands such as \"quit\" cannot be chained or have parameters.");
         }
-        words.push_back(std::move(buffer));
+        return;
     }
 
     switch (m_Screen.GetView())
     {
     case Screen::View::InGame:
-        EvalWorld(words);
+        EvalWorld(input);
         break;
     default:
         return;
@@ -158,233 +210,61 @@ void InputHandler::makeKeyConf() const
              << "# This file is auto-generated if missing. To reset your controls to default, simply delete it.\n"
              << "# A line consists of a \"KEYWORD_CODE\" followed by space-separated keywords (aliases) for that "
                 "command.\n"
-             << "# Numbers, uppercase letters and special characters other than '&' are not allowed.\n"
+             << "# Keywords may only contain lowercase letters, digits, '_' and '&'. Any unambiguous prefix of a "
+                "keyword works too.\n"
+             << "# Codes missing from this file keep their default keywords.\n"
              << "# Lines starting with '#' are ignored.\n\n"
-             << "# --- WORLD MOVEMENT AND ACTIONS ---\n"
-             << "# Blank \"do nothing\" command.\n"
-             << "NIL wait nil\n"
-             << "# Move the player character. Requires a direction argument.\n"
-             << "MOVE go move walk g\n"
-             << "# Pick up an item next to the player. Requires a direction argument.\n"
-             << "GET get grab take loot acquire\n"
-             << "# Break a destructible object next to the player. Requires a direction argument.\n"
-             << "BREAK break smash destroy\n"
-             << "# Fight a combat-enabled character next to the player. Requires a direction argument.\n"
-             << "BATTLE battle fight duel challenge\n"
-             << "# Talk to a character next to the player. Requires a direction argument.\n"
-             << "TALK speak talk hail\n"
-             << "# Trade with a merchant character next to the player. Requires a direction argument.\n"
-             << "TRADE trade buy sell\n"
-             << "# Turn your character around in place. Requires a direction argument.\n"
-             << "TURN turn t face"
-             << "# Open the player's inventory.\n"
-             << "OPEN_INV i inv inventory items bag backpack\n"
-             << "# Open the player's skill menu.\n"
-             << "OPEN_SKILLS s skills abilities\n"
-             << "# Display the world map.\n"
-             << "OPEN_MAP m map\n"
-             << "# Display the ingame help section.\n"
-             << "OPEN_HELP h help helpscreen f1\n"
-             << "# Quit the game.\n"
-             << "QUIT q quit exit\n"
-             << "# Keyword for direction UP.\n"
-             << "UP u up\n"
-             << "# Keyword for direction RIGHT.\n"
-             << "RIGHT r right\n"
-             << "# Keyword for direction DOWN.\n"
-             << "DOWN d down\n"
-             << "# Keyword for direction LEFT.\n"
-             << "LEFT l left\n"
-             << "# Keyword for chaining commands.\n"
-             << "AND & and then\n"
-             << "# Repeat the last single command.\n"
-             << "LAST a last repeat again\n";
+             << "# --- WORLD MOVEMENT AND ACTIONS ---\n";
+        for (const auto& definition : KeywordDefinitions)
+        {
+            file << "# " << definition.Description << "\n" << definition.Code << " " << definition.Keywords << "\n";
+        }
         file.close();
     }
 }
 
 void InputHandler::loadKeyConf()
 {
-    if (!fileExists("data/controls.conf"))
+    std::ifstream file("data/controls.conf");
+    if (!file)
     {
         m_Screen.PostMessage("Could not read file \"controls.conf\". Controls set to default.");
         return;
     }
-    else
+
+    // Collect the keywords of every code in the file, which replace the defaults of that code only
+    std::array<std::string, KeywordDefinitions.size()> configured;
+    std::array<bool, KeywordDefinitions.size()> isConfigured {};
+    std::string line;
+    while (std::getline(file, line))
     {
-        m_CmdDict.clear();
-        m_DirDict.clear();
-        m_AndKeywords.clear();
-        m_LastKeywords.clear();
-        std::ifstream file("data/controls.conf");
-        std::string line;
-        std::vector<std::string> wordVec;
-        std::string buffer;
-        // parse file 1 line at a time (split on whitespace, stop on comment)
-        while (file.good())
+        std::string_view rest = std::string_view(line).substr(0, line.find('#'));
+        std::string_view code = NextWord(rest);
+        auto definition       = std::find_if(KeywordDefinitions.begin(),
+                                       KeywordDefinitions.end(),
+                                       [code](const KeywordDefinition& candidate) { return code == candidate.Code; });
+        if (definition != KeywordDefinitions.end())
         {
-            wordVec.clear();
-            buffer.clear();
-            line.clear();
-            std::getline(file, line);
-            line += " ";
-            for (size_t i = 0; i < line.size(); i++)
-            {
-                if (std::isalpha(line[i]) || line[i] == '_' || line[i] == '&')
-                {
-                    buffer += line[i];
-                }
-                else
-                {
-                    if (!buffer.empty())
-                    {
-                        wordVec.push_back(buffer);
-                        buffer.clear();
-                    }
-                    if (line[i] == '#')
-                    {
-                        break;
-                    }
-                }
-            }
-            if (wordVec.size() >= 2)
-            {
-                // Whoever is reading this, forgive me
-                // TODO: correct this heresy
-                if (wordVec[0] == "CommandType::NIL")
-                {
-                    for (size_t i = 1; i < wordVec.size(); i++)
-                    {
-                        m_CmdDict[wordVec[i]] = CommandType::None;
-                    }
-                }
-                else if (wordVec[0] == "MOVE")
-                {
-                    for (size_t i = 1; i < wordVec.size(); i++)
-                    {
-                        m_CmdDict[wordVec[i]] = CommandType::Move;
-                    }
-                }
-                else if (wordVec[0] == "GET")
-                {
-                    for (size_t i = 1; i < wordVec.size(); i++)
-                    {
-                        m_CmdDict[wordVec[i]] = CommandType::Get;
-                    }
-                }
-                else if (wordVec[0] == "BREAK")
-                {
-                    for (size_t i = 1; i < wordVec.size(); i++)
-                    {
-                        m_CmdDict[wordVec[i]] = CommandType::Break;
-                    }
-                }
-                else if (wordVec[0] == "BATTLE")
-                {
-                    for (size_t i = 1; i < wordVec.size(); i++)
-                    {
-                        m_CmdDict[wordVec[i]] = CommandType::Battle;
-                    }
-                }
-                else if (wordVec[0] == "TALK")
-                {
-                    for (size_t i = 1; i < wordVec.size(); i++)
-                    {
-                        m_CmdDict[wordVec[i]] = CommandType::Talk;
-                    }
-                }
-                else if (wordVec[0] == "TRADE")
-                {
-                    for (size_t i = 1; i < wordVec.size(); i++)
-                    {
-                        m_CmdDict[wordVec[i]] = CommandType::Trade;
-                    }
-                }
-                else if (wordVec[0] == "TURN")
-                {
-                    for (size_t i = 1; i < wordVec.size(); i++)
-                    {
-                        m_CmdDict[wordVec[i]] = CommandType::Turn;
-                    }
-                }
-                else if (wordVec[0] == "OPEN_INV")
-                {
-                    for (size_t i = 1; i < wordVec.size(); i++)
-                    {
-                        m_UICmdDict[wordVec[i]] = UICommandType::Inventory;
-                    }
-                }
-                else if (wordVec[0] == "OPEN_SKILLS")
-                {
-                    for (size_t i = 1; i < wordVec.size(); i++)
-                    {
-                        m_UICmdDict[wordVec[i]] = UICommandType::Skills;
-                    }
-                }
-                else if (wordVec[0] == "OPEN_MAP")
-                {
-                    for (size_t i = 1; i < wordVec.size(); i++)
-                    {
-                        m_UICmdDict[wordVec[i]] = UICommandType::Map;
-                    }
-                }
-                else if (wordVec[0] == "OPEN_HELP")
-                {
-                    for (size_t i = 1; i < wordVec.size(); i++)
-                    {
-                        m_UICmdDict[wordVec[i]] = UICommandType::Help;
-                    }
-                }
-                else if (wordVec[0] == "QUIT")
-                {
-                    for (size_t i = 1; i < wordVec.size(); i++)
-                    {
-                        m_UICmdDict[wordVec[i]] = UICommandType::Quit;
-                    }
-                }
-                else if (wordVec[0] == "UP")
-                {
-                    for (size_t i = 1; i < wordVec.size(); i++)
-                    {
-                        m_DirDict[wordVec[i]] = Direction::Up;
-                    }
-                }
-                else if (wordVec[0] == "RIGHT")
-                {
-                    for (size_t i = 1; i < wordVec.size(); i++)
-                    {
-                        m_DirDict[wordVec[i]] = Direction::Right;
-                    }
-                }
-                else if (wordVec[0] == "DOWN")
-                {
-                    for (size_t i = 1; i < wordVec.size(); i++)
-                    {
-                        m_DirDict[wordVec[i]] = Direction::Down;
-                    }
-                }
-                else if (wordVec[0] == "LEFT")
-                {
-                    for (size_t i = 1; i < wordVec.size(); i++)
-                    {
-                        m_DirDict[wordVec[i]] = Direction::Left;
-                    }
-                }
-                else if (wordVec[0] == "AND")
-                {
-                    for (size_t i = 1; i < wordVec.size(); i++)
-                    {
-                        m_AndKeywords.push_back(wordVec[i]);
-                    }
-                }
-                else if (wordVec[0] == "LAST")
-                {
-                    for (size_t i = 1; i < wordVec.size(); i++)
-                    {
-                        m_LastKeywords.push_back(wordVec[i]);
-                    }
-                }
-            }
+            size_t index        = definition - KeywordDefinitions.begin();
+            isConfigured[index] = true;
+            configured[index] += rest;
+            configured[index] += ' ';
+        }
+    }
+
+    m_Keywords.Clear();
+    for (size_t i = 0; i < KeywordDefinitions.size(); i++)
+    {
+        if (!isConfigured[i])
+        {
+            AddKeywords(m_Keywords, KeywordDefinitions[i].Keywords, KeywordDefinitions[i].Meaning);
+        }
+    }
+    for (size_t i = 0; i < KeywordDefinitions.size(); i++)
+    {
+        if (isConfigured[i])
+        {
+            AddKeywords(m_Keywords, configured[i], KeywordDefinitions[i].Meaning);
         }
     }
 }
@@ -398,6 +278,7 @@ void InputHandler::ProcessKeypress()
         key = ReadKeypress({ 'w',      'd',      's', 'a', 'W', 'D', 'S', 'A', KEY_UP, KEY_RIGHT,
                              KEY_DOWN, KEY_LEFT, 'q', 'e', 'c', 'z', 'f', ' ', 'm',    27 });
     }
+    InputLatency::Begin();
 
     switch (key.value())
     {
@@ -430,24 +311,28 @@ void InputHandler::ProcessKeypress()
         m_CommandQueue.emplace(CommandType::Turn, Direction::Left, 1);
         break;
     case 'q':
+        InputLatency::Classify(InputLatency::Category::Move);
         if (!m_PlayerController.TryMovePlayerDiagonally(Direction::Up, Direction::Left))
         {
             m_Screen.PostMessage(CannotMoveMessage);
         }
         break;
     case 'e':
+        InputLatency::Classify(InputLatency::Category::Move);
         if (!m_PlayerController.TryMovePlayerDiagonally(Direction::Up, Direction::Right))
         {
             m_Screen.PostMessage(CannotMoveMessage);
         }
         break;
     case 'c':
+        InputLatency::Classify(InputLatency::Category::Move);
         if (!m_PlayerController.TryMovePlayerDiagonally(Direction::Down, Direction::Right))
         {
             m_Screen.PostMessage(CannotMoveMessage);
         }
         break;
     case 'z':
+        InputLatency::Classify(InputLatency::Category::Move);
         if (!m_PlayerController.TryMovePlayerDiagonally(Direction::Down, Direction::Left))
         {
             m_Screen.PostMessage(CannotMoveMessage);
@@ -459,6 +344,7 @@ void InputHandler::ProcessKeypress()
     case ' ':
     {
         std::string input = CommandInput();
+        InputLatency::Begin();
         m_Screen.Draw();
         if (!input.empty())
         {
@@ -481,7 +367,7 @@ void InputHandler::ProcessKeypress()
 std::optional<chtype> InputHandler::ReadKeypress(const std::vector<chtype>& validInput, WINDOW* window)
 {
     flushinp();
-    chtype ch = wgetch(window);
+    chtype ch = ReadKey(window);
     auto it   = std::find(validInput.begin(), validInput.end(), ch);
     return it != validInput.end() ? *it : std::optional<chtype>();
 }
@@ -506,6 +392,7 @@ bool InputHandler::ExecCommand(Command& command)
     case CommandType::None:
         break;
     case CommandType::Move:
+        InputLatency::Classify(InputLatency::Category::Move);
         if (command.Dir == Direction::None)
         {
             messageStream << "No direction given.";
@@ -562,6 +449,28 @@ void InputHandler::ExecUICommand(UICommandType type)
     case UICommandType::Map:
         m_Screen.ShowMap();
         break;
+    case UICommandType::Profile:
+        if (!Profiler::IsEnabled())
+        {
+            m_Screen.PostMessage("Profiling is disabled in this build.");
+        }
+        else if (Profiler::DumpToFile(Profiler::ReportFilename))
+        {
+            m_Screen.PostMessage("Subsystem timings written to " + Profiler::ReportFilename + ".");
+        }
+        else
+        {
+            m_Screen.PostMessage("Could not write " + Profiler::ReportFilename + ".");
+        }
+        break;
+    case UICommandType::Speed:
+        m_Screen.SetPresentationSpeed(Animation::NextPresentationSpeed(m_Screen.GetPresentationSpeed()));
+        m_Screen.PostMessage("Animation speed set to " + Animation::PresentationSpeedName(m_Screen.GetPresentationSpeed())
+                             + ".");
+        break;
+    case UICommandType::Latency:
+        m_Screen.SetLatencyOverlay(!m_Screen.IsLatencyOverlayShown());
+        break;
     case UICommandType::Quit:
         if (m_Screen.YesNoMessageBox("Are you sure you want to quit?"))
         {
@@ -573,80 +482,73 @@ void InputHandler::ExecUICommand(UICommandType type)
     }
 }
 
-void InputHandler::EvalWorld(std::vector<std::string>& words)
+void InputHandler::EvalWorld(std::string_view input)
 {
     static const std::string CommandNotUnderstoodMessage = "Command not understood.";
-    if (words.empty())
-    {
-        m_Screen.PostMessage(CommandNotUnderstoodMessage);
-        return;
-    }
-
-    auto nextAndKeyword = words.begin();
+    bool isChained                                       = false;
+    bool isInputLeft                                     = true;
 
-    do
+    // Commands are separated by AND keywords, which are found in the same pass as the rest
+    while (isInputLeft)
     {
-        Command cmd;
-        bool lastCalled = false;
-        nextAndKeyword  = std::find_if(words.begin(), words.end(), [&, words, this](const std::string& candidate) {
-            return std::find(m_AndKeywords.begin(), m_AndKeywords.end(), candidate) != m_AndKeywords.end();
-        });
-        bool understood = false;
-        // Look for command keywords
-        for (auto it = words.begin(); it != nextAndKeyword; it++)
+        std::optional<Keyword> action;
+        Direction dir = Direction::None;
+        int repeats   = 0;
+        int wordCount = 0;
+        isInputLeft   = false;
+        for (auto word = NextWord(input); !word.empty(); word = NextWord(input))
         {
-            if (m_CmdDict.count(*it) > 0)
+            Keyword keyword = m_Keywords.Find(word);
+            if (keyword.Type == Keyword::Kind::And)
             {
-                cmd.Type   = m_CmdDict[*it];
-                understood = true;
+                isInputLeft = true;
                 break;
             }
-            else if (std::find(m_LastKeywords.begin(), m_LastKeywords.end(), *it) != m_LastKeywords.end())
+            wordCount++;
+
+            // The first command or LAST keyword decides the command, the last number and direction win
+            if (!action && (keyword.Type == Keyword::Kind::Command || keyword.Type == Keyword::Kind::Last))
             {
-                // look for LAST
-                cmd        = m_LastCommand;
-                lastCalled = true;
-                understood = true;
-                break;
+                action = keyword;
+            }
+            else if (keyword.Type == Keyword::Kind::Direction)
+            {
+                dir = static_cast<Direction::Value>(keyword.Code);
+            }
+            int number = 0;
+            std::from_chars(word.data(), word.data() + word.size(), number);
+            if (number > 0)
+            {
+                repeats = number;
             }
         }
-        if (!understood)
+
+        // Trailing AND keywords are harmless
+        if (wordCount == 0 && isChained && !isInputLeft)
         {
-            m_Screen.PostMessage(CommandNotUnderstoodMessage);
             break;
         }
-        for (auto it = words.begin(); it != nextAndKeyword; it++)
+        if (!action)
         {
-            // look for numbers
-            int repeats = std::atoi(it->c_str());
-            if (repeats > 0)
-            {
-                cmd.Repeats = repeats;
-                if (lastCalled)
-                {
-                    cmd.Repeats *= m_LastCommand.Repeats;
-                }
-                if (cmd.Repeats > 500)
-                    cmd.Repeats = 500;
-            }
+            m_Screen.PostMessage(CommandNotUnderstoodMessage);
+            break;
+        }
 
-            // look for direction keywords
-            if (m_DirDict.count(*it) > 0)
-            {
-                cmd.Dir = m_DirDict[*it];
-            }
+        bool lastCalled = action->Type == Keyword::Kind::Last;
+        Command cmd     = lastCalled ? m_LastCommand : Command(static_cast<CommandType>(action->Code), Direction::None, 1);
+        if (repeats > 0)
+        {
+            cmd.Repeats = std::min(lastCalled ? repeats * m_LastCommand.Repeats : repeats, 500);
+        }
+        if (dir != Direction::None)
+        {
+            cmd.Dir = dir;
         }
 
         m_CommandQueue.push(cmd);
-
         m_LastCommand = cmd;
-
-        if (nextAndKeyword != words.end())
-        {
-            words.erase(words.begin(), nextAndKeyword + 1);
-            nextAndKeyword = words.begin();
-        }
-    } while (nextAndKeyword != words.end());
+        isChained     = true;
+    }
 }
 
 std::string InputHandler::CommandInput()
@@ -668,7 +570,7 @@ std::string InputHandler::CommandInput()
     input.resize(Screen::ScreenWidth - 25, 0);
     int ch;
     size_t pos = 0;
-    while ((ch = wgetch(inputWindow)) != '\n' && ch != 27)
+    while ((ch = ReadKey(inputWindow)) != '\n' && ch != 27)
     {
         if (pos > 0 && (ch == KEY_BACKSPACE || ch == 127 || ch == '\b'))
         {
@@ -2,12 +2,13 @@
 
 #include "Entities/Character.h"
 #include "Misc/Direction.h"
+#include "KeywordTable.h"
 #include "Player/Controller.h"
 #include <iostream>
-#include <map>
 #include <optional>
 #include <queue>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace UI
@@ -42,6 +43,9 @@ public:
         Skills,
         Map,
         Help,
+        Profile,
+        Speed,
+        Latency,
         Quit
     };
 
@@ -63,7 +67,7 @@ public:
      * 
      * @param input input string
      */
-    void Eval(const std::string& input);
+    void Eval(std::string_view input);
 
     /**
      * @brief Check if the player has requested to quit the game
@@ -131,11 +135,7 @@ private:
     std::string m_InputString;
     Command m_LastCommand;
     std::queue<InputHandler::Command> m_CommandQueue;
-    std::map<std::string, Direction> m_DirDict;
-    std::map<std::string, CommandType> m_CmdDict;
-    std::map<std::string, UICommandType> m_UICmdDict;
-    std::vector<std::string> m_AndKeywords;
-    std::vector<std::string> m_LastKeywords;
+    KeywordTable m_Keywords;
     bool m_ShouldQuit;
 
     /**
@@ -156,9 +156,9 @@ private:
     /**
      * @brief Evaluate input from the world view
      * 
-     * @param words input split into words
+     * @param input input string
      */
-    void EvalWorld(std::vector<std::string>& words);
+    void EvalWorld(std::string_view input);
 
     /**
      * @brief Get long-form text input via visual prompt
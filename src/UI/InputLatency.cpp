@@ -0,0 +1,131 @@
+#include "InputLatency.h"
+#include <array>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+
+namespace UI::InputLatency
+{
+
+/**
+ * @brief Latencies of every category in nanoseconds
+ */
+static std::array<Histogram, CategoryCount> latencies;
+
+/**
+ * @brief Start of the measurement in progress
+ */
+static std::chrono::steady_clock::time_point start;
+
+/**
+ * @brief Category of the measurement in progress
+ */
+static Category current = Category::Other;
+
+/**
+ * @brief Whether a measurement is in progress
+ */
+static bool isMeasuring = false;
+
+/**
+ * @brief Whether commands are measured at all
+ */
+static bool isEnabled = false;
+
+void SetEnabled(bool enabled)
+{
+    isEnabled   = enabled;
+    isMeasuring = isMeasuring && enabled;
+}
+
+bool IsEnabled()
+{
+    return isEnabled;
+}
+
+void Begin(Category category)
+{
+    if (!isEnabled)
+        return;
+
+    start       = std::chrono::steady_clock::now();
+    current     = category;
+    isMeasuring = true;
+}
+
+void Classify(Category category)
+{
+    if (static_cast<int>(category) > static_cast<int>(current))
+        current = category;
+}
+
+void End()
+{
+    if (!isMeasuring)
+        return;
+
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    latencies[static_cast<int>(current)].Record(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    isMeasuring = false;
+}
+
+const Histogram& GetLatencies(Category category)
+{
+    return latencies[static_cast<int>(category)];
+}
+
+const char* CategoryName(Category category)
+{
+    static const std::array<const char*, CategoryCount> names { "other", "move", "map open", "battle start",
+                                                                "room transition" };
+    return names[static_cast<int>(category)];
+}
+
+bool HasSamples()
+{
+    for (const auto& histogram : latencies)
+    {
+        if (histogram.Count() > 0)
+            return true;
+    }
+    return false;
+}
+
+void Dump(std::ostream& os)
+{
+    auto toMilliseconds = [](uint64_t ns) { return ns / 1e6; };
+
+    os << "# Dun-geon keypress-to-frame latency (ms)\n";
+    os << std::left << std::setw(32) << "command" << std::right << std::setw(10) << "count" << std::setw(12) << "p50"
+       << std::setw(12) << "p99" << std::setw(12) << "max" << '\n';
+    os << std::fixed << std::setprecision(3);
+    for (int i = 0; i < CategoryCount; i++)
+    {
+        const auto& hist = latencies[i];
+        os << std::left << std::setw(32) << CategoryName(static_cast<Category>(i)) << std::right << std::setw(10)
+           << hist.Count() << std::setw(12) << toMilliseconds(hist.Percentile(0.5)) << std::setw(12)
+           << toMilliseconds(hist.Percentile(0.99)) << std::setw(12) << toMilliseconds(hist.Max()) << '\n';
+    }
+}
+
+bool DumpToFile(const std::string& filename)
+{
+    std::ofstream file(filename);
+    if (!file.good())
+    {
+        return false;
+    }
+    Dump(file);
+    return file.good();
+}
+
+void Reset()
+{
+    for (auto& histogram : latencies)
+    {
+        histogram.Reset();
+    }
+    isMeasuring = false;
+}
+
+} /* namespace UI::InputLatency */
@@ -0,0 +1,114 @@
+#pragma once
+
+#include "Misc/Histogram.h"
+#include <iostream>
+#include <string>
+
+/**
+ * @brief Keypress-to-frame latency of game commands
+ * A measurement starts when a command key has been read and ends when the game next waits for a key,
+ * by which point the frame reflecting the command has been refreshed on the terminal.
+ * Nothing is measured unless enabled, which the game only does for interactive sessions started with --latency.
+ */
+namespace UI::InputLatency
+{
+
+/**
+ * @brief File the report is written to on exit
+ */
+static const std::string ReportFilename = "data/latency.txt";
+
+/**
+ * @brief Kinds of commands measured, a command counts as the highest kind it turned out to involve
+ */
+enum class Category
+{
+    Other,
+    Move,
+    MapOpen,
+    BattleStart,
+    RoomTransition
+};
+
+/**
+ * @brief Number of categories
+ */
+constexpr static const int CategoryCount = 5;
+
+/**
+ * @brief Turn measuring on or off, turning it off drops the measurement in progress
+ * 
+ * @param isEnabled true to measure
+ */
+void SetEnabled(bool isEnabled);
+
+/**
+ * @brief Check whether commands are being measured
+ * 
+ * @return true if enabled
+ */
+bool IsEnabled();
+
+/**
+ * @brief Start measuring a command if enabled, discarding an unfinished measurement
+ * 
+ * @param category initial category
+ */
+void Begin(Category category = Category::Other);
+
+/**
+ * @brief Raise the category of the command being measured, if any
+ * 
+ * @param category category
+ */
+void Classify(Category category);
+
+/**
+ * @brief Finish the measurement in progress, if any, and record it
+ */
+void End();
+
+/**
+ * @brief Get the latencies recorded for a category
+ * 
+ * @param category category
+ * @return const Histogram& latencies in nanoseconds
+ */
+const Histogram& GetLatencies(Category category);
+
+/**
+ * @brief Get the display name of a category
+ * 
+ * @param category category
+ * @return const char* name
+ */
+const char* CategoryName(Category category);
+
+/**
+ * @brief Check whether any latency has been recorded
+ * 
+ * @return true if there is at least one sample
+ */
+bool HasSamples();
+
+/**
+ * @brief Write a report of all categories into the given stream
+ * 
+ * @param os output stream
+ */
+void Dump(std::ostream& os);
+
+/**
+ * @brief Write a report of all categories into the file with the given name
+ * 
+ * @param filename filename
+ * @return true if written successfully
+ */
+bool DumpToFile(const std::string& filename);
+
+/**
+ * @brief Remove all samples and stop the measurement in progress
+ */
+void Reset();
+
+} /* namespace UI::InputLatency */
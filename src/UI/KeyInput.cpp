@@ -0,0 +1,57 @@
+#include "KeyInput.h"
+#include "InputLatency.h"
+#include <algorithm>
+
+namespace UI
+{
+
+/**
+ * @brief Attached key tape
+ */
+static KeyTape* keyTape = nullptr;
+
+void SetKeyTape(KeyTape* tape)
+{
+    keyTape = tape;
+}
+
+KeyTape* GetKeyTape()
+{
+    return keyTape;
+}
+
+int ReadKey(WINDOW* window)
+{
+    if (keyTape)
+    {
+        if (auto key = keyTape->ReplayKey(false))
+            return key.value();
+    }
+
+    // Whatever the last command changed is on the terminal by the time the game waits for the player again;
+    // replayed keys never wait, so they leave the measurement to be discarded by the next one
+    InputLatency::End();
+    int key = wgetch(window);
+    if (keyTape && key != ERR)
+        keyTape->RecordKey(key, false);
+    return key;
+}
+
+int PollKey(WINDOW* window, int timeoutMs)
+{
+    if (keyTape)
+    {
+        if (auto key = keyTape->ReplayKey(true))
+            return key.value();
+    }
+
+    InputLatency::End();
+    wtimeout(window, std::max(timeoutMs, 0));
+    int key = wgetch(window);
+    wtimeout(window, -1);
+    if (keyTape && key != ERR)
+        keyTape->RecordKey(key, true);
+    return key;
+}
+
+} /* namespace UI */
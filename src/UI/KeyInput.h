@@ -0,0 +1,69 @@
+#pragma once
+
+#include <ncurses.h>
+#include <optional>
+
+namespace UI
+{
+
+/**
+ * @brief Hook which sees every key read from the terminal and may supply keys instead,
+ * used to record sessions or to replay recorded ones
+ */
+class KeyTape
+{
+public:
+    /**
+     * @brief Destructor
+     */
+    virtual ~KeyTape() = default;
+
+    /**
+     * @brief Called before waiting for a key
+     *
+     * @param isPoll true if the caller only polls for a key, e.g. to skip an animation
+     * @return std::optional<int> key to use (ERR for no key), or empty to read one from the terminal
+     */
+    virtual std::optional<int> ReplayKey(bool isPoll) = 0;
+
+    /**
+     * @brief Called for every key read from the terminal, polls that timed out excluded
+     *
+     * @param key key code
+     * @param isPoll true if the key was read by a poll
+     */
+    virtual void RecordKey(int key, bool isPoll) = 0;
+};
+
+/**
+ * @brief Attach a key tape
+ *
+ * @param tape tape (null to detach)
+ */
+void SetKeyTape(KeyTape* tape);
+
+/**
+ * @brief Get the attached key tape
+ *
+ * @return KeyTape* tape, null if none
+ */
+KeyTape* GetKeyTape();
+
+/**
+ * @brief Wait for a keypress, going through the attached key tape
+ *
+ * @param window window to read from
+ * @return int key code
+ */
+int ReadKey(WINDOW* window);
+
+/**
+ * @brief Wait a limited time for a keypress, going through the attached key tape
+ *
+ * @param window window to read from
+ * @param timeoutMs maximum time to wait in milliseconds
+ * @return int key code or ERR if nothing was pressed in time
+ */
+int PollKey(WINDOW* window, int timeoutMs);
+
+} /* namespace UI */
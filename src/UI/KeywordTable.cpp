@@ -0,0 +1,118 @@
+#include "KeywordTable.h"
+#include <cctype>
+
+namespace UI
+{
+
+KeywordTable::KeywordTable() : m_Nodes(1)
+{
+}
+
+bool KeywordTable::Add(std::string_view word, Keyword keyword)
+{
+    if (word.empty())
+        return false;
+    for (char ch : word)
+    {
+        if (Slot(ch) < 0)
+            return false;
+    }
+
+    uint16_t index = 0;
+    for (char ch : word)
+    {
+        int slot = Slot(ch);
+        if (m_Nodes[index].Children[slot] == 0)
+        {
+            m_Nodes[index].Children[slot] = static_cast<uint16_t>(m_Nodes.size());
+            m_Nodes.emplace_back();
+        }
+        index = m_Nodes[index].Children[slot];
+    }
+    m_Nodes[index].Exact = keyword;
+
+    // Replacing a meaning can make prefixes unambiguous again, so resolve from scratch; the table is tiny
+    Resolve(0);
+    return true;
+}
+
+void KeywordTable::Clear()
+{
+    m_Nodes.assign(1, Node());
+}
+
+Keyword KeywordTable::Find(std::string_view word) const
+{
+    if (word.empty())
+        return Keyword();
+
+    uint16_t index = 0;
+    for (char ch : word)
+    {
+        int slot = Slot(ch);
+        if (slot < 0 || m_Nodes[index].Children[slot] == 0)
+            return Keyword();
+        index = m_Nodes[index].Children[slot];
+    }
+
+    const Node& node = m_Nodes[index];
+    if (node.Exact.Type != Keyword::Kind::None)
+        return node.Exact;
+    return node.IsAmbiguous ? Keyword() : node.Unique;
+}
+
+bool KeywordTable::IsKeywordChar(char ch)
+{
+    return Slot(ch) >= 0;
+}
+
+int KeywordTable::Slot(char ch)
+{
+    if (ch >= 'a' && ch <= 'z')
+        return ch - 'a';
+    if (ch >= '0' && ch <= '9')
+        return 26 + ch - '0';
+    if (ch == '_')
+        return 36;
+    if (ch == '&')
+        return 37;
+    return -1;
+}
+
+void KeywordTable::Resolve(uint16_t index)
+{
+    Keyword unique   = m_Nodes[index].Exact;
+    bool isAmbiguous = false;
+    for (int slot = 0; slot < AlphabetSize; slot++)
+    {
+        uint16_t child = m_Nodes[index].Children[slot];
+        if (child == 0)
+            continue;
+
+        Resolve(child);
+        const Node& childNode = m_Nodes[child];
+        if (childNode.IsAmbiguous || (unique.Type != Keyword::Kind::None && childNode.Unique != unique))
+            isAmbiguous = true;
+        else
+            unique = childNode.Unique;
+    }
+
+    m_Nodes[index].Unique      = isAmbiguous ? Keyword() : unique;
+    m_Nodes[index].IsAmbiguous = isAmbiguous;
+}
+
+std::string_view NextWord(std::string_view& input)
+{
+    size_t start = 0;
+    while (start < input.size() && std::isspace(static_cast<unsigned char>(input[start])))
+        start++;
+    size_t end = start;
+    while (end < input.size() && !std::isspace(static_cast<unsigned char>(input[end])))
+        end++;
+
+    std::string_view word = input.substr(start, end - start);
+    input.remove_prefix(end);
+    return word;
+}
+
+} /* namespace UI */
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace UI
+{
+
+/**
+ * @brief Meaning of a command keyword
+ */
+struct Keyword
+{
+    /**
+     * @brief Keyword kinds
+     */
+    enum class Kind : uint8_t
+    {
+        None,
+        Command,
+        UICommand,
+        Direction,
+        And,
+        Last
+    };
+
+    Kind Type    = Kind::None;
+    uint8_t Code = 0;
+
+    /**
+     * @brief Constructor
+     */
+    constexpr Keyword() = default;
+
+    /**
+     * @brief Constructor
+     *
+     * @tparam CodeType enum of the codes of this kind
+     * @param type kind
+     * @param code code within the kind, e.g. the command type
+     */
+    template <typename CodeType>
+    constexpr Keyword(Kind type, CodeType code) : Type(type), Code(static_cast<uint8_t>(code))
+    {
+    }
+
+    inline bool operator==(const Keyword& other) const { return Type == other.Type && Code == other.Code; }
+    inline bool operator!=(const Keyword& other) const { return !(*this == other); }
+};
+
+/**
+ * @brief Trie of command keywords which also resolves unambiguous prefixes
+ * A prefix resolves to a keyword if every keyword starting with it has the same meaning,
+ * so "inve" opens the inventory like "inv" and "inventory" do, but "ba" matches neither "bag" nor "battle".
+ * Keywords consist of lowercase letters, digits, '_' and '&'.
+ */
+class KeywordTable
+{
+public:
+    /**
+     * @brief Constructor
+     */
+    KeywordTable();
+
+    /**
+     * @brief Add a keyword, replacing its previous meaning if it is already present
+     *
+     * @param word keyword
+     * @param keyword meaning
+     * @return true if added, false if the word is empty or has unsupported characters
+     */
+    bool Add(std::string_view word, Keyword keyword);
+
+    /**
+     * @brief Remove all keywords
+     */
+    void Clear();
+
+    /**
+     * @brief Look up a word
+     *
+     * @param word complete keyword or unambiguous prefix of one
+     * @return Keyword meaning, of kind None if not found or ambiguous
+     */
+    Keyword Find(std::string_view word) const;
+
+    /**
+     * @brief Check whether a character may appear in keywords
+     *
+     * @param ch character
+     * @return true if allowed
+     */
+    static bool IsKeywordChar(char ch);
+
+private:
+    constexpr static const int AlphabetSize = 26 + 10 + 2;
+
+    /**
+     * @brief Trie node, children are indexes into m_Nodes with 0 meaning none
+     */
+    struct Node
+    {
+        std::array<uint16_t, AlphabetSize> Children {};
+        Keyword Exact;
+        Keyword Unique;
+        bool IsAmbiguous = false;
+    };
+
+    std::vector<Node> m_Nodes;
+
+    /**
+     * @brief Map a character to its child slot
+     *
+     * @param ch character
+     * @return int slot, -1 if the character is not allowed in keywords
+     */
+    static int Slot(char ch);
+
+    /**
+     * @brief Recompute which prefixes in a subtree resolve to a single meaning
+     *
+     * @param index subtree root
+     */
+    void Resolve(uint16_t index);
+};
+
+/**
+ * @brief Split the next whitespace-separated word off the front of a string without copying it
+ *
+ * @param input remaining input, advanced past the word
+ * @return std::string_view word, empty at the end of the input
+ */
+std::string_view NextWord(std::string_view& input);
+
+} /* namespace UI */
@@ -0,0 +1,45 @@
+#include "HeadlessRenderBackend.h"
+
+namespace UI::Render
+{
+
+HeadlessRenderBackend::HeadlessRenderBackend(int height, int width) : m_Frame(height, width)
+{
+}
+
+BackendType HeadlessRenderBackend::GetType() const
+{
+    return BackendType::Headless;
+}
+
+std::unique_ptr<RenderTarget> HeadlessRenderBackend::CreateTarget(int height, int width, int y, int x)
+{
+    return std::make_unique<MemoryRenderTarget>(height, width, y, x, &m_Frame);
+}
+
+RenderTarget& HeadlessRenderBackend::RootTarget()
+{
+    return m_Frame;
+}
+
+void HeadlessRenderBackend::Flush()
+{
+    // Staging already writes into the frame
+}
+
+int HeadlessRenderBackend::ReadKey(RenderTarget& focus)
+{
+    return '\n';
+}
+
+int HeadlessRenderBackend::PollKey(int timeoutMs)
+{
+    return '\n';
+}
+
+const MemoryRenderTarget& HeadlessRenderBackend::Frame() const
+{
+    return m_Frame;
+}
+
+} /* namespace UI::Render */
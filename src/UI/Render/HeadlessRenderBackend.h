@@ -0,0 +1,43 @@
+#pragma once
+
+#include "MemoryRenderTarget.h"
+#include "RenderBackend.h"
+
+namespace UI::Render
+{
+
+/**
+ * @brief Render backend drawing into memory, for benchmarks, tests and runs without a terminal
+ * Staged targets are composited into a single frame which can be inspected at any time.
+ * Keypresses cannot be read, so prompts are confirmed automatically.
+ */
+class HeadlessRenderBackend : public RenderBackend
+{
+public:
+    /**
+     * @brief Constructor
+     * 
+     * @param height screen height
+     * @param width screen width
+     */
+    HeadlessRenderBackend(int height, int width);
+
+    virtual BackendType GetType() const override;
+    virtual std::unique_ptr<RenderTarget> CreateTarget(int height, int width, int y, int x) override;
+    virtual RenderTarget& RootTarget() override;
+    virtual void Flush() override;
+    virtual int ReadKey(RenderTarget& focus) override;
+    virtual int PollKey(int timeoutMs) override;
+
+    /**
+     * @brief Get the composited frame
+     * 
+     * @return const MemoryRenderTarget& frame
+     */
+    const MemoryRenderTarget& Frame() const;
+
+private:
+    MemoryRenderTarget m_Frame;
+};
+
+} /* namespace UI::Render */
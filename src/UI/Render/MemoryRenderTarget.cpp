@@ -0,0 +1,167 @@
+#include "MemoryRenderTarget.h"
+#include <algorithm>
+
+namespace UI::Render
+{
+
+/**
+ * @brief Make the ACS_* line-drawing constants usable without a terminal
+ * Before initscr the alternate character set map is empty, so every ACS_* constant
+ * would be 0. The standard VT100 mapping is filled in instead; initscr replaces it later.
+ */
+static void EnsureAlternateCharset()
+{
+    if (acs_map[static_cast<unsigned char>('q')] != 0)
+        return;
+
+    for (unsigned char ch : std::string("`afgjklmnopqrstuvwxyz{|}~+,-.0hi"))
+    {
+        acs_map[ch] = ch | A_ALTCHARSET;
+    }
+}
+
+MemoryRenderTarget::MemoryRenderTarget(int height, int width, int y, int x, MemoryRenderTarget* composite)
+    : m_Surface(std::make_shared<Surface>(Surface { width, std::vector<chtype>(width * height, ' ') })),
+      m_OffsetY(0),
+      m_OffsetX(0),
+      m_Height(height),
+      m_Width(width),
+      m_ScreenY(y),
+      m_ScreenX(x),
+      m_Composite(composite)
+{
+    EnsureAlternateCharset();
+}
+
+MemoryRenderTarget::MemoryRenderTarget(std::shared_ptr<Surface> surface,
+                                       int offsetY,
+                                       int offsetX,
+                                       int height,
+                                       int width,
+                                       int screenY,
+                                       int screenX,
+                                       MemoryRenderTarget* composite)
+    : m_Surface(std::move(surface)),
+      m_OffsetY(offsetY),
+      m_OffsetX(offsetX),
+      m_Height(height),
+      m_Width(width),
+      m_ScreenY(screenY),
+      m_ScreenX(screenX),
+      m_Composite(composite)
+{
+}
+
+int MemoryRenderTarget::Width() const
+{
+    return m_Width;
+}
+
+int MemoryRenderTarget::Height() const
+{
+    return m_Height;
+}
+
+chtype MemoryRenderTarget::CellAt(int y, int x) const
+{
+    if (y < 0 || y >= m_Height || x < 0 || x >= m_Width)
+        return 0;
+    return m_Surface->Cells[(m_OffsetY + y) * m_Surface->Width + m_OffsetX + x];
+}
+
+void MemoryRenderTarget::Erase()
+{
+    for (int y = 0; y < m_Height; y++)
+    {
+        auto row = m_Surface->Cells.begin() + (m_OffsetY + y) * m_Surface->Width + m_OffsetX;
+        std::fill(row, row + m_Width, ' ');
+    }
+}
+
+void MemoryRenderTarget::Stage()
+{
+    if (m_Composite != nullptr)
+        m_Composite->Blit(*this, m_ScreenY, m_ScreenX);
+}
+
+void MemoryRenderTarget::Present()
+{
+    Stage();
+}
+
+void MemoryRenderTarget::Invalidate()
+{
+    // Staging always copies the whole target
+}
+
+void MemoryRenderTarget::MoveTo(int y, int x)
+{
+    m_ScreenY = y;
+    m_ScreenX = x;
+}
+
+void MemoryRenderTarget::Resize(int height, int width)
+{
+    // Sub-targets cannot grow beyond their parent
+    if (m_Surface.use_count() > 1 || m_OffsetY != 0 || m_OffsetX != 0)
+    {
+        m_Height = std::min(height, static_cast<int>(m_Surface->Cells.size()) / m_Surface->Width - m_OffsetY);
+        m_Width  = std::min(width, m_Surface->Width - m_OffsetX);
+        return;
+    }
+
+    std::vector<chtype> cells(width * height, ' ');
+    for (int y = 0; y < std::min(height, m_Height); y++)
+    {
+        for (int x = 0; x < std::min(width, m_Width); x++)
+        {
+            cells[y * width + x] = CellAt(y, x);
+        }
+    }
+    m_Surface->Width = width;
+    m_Surface->Cells = std::move(cells);
+    m_Height         = height;
+    m_Width          = width;
+}
+
+std::unique_ptr<RenderTarget> MemoryRenderTarget::CreateSubTarget(int height, int width, int y, int x)
+{
+    height = std::clamp(height, 0, m_Height - y);
+    width  = std::clamp(width, 0, m_Width - x);
+    return std::unique_ptr<RenderTarget>(new MemoryRenderTarget(
+        m_Surface, m_OffsetY + y, m_OffsetX + x, height, width, m_ScreenY + y, m_ScreenX + x, m_Composite));
+}
+
+void MemoryRenderTarget::Blit(const RenderTarget& source, int y, int x)
+{
+    for (int i = 0; i < source.Height(); i++)
+    {
+        if (y + i < 0 || y + i >= m_Height)
+            continue;
+        for (int j = 0; j < source.Width(); j++)
+        {
+            if (x + j < 0 || x + j >= m_Width)
+                continue;
+            SetCell(y + i, x + j, source.CellAt(i, j));
+        }
+    }
+}
+
+std::string MemoryRenderTarget::Snapshot() const
+{
+    std::string snapshot;
+    snapshot.reserve((m_Width + 1) * m_Height);
+    for (int y = 0; y < m_Height; y++)
+    {
+        snapshot += RowText(y);
+        snapshot += '\n';
+    }
+    return snapshot;
+}
+
+void MemoryRenderTarget::SetCell(int y, int x, chtype ch)
+{
+    m_Surface->Cells[(m_OffsetY + y) * m_Surface->Width + m_OffsetX + x] = ch;
+}
+
+} /* namespace UI::Render */
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "RenderTarget.h"
+#include <memory>
+#include <vector>
+
+namespace UI::Render
+{
+
+/**
+ * @brief Render target drawing into a grid of cells in memory
+ * Works without a terminal. Targets can present themselves into a composite target
+ * which then holds the full frame, the same way ncurses windows are refreshed onto the screen.
+ */
+class MemoryRenderTarget : public RenderTarget
+{
+public:
+    /**
+     * @brief Constructor
+     * 
+     * @param height height
+     * @param width width
+     * @param y Y position on the screen
+     * @param x X position on the screen
+     * @param composite target to copy the contents into when staged (default: nullptr = none)
+     */
+    MemoryRenderTarget(int height, int width, int y = 0, int x = 0, MemoryRenderTarget* composite = nullptr);
+
+    virtual int Width() const override;
+    virtual int Height() const override;
+    virtual chtype CellAt(int y, int x) const override;
+    virtual void Erase() override;
+    virtual void Stage() override;
+    virtual void Present() override;
+    virtual void Invalidate() override;
+    virtual void MoveTo(int y, int x) override;
+    virtual void Resize(int height, int width) override;
+    virtual std::unique_ptr<RenderTarget> CreateSubTarget(int height, int width, int y, int x) override;
+
+    /**
+     * @brief Copy the contents of another target into this one
+     * 
+     * @param source source target
+     * @param y Y position of the source within this target
+     * @param x X position of the source within this target
+     */
+    void Blit(const RenderTarget& source, int y, int x);
+
+    /**
+     * @brief Get the text of all rows separated by newlines, for golden frame comparisons
+     * 
+     * @return std::string text snapshot
+     */
+    std::string Snapshot() const;
+
+protected:
+    virtual void SetCell(int y, int x, chtype ch) override;
+
+private:
+    /**
+     * @brief Cell storage shared between a target and its sub-targets
+     */
+    struct Surface
+    {
+        int Width;
+        std::vector<chtype> Cells;
+    };
+
+    std::shared_ptr<Surface> m_Surface;
+    int m_OffsetY, m_OffsetX;
+    int m_Height, m_Width;
+    int m_ScreenY, m_ScreenX;
+    MemoryRenderTarget* m_Composite;
+
+    /**
+     * @brief Constructor for sub-targets
+     */
+    MemoryRenderTarget(std::shared_ptr<Surface> surface,
+                       int offsetY,
+                       int offsetX,
+                       int height,
+                       int width,
+                       int screenY,
+                       int screenX,
+                       MemoryRenderTarget* composite);
+};
+
+} /* namespace UI::Render */
@@ -0,0 +1,84 @@
+#include "NcursesRenderBackend.h"
+#include "ColorPairs.h"
+#include "KeyInput.h"
+#include "Misc/Exceptions.h"
+#include <cstdio>
+
+namespace UI::Render
+{
+
+NcursesRenderBackend::NcursesRenderBackend(bool offscreen) : m_Screen(nullptr), m_NullDevice(nullptr)
+{
+    if (offscreen)
+    {
+        // Any terminal type with cursor addressing will do, nothing ever reaches it
+        m_NullDevice = std::fopen("/dev/null", "r+");
+        if (m_NullDevice)
+            m_Screen = newterm("xterm", m_NullDevice, m_NullDevice);
+        if (!m_Screen)
+        {
+            if (m_NullDevice)
+                std::fclose(m_NullDevice);
+            throw DisplayException("Could not set up a null terminal");
+        }
+    }
+    else
+    {
+        initscr();
+    }
+    start_color();
+    use_default_colors();
+    raw();
+    keypad(stdscr, true);
+    noecho();
+    curs_set(0);
+    ESCDELAY = 0;
+
+    ColorPairs::InitPairs();
+
+    m_RootTarget = std::make_unique<NcursesRenderTarget>(stdscr, false);
+}
+
+NcursesRenderBackend::~NcursesRenderBackend()
+{
+    m_RootTarget.reset();
+    endwin();
+    if (m_Screen)
+    {
+        delscreen(m_Screen);
+        std::fclose(m_NullDevice);
+    }
+}
+
+BackendType NcursesRenderBackend::GetType() const
+{
+    return m_Screen ? BackendType::Offscreen : BackendType::Ncurses;
+}
+
+std::unique_ptr<RenderTarget> NcursesRenderBackend::CreateTarget(int height, int width, int y, int x)
+{
+    return std::make_unique<NcursesRenderTarget>(newwin(height, width, y, x), true);
+}
+
+RenderTarget& NcursesRenderBackend::RootTarget()
+{
+    return *m_RootTarget;
+}
+
+void NcursesRenderBackend::Flush()
+{
+    doupdate();
+}
+
+int NcursesRenderBackend::ReadKey(RenderTarget& focus)
+{
+    return UI::ReadKey(static_cast<NcursesRenderTarget&>(focus).Window());
+}
+
+int NcursesRenderBackend::PollKey(int timeoutMs)
+{
+    int key = UI::PollKey(m_RootTarget->Window(), timeoutMs);
+    return key == ERR ? NoKey : key;
+}
+
+} /* namespace UI::Render */
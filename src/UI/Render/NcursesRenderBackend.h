@@ -0,0 +1,43 @@
+#pragma once
+
+#include "NcursesRenderTarget.h"
+#include "RenderBackend.h"
+
+namespace UI::Render
+{
+
+/**
+ * @brief Render backend drawing to the terminal via ncurses
+ * Initializes the terminal on construction and restores it on destruction. Offscreen, ncurses runs on a null
+ * terminal instead, so code drawing with ncurses directly works without a terminal and nothing is displayed.
+ */
+class NcursesRenderBackend : public RenderBackend
+{
+public:
+    /**
+     * @brief Constructor
+     *
+     * @param offscreen draw to a null terminal instead of the real one (default: false)
+     * @throw DisplayException if the null terminal cannot be set up
+     */
+    explicit NcursesRenderBackend(bool offscreen = false);
+
+    /**
+     * @brief Destructor
+     */
+    ~NcursesRenderBackend();
+
+    virtual BackendType GetType() const override;
+    virtual std::unique_ptr<RenderTarget> CreateTarget(int height, int width, int y, int x) override;
+    virtual RenderTarget& RootTarget() override;
+    virtual void Flush() override;
+    virtual int ReadKey(RenderTarget& focus) override;
+    virtual int PollKey(int timeoutMs) override;
+
+private:
+    std::unique_ptr<NcursesRenderTarget> m_RootTarget;
+    SCREEN* m_Screen;
+    FILE* m_NullDevice;
+};
+
+} /* namespace UI::Render */
@@ -0,0 +1,85 @@
+#include "NcursesRenderTarget.h"
+
+namespace UI::Render
+{
+
+NcursesRenderTarget::NcursesRenderTarget(WINDOW* window, bool isOwner) : m_Window(window), m_IsOwner(isOwner)
+{
+}
+
+NcursesRenderTarget::~NcursesRenderTarget()
+{
+    if (m_IsOwner)
+        delwin(m_Window);
+}
+
+int NcursesRenderTarget::Width() const
+{
+    return getmaxx(m_Window);
+}
+
+int NcursesRenderTarget::Height() const
+{
+    return getmaxy(m_Window);
+}
+
+chtype NcursesRenderTarget::CellAt(int y, int x) const
+{
+    if (y < 0 || y >= Height() || x < 0 || x >= Width())
+        return 0;
+
+    // Reading a cell moves the cursor, which would affect later writes to this window
+    int cursorY, cursorX;
+    getyx(m_Window, cursorY, cursorX);
+    chtype cell = mvwinch(m_Window, y, x);
+    wmove(m_Window, cursorY, cursorX);
+    return cell;
+}
+
+void NcursesRenderTarget::Erase()
+{
+    werase(m_Window);
+}
+
+void NcursesRenderTarget::Stage()
+{
+    wnoutrefresh(m_Window);
+}
+
+void NcursesRenderTarget::Present()
+{
+    wrefresh(m_Window);
+}
+
+void NcursesRenderTarget::Invalidate()
+{
+    touchwin(m_Window);
+}
+
+void NcursesRenderTarget::MoveTo(int y, int x)
+{
+    mvwin(m_Window, y, x);
+}
+
+void NcursesRenderTarget::Resize(int height, int width)
+{
+    wresize(m_Window, height, width);
+}
+
+std::unique_ptr<RenderTarget> NcursesRenderTarget::CreateSubTarget(int height, int width, int y, int x)
+{
+    return std::make_unique<NcursesRenderTarget>(derwin(m_Window, height, width, y, x), true);
+}
+
+WINDOW* NcursesRenderTarget::Window() const
+{
+    return m_Window;
+}
+
+void NcursesRenderTarget::SetCell(int y, int x, chtype ch)
+{
+    // Writing the bottom right cell reports an error as the cursor cannot advance, but the cell is still written
+    mvwaddch(m_Window, y, x, ch);
+}
+
+} /* namespace UI::Render */
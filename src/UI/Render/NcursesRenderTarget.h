@@ -0,0 +1,54 @@
+#pragma once
+
+#include "RenderTarget.h"
+#include <ncurses.h>
+
+namespace UI::Render
+{
+
+/**
+ * @brief Render target drawing into an ncurses window
+ */
+class NcursesRenderTarget : public RenderTarget
+{
+public:
+    /**
+     * @brief Constructor
+     * 
+     * @param window window
+     * @param isOwner whether the window should be deleted together with the target
+     */
+    NcursesRenderTarget(WINDOW* window, bool isOwner);
+
+    /**
+     * @brief Destructor
+     */
+    ~NcursesRenderTarget();
+
+    virtual int Width() const override;
+    virtual int Height() const override;
+    virtual chtype CellAt(int y, int x) const override;
+    virtual void Erase() override;
+    virtual void Stage() override;
+    virtual void Present() override;
+    virtual void Invalidate() override;
+    virtual void MoveTo(int y, int x) override;
+    virtual void Resize(int height, int width) override;
+    virtual std::unique_ptr<RenderTarget> CreateSubTarget(int height, int width, int y, int x) override;
+
+    /**
+     * @brief Get the underlying window
+     * 
+     * @return WINDOW* window
+     */
+    WINDOW* Window() const;
+
+protected:
+    virtual void SetCell(int y, int x, chtype ch) override;
+
+private:
+    WINDOW* m_Window;
+    bool m_IsOwner;
+};
+
+} /* namespace UI::Render */
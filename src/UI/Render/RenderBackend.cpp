@@ -0,0 +1,24 @@
+#include "RenderBackend.h"
+#include "HeadlessRenderBackend.h"
+#include "Misc/Exceptions.h"
+#include "NcursesRenderBackend.h"
+
+namespace UI::Render
+{
+
+std::unique_ptr<RenderBackend> CreateBackend(BackendType type, int height, int width)
+{
+    switch (type)
+    {
+    case BackendType::Ncurses:
+        return std::make_unique<NcursesRenderBackend>();
+    case BackendType::Offscreen:
+        return std::make_unique<NcursesRenderBackend>(true);
+    case BackendType::Headless:
+        return std::make_unique<HeadlessRenderBackend>(height, width);
+    default:
+        throw InvalidEnumValueException("Unknown render backend type");
+    }
+}
+
+} /* namespace UI::Render */
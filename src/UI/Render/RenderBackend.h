@@ -0,0 +1,92 @@
+#pragma once
+
+#include "RenderTarget.h"
+#include <memory>
+
+namespace UI::Render
+{
+
+/**
+ * @brief Available render backends
+ */
+enum class BackendType
+{
+    Ncurses,
+    Headless,
+    Offscreen // ncurses drawing to a null terminal, for running the full game without one
+};
+
+/**
+ * @brief Source of render targets and owner of the display they end up on
+ */
+class RenderBackend
+{
+public:
+    /**
+     * @brief Destructor
+     */
+    virtual ~RenderBackend() = default;
+
+    /**
+     * @brief Get the backend type
+     * 
+     * @return BackendType type
+     */
+    virtual BackendType GetType() const = 0;
+
+    /**
+     * @brief Create a new top-level target
+     * 
+     * @param height height
+     * @param width width
+     * @param y Y position on the screen
+     * @param x X position on the screen
+     * @return std::unique_ptr<RenderTarget> target
+     */
+    virtual std::unique_ptr<RenderTarget> CreateTarget(int height, int width, int y, int x) = 0;
+
+    /**
+     * @brief Get the target covering the whole screen underneath all other targets
+     * 
+     * @return RenderTarget& root target
+     */
+    virtual RenderTarget& RootTarget() = 0;
+
+    /**
+     * @brief Display everything staged since the last flush
+     */
+    virtual void Flush() = 0;
+
+    /**
+     * @brief Wait for a keypress while the given target is focused
+     * 
+     * @param focus focused target
+     * @return int key code
+     */
+    virtual int ReadKey(RenderTarget& focus) = 0;
+
+    /**
+     * @brief Wait a limited time for a keypress
+     * 
+     * @param timeoutMs maximum time to wait in milliseconds
+     * @return int key code or NoKey if nothing was pressed in time
+     */
+    virtual int PollKey(int timeoutMs) = 0;
+
+    /**
+     * @brief Key code returned by PollKey() if no key was pressed
+     */
+    constexpr static const int NoKey = -1;
+};
+
+/**
+ * @brief Create a render backend of the given type
+ * 
+ * @param type backend type
+ * @param height screen height
+ * @param width screen width
+ * @return std::unique_ptr<RenderBackend> backend
+ */
+std::unique_ptr<RenderBackend> CreateBackend(BackendType type, int height, int width);
+
+} /* namespace UI::Render */
@@ -0,0 +1,192 @@
+#include "RenderTarget.h"
+#include <algorithm>
+#include <cstdarg>
+#include <cstdio>
+
+namespace UI::Render
+{
+
+RenderTarget::RenderTarget() : m_Attrs(A_NORMAL), m_CursorY(0), m_CursorX(0)
+{
+}
+
+void RenderTarget::AttrOn(chtype attrs)
+{
+    // Like in ncurses, a new color replaces the old one instead of being OR'd into it
+    if (attrs & A_COLOR)
+        m_Attrs &= ~A_COLOR;
+    m_Attrs |= attrs;
+}
+
+void RenderTarget::AttrOff(chtype attrs)
+{
+    m_Attrs &= ~attrs;
+}
+
+void RenderTarget::AddChar(int y, int x, chtype ch)
+{
+    m_CursorY = y;
+    m_CursorX = x;
+    AddChar(ch);
+}
+
+void RenderTarget::AddChar(chtype ch)
+{
+    if (m_CursorY >= 0 && m_CursorY < Height() && m_CursorX >= 0 && m_CursorX < Width())
+    {
+        SetCell(m_CursorY, m_CursorX, Compose(ch));
+    }
+    m_CursorX++;
+}
+
+void RenderTarget::AddString(int y, int x, const std::string& str)
+{
+    m_CursorY = y;
+    m_CursorX = x;
+    AddString(str);
+}
+
+void RenderTarget::AddString(const std::string& str)
+{
+    for (char ch : str)
+    {
+        AddChar(static_cast<unsigned char>(ch));
+    }
+}
+
+void RenderTarget::Print(int y, int x, const char* format, ...)
+{
+    char buffer[256];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    AddString(y, x, buffer);
+}
+
+void RenderTarget::Print(const char* format, ...)
+{
+    char buffer[256];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    AddString(buffer);
+}
+
+void RenderTarget::PrintCenter(int y, const std::string& str)
+{
+    AddString(y, (Width() - static_cast<int>(str.size())) / 2, str);
+}
+
+void RenderTarget::HLine(int y, int x, chtype ch, int length)
+{
+    if (y < 0 || y >= Height())
+        return;
+    chtype cell = Compose(ch != 0 ? ch : ACS_HLINE);
+    for (int i = std::max(x, 0); i < x + length && i < Width(); i++)
+    {
+        SetCell(y, i, cell);
+    }
+}
+
+void RenderTarget::VLine(int y, int x, chtype ch, int length)
+{
+    if (x < 0 || x >= Width())
+        return;
+    chtype cell = Compose(ch != 0 ? ch : ACS_VLINE);
+    for (int i = std::max(y, 0); i < y + length && i < Height(); i++)
+    {
+        SetCell(i, x, cell);
+    }
+}
+
+void RenderTarget::Border(chtype left,
+                          chtype right,
+                          chtype top,
+                          chtype bottom,
+                          chtype topLeft,
+                          chtype topRight,
+                          chtype bottomLeft,
+                          chtype bottomRight)
+{
+    int height = Height();
+    int width  = Width();
+    HLine(0, 1, top != 0 ? top : ACS_HLINE, width - 2);
+    HLine(height - 1, 1, bottom != 0 ? bottom : ACS_HLINE, width - 2);
+    VLine(1, 0, left != 0 ? left : ACS_VLINE, height - 2);
+    VLine(1, width - 1, right != 0 ? right : ACS_VLINE, height - 2);
+    SetCell(0, 0, Compose(topLeft != 0 ? topLeft : ACS_ULCORNER));
+    SetCell(0, width - 1, Compose(topRight != 0 ? topRight : ACS_URCORNER));
+    SetCell(height - 1, 0, Compose(bottomLeft != 0 ? bottomLeft : ACS_LLCORNER));
+    SetCell(height - 1, width - 1, Compose(bottomRight != 0 ? bottomRight : ACS_LRCORNER));
+}
+
+void RenderTarget::Box()
+{
+    Border();
+}
+
+std::string RenderTarget::RowText(int y) const
+{
+    std::string text(Width(), ' ');
+    for (int x = 0; x < Width(); x++)
+    {
+        text[x] = CellToAscii(CellAt(y, x));
+    }
+    return text;
+}
+
+chtype RenderTarget::Compose(chtype ch) const
+{
+    chtype attrs = m_Attrs;
+    if (ch & A_COLOR)
+        attrs &= ~A_COLOR;
+    return ch | attrs;
+}
+
+char CellToAscii(chtype cell)
+{
+    char ch = static_cast<char>(cell & A_CHARTEXT);
+    if (!(cell & A_ALTCHARSET))
+    {
+        return ch != 0 ? ch : ' ';
+    }
+
+    // VT100 line-drawing set
+    switch (ch)
+    {
+    case 'q':
+        return '-';
+    case 'x':
+        return '|';
+    case 'l':
+    case 'k':
+    case 'm':
+    case 'j':
+    case 'n':
+    case 't':
+    case 'u':
+    case 'v':
+    case 'w':
+        return '+';
+    case '-':
+        return '^';
+    case '.':
+        return 'v';
+    case ',':
+        return '<';
+    case '+':
+        return '>';
+    case 'a':
+        return '#';
+    case '~':
+        return 'o';
+    case '`':
+        return '*';
+    default:
+        return ch;
+    }
+}
+
+} /* namespace UI::Render */
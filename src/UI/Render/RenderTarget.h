@@ -0,0 +1,253 @@
+#pragma once
+
+#include <memory>
+#include <ncurses.h>
+#include <string>
+
+namespace UI::Render
+{
+
+/**
+ * @brief Rectangular drawing surface
+ * Mirrors the subset of the ncurses window API used by the game, so drawing code
+ * does not depend on whether it ends up on a terminal or in memory. Cells are
+ * ncurses chtypes (character, attributes and color pair). Attributes set via
+ * AttrOn are merged into everything written through the Add* and Print* functions,
+ * with the color of the written character taking precedence like in ncurses.
+ */
+class RenderTarget
+{
+public:
+    /**
+     * @brief Constructor
+     */
+    RenderTarget();
+
+    /**
+     * @brief Destructor
+     */
+    virtual ~RenderTarget() = default;
+
+    RenderTarget(const RenderTarget&) = delete;
+    RenderTarget& operator=(const RenderTarget&) = delete;
+
+    /**
+     * @brief Get the width
+     * 
+     * @return int width
+     */
+    virtual int Width() const = 0;
+
+    /**
+     * @brief Get the height
+     * 
+     * @return int height
+     */
+    virtual int Height() const = 0;
+
+    /**
+     * @brief Get the cell at the given position
+     * 
+     * @param y Y position
+     * @param x X position
+     * @return chtype cell contents, 0 if out of bounds
+     */
+    virtual chtype CellAt(int y, int x) const = 0;
+
+    /**
+     * @brief Fill the target with blanks
+     */
+    virtual void Erase() = 0;
+
+    /**
+     * @brief Queue the target contents for display without updating the display yet
+     * Staged targets are displayed in the order they were staged on the next backend flush.
+     */
+    virtual void Stage() = 0;
+
+    /**
+     * @brief Display the target contents immediately
+     */
+    virtual void Present() = 0;
+
+    /**
+     * @brief Mark the whole target as changed so the next stage copies all of it
+     */
+    virtual void Invalidate() = 0;
+
+    /**
+     * @brief Move the target to the given screen position
+     * 
+     * @param y Y position
+     * @param x X position
+     */
+    virtual void MoveTo(int y, int x) = 0;
+
+    /**
+     * @brief Resize the target
+     * 
+     * @param height height
+     * @param width width
+     */
+    virtual void Resize(int height, int width) = 0;
+
+    /**
+     * @brief Create a target sharing a rectangle of this target's cells
+     * 
+     * @param height height
+     * @param width width
+     * @param y Y position relative to this target
+     * @param x X position relative to this target
+     * @return std::unique_ptr<RenderTarget> sub-target
+     */
+    virtual std::unique_ptr<RenderTarget> CreateSubTarget(int height, int width, int y, int x) = 0;
+
+    /**
+     * @brief Turn on the given attributes for subsequent writes
+     * 
+     * @param attrs attributes
+     */
+    void AttrOn(chtype attrs);
+
+    /**
+     * @brief Turn off the given attributes for subsequent writes
+     * 
+     * @param attrs attributes
+     */
+    void AttrOff(chtype attrs);
+
+    /**
+     * @brief Write a character at the given position and move the cursor after it
+     * 
+     * @param y Y position
+     * @param x X position
+     * @param ch character
+     */
+    void AddChar(int y, int x, chtype ch);
+
+    /**
+     * @brief Write a character at the cursor and advance it
+     * 
+     * @param ch character
+     */
+    void AddChar(chtype ch);
+
+    /**
+     * @brief Write a string at the given position and move the cursor after it
+     * The string is clipped at the right edge.
+     * 
+     * @param y Y position
+     * @param x X position
+     * @param str string
+     */
+    void AddString(int y, int x, const std::string& str);
+
+    /**
+     * @brief Write a string at the cursor and advance it
+     * 
+     * @param str string
+     */
+    void AddString(const std::string& str);
+
+    /**
+     * @brief Write a printf-formatted string at the given position
+     * 
+     * @param y Y position
+     * @param x X position
+     * @param format format string
+     */
+    void Print(int y, int x, const char* format, ...) __attribute__((format(printf, 4, 5)));
+
+    /**
+     * @brief Write a printf-formatted string at the cursor
+     * 
+     * @param format format string
+     */
+    void Print(const char* format, ...) __attribute__((format(printf, 2, 3)));
+
+    /**
+     * @brief Write a string centered horizontally on the given row
+     * 
+     * @param y Y position
+     * @param str string
+     */
+    void PrintCenter(int y, const std::string& str);
+
+    /**
+     * @brief Draw a horizontal line without moving the cursor
+     * 
+     * @param y Y position
+     * @param x X position
+     * @param ch line character, 0 for the default line
+     * @param length length
+     */
+    void HLine(int y, int x, chtype ch, int length);
+
+    /**
+     * @brief Draw a vertical line without moving the cursor
+     * 
+     * @param y Y position
+     * @param x X position
+     * @param ch line character, 0 for the default line
+     * @param length length
+     */
+    void VLine(int y, int x, chtype ch, int length);
+
+    /**
+     * @brief Draw a border, 0 for any argument selects the default character like in wborder
+     */
+    void Border(chtype left        = 0,
+                chtype right       = 0,
+                chtype top         = 0,
+                chtype bottom      = 0,
+                chtype topLeft     = 0,
+                chtype topRight    = 0,
+                chtype bottomLeft  = 0,
+                chtype bottomRight = 0);
+
+    /**
+     * @brief Draw the default border
+     */
+    void Box();
+
+    /**
+     * @brief Get the row text of the target without attributes, for inspection
+     * Line-drawing characters are converted to their closest ASCII equivalents.
+     * 
+     * @param y Y position
+     * @return std::string row text
+     */
+    std::string RowText(int y) const;
+
+protected:
+    /**
+     * @brief Write a fully composed cell without any checks or attribute merging
+     * 
+     * @param y Y position
+     * @param x X position
+     * @param ch cell
+     */
+    virtual void SetCell(int y, int x, chtype ch) = 0;
+
+private:
+    chtype m_Attrs;
+    int m_CursorY, m_CursorX;
+
+    /**
+     * @brief Merge the current attributes into a character
+     * 
+     * @param ch character
+     * @return chtype cell
+     */
+    chtype Compose(chtype ch) const;
+};
+
+/**
+ * @brief Convert a cell into the closest printable ASCII character
+ * 
+ * @param cell cell
+ * @return char character
+ */
+char CellToAscii(chtype cell);
+
+} /* namespace UI::Render */
@@ -1,4 +1,6 @@
 #include "Screen.h"
+#include "Animation/Animation.h"
+#include "Animation/Timeline.h"
 #include "BattleScreen.h"
 #include "CameraStyle.h"
 #include "ColorPairs.h"
@@ -6,16 +8,21 @@
 #include "Entities/EntityManager.h"
 #include "Entities/Player.h"
 #include "InputHandler.h"
+#include "InputLatency.h"
 #include "Misc/Coords.h"
 #include "Misc/Exceptions.h"
+#include "Misc/Profiler.h"
 #include "Misc/RNG.h"
 #include "Misc/Utils.h"
+#include "Render/RenderBackend.h"
+#include "Render/RenderTarget.h"
 #include "WorldMapObjectType.h"
 #include "Worlds/Field.h"
 #include "Worlds/Generation/RoomLayout.h"
 #include "Worlds/Room.h"
 #include "Worlds/World.h"
 #include "Worlds/WorldManager.h"
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 #include <map>
@@ -33,19 +40,27 @@ namespace UI
 Screen::Screen(InputHandler& inputHandler,
                const Worlds::WorldManager& worldManager,
                const Entities::EntityManager& entityManager,
-               const Entities::Player& player)
+               const Entities::Player& player,
+               Render::BackendType backendType)
     : m_InputHandler(inputHandler),
       m_WorldManager(worldManager),
       m_EntityManager(entityManager),
       m_Player(player),
       m_View(View::MainMenu),
+      m_RenderBackend(nullptr),
+      m_Timeline(nullptr),
       m_GameWorldWindow(nullptr),
       m_GameHUDWindow(nullptr),
       m_GameMessageWindow(nullptr),
+      m_LatencyOverlayWindow(nullptr),
       m_CurrentRoom(nullptr),
-      m_IsWorldMapCursorEnabled(true)
+      m_IsWorldMapCursorEnabled(true),
+      m_MapCells(),
+      m_MapConnectors(),
+      m_IsMapCacheDirty(true),
+      m_IsPresentationSpeedPinned(false)
 {
-    Init();
+    Init(backendType);
 }
 
 Screen::~Screen()
@@ -55,6 +70,12 @@ Screen::~Screen()
 
 void Screen::MainMenu()
 {
+    if (IsHeadless())
+    {
+        StartGame();
+        return;
+    }
+
     m_View                                          = View::MainMenu;
     static const std::vector<std::string> splashMsg = { "Speakest not of it.",
                                                         "And you thought you'd seen it all...",
@@ -95,19 +116,78 @@ void Screen::MainMenu()
 
 void Screen::Draw()
 {
+    if (IsHeadless())
+        return;
+
     DrawWorld();
     DrawHUD();
     DrawMessageWindow();
+    if (m_LatencyOverlayWindow)
+        DrawLatencyOverlay();
 }
 
 void Screen::Clear()
 {
-    werase(m_GameWorldWindow);
-    wrefresh(m_GameWorldWindow);
-    werase(m_GameHUDWindow);
-    wrefresh(m_GameHUDWindow);
-    wclear(m_GameMessageWindow);
-    wrefresh(m_GameMessageWindow);
+    m_GameWorldWindow->Erase();
+    m_GameWorldWindow->Present();
+    m_GameHUDWindow->Erase();
+    m_GameHUDWindow->Present();
+    m_GameMessageWindow->Erase();
+    m_GameMessageWindow->Present();
+}
+
+Render::RenderBackend& Screen::GetRenderBackend()
+{
+    return *m_RenderBackend;
+}
+
+bool Screen::IsHeadless() const
+{
+    return m_RenderBackend->GetType() == Render::BackendType::Headless;
+}
+
+void Screen::PlayAnimation(Animation::Animation& animation)
+{
+    if (IsHeadless())
+        return;
+
+    m_Timeline->Play(animation);
+}
+
+Animation::PresentationSpeed Screen::GetPresentationSpeed() const
+{
+    return m_Timeline->GetSpeed();
+}
+
+void Screen::SetPresentationSpeed(Animation::PresentationSpeed speed)
+{
+    if (!m_IsPresentationSpeedPinned)
+        m_Timeline->SetSpeed(speed);
+}
+
+void Screen::PinPresentationSpeed(Animation::PresentationSpeed speed)
+{
+    m_Timeline->SetSpeed(speed);
+    m_IsPresentationSpeedPinned = true;
+}
+
+void Screen::SetLatencyOverlay(bool isShown)
+{
+    if (isShown && !m_LatencyOverlayWindow)
+    {
+        m_LatencyOverlayWindow = m_RenderBackend->CreateTarget(InputLatency::CategoryCount + 3, 44, 0, 0);
+    }
+    else if (!isShown && m_LatencyOverlayWindow)
+    {
+        m_LatencyOverlayWindow->Erase();
+        m_LatencyOverlayWindow->Present();
+        m_LatencyOverlayWindow.reset();
+    }
+}
+
+bool Screen::IsLatencyOverlayShown() const
+{
+    return m_LatencyOverlayWindow != nullptr;
 }
 
 Screen::View Screen::GetView() const
@@ -122,38 +202,53 @@ void Screen::PostMessage(const std::string& message)
 
 void Screen::ShowMap()
 {
+    if (IsHeadless())
+        return;
+    InputLatency::Classify(InputLatency::Category::MapOpen);
+
     View previousView = m_View;
     m_View            = View::Map;
 
     // Prepare window
     // Every room icon is 1 char wide and has 1 char of spacing on both sides horizontally
     // for drawing "hallways" between rooms. This also helps keep better proportions.
-    WINDOW* mapWindow = newwin(WorldMapHeight, WorldMapWidth, WorldMapYPos, WorldMapXPos);
+    auto windowWidget = m_WindowCache.Acquire();
+    WINDOW* mapWindow = windowWidget->Open(WorldMapHeight, WorldMapWidth, WorldMapYPos, WorldMapXPos);
 
     // Handle map interaction
-    Coords cursor = m_CurrentRoom->GetCoords();
+    Coords cursor         = m_CurrentRoom->GetCoords();
+    Coords previousCursor = cursor;
     std::optional<chtype> key;
     bool done        = false;
-    bool actionTaken = true;
+    bool actionTaken = false;
     keypad(mapWindow, 1);
 
+    // Nothing underneath the map changes while it is open, so everything is drawn only once
+    DrawWorld();
+    DrawHUD();
+    DrawMessageWindow(false); // don't post the message
+    DrawMap(mapWindow, cursor);
+    if (m_IsWorldMapCursorEnabled)
+    {
+        DrawMapTooltip(cursor, m_MapCells[cursor.X][cursor.Y].Type);
+    }
+
     do
     {
-        // Need to redraw the screen to get rid of leftover tooltips
+        // Only the cells under the old and new cursor positions need repainting,
+        // and leftover tooltips are removed by restoring the windows underneath
         if (actionTaken)
         {
-            DrawWorld();
-            DrawHUD();
-            DrawMessageWindow(false); // don't post the message
-
-            DrawMap(mapWindow, cursor);
+            PaintMapCell(mapWindow, previousCursor, cursor);
+            PaintMapCell(mapWindow, cursor, cursor);
+            RestoreMapUnderlay(mapWindow);
             if (m_IsWorldMapCursorEnabled)
             {
-                WorldMapObjectType selectedObjectType = MapObjectType(cursor);
-                DrawMapTooltip(cursor, selectedObjectType);
+                DrawMapTooltip(cursor, m_MapCells[cursor.X][cursor.Y].Type);
             }
 
-            actionTaken = false;
+            previousCursor = cursor;
+            actionTaken    = false;
         }
 
         key = InputHandler::ReadKeypress(
@@ -213,7 +308,6 @@ void Screen::ShowMap()
     wclear(mapWindow);
     wrefresh(mapWindow);
 
-    delwin(mapWindow);
     m_View = previousView;
 }
 
@@ -222,6 +316,9 @@ bool Screen::YesNoMessageBox(const std::string& prompt,
                              const std::string& rightOption,
                              const std::string& title)
 {
+    if (IsHeadless())
+        return true;
+
     // Split the prompt into lines
     std::vector<std::string> lines;
     size_t neededWidth = 0;
@@ -248,18 +345,22 @@ bool Screen::YesNoMessageBox(const std::string& prompt,
     int height = lines.size() + 4;
     int width  = neededWidth + 4;
 
-    std::vector<ITEM*> items
-        = { new_item(left.c_str(), left.c_str()), new_item(right.c_str(), right.c_str()), nullptr };
-
     int subXPos = (width - (left.size() + right.size() + 4)) / 2;
 
-    WINDOW* boxWin = newwin(height, width, (ScreenHeight - height) / 2, (ScreenWidth - width) / 2);
-    WINDOW* boxSub = derwin(boxWin, 1, width - subXPos - 3, height - 2, subXPos);
-    MENU* menu     = new_menu(items.data());
+    auto menuWidget = m_MenuCache.Acquire();
+    menuWidget->ClearItems();
+    menuWidget->AddItem(left);
+    menuWidget->AddItem(right);
+    MENU* menu = menuWidget->Open(height,
+                                  width,
+                                  (ScreenHeight - height) / 2,
+                                  (ScreenWidth - width) / 2,
+                                  1,
+                                  width - subXPos - 3,
+                                  height - 2,
+                                  subXPos);
+    WINDOW* boxWin = menuWidget->Window();
 
-    set_menu_win(menu, boxWin);
-    set_menu_sub(menu, boxSub);
-    keypad(boxWin, 1);
     menu_opts_off(menu, O_SHOWDESC);
     set_menu_mark(menu, "");
     set_menu_format(menu, 1, 2);
@@ -313,22 +414,16 @@ bool Screen::YesNoMessageBox(const std::string& prompt,
         wrefresh(boxWin);
     }
 
-    unpost_menu(menu);
-    free_menu(menu);
-    wclear(boxWin);
-    wrefresh(boxWin);
-    delwin(boxSub);
-    delwin(boxWin);
-    for (auto& item : items)
-    {
-        free_item(item);
-    }
+    menuWidget->Close();
 
     return selectedLeft;
 }
 
 void Screen::OkMessageBox(const std::string& message, const std::string& title, const std::string& buttonLabel)
 {
+    if (IsHeadless())
+        return;
+
     // Split the message into lines
     std::vector<std::string> lines;
     size_t neededWidth = 0;
@@ -345,7 +440,8 @@ void Screen::OkMessageBox(const std::string& message, const std::string& title,
     int width          = neededWidth + 4;
     std::string button = "  " + buttonLabel + "  ";
 
-    WINDOW* boxWin = newwin(height, width, (ScreenHeight - height) / 2, (ScreenWidth - width) / 2);
+    auto windowWidget = m_WindowCache.Acquire();
+    WINDOW* boxWin    = windowWidget->Open(height, width, (ScreenHeight - height) / 2, (ScreenWidth - width) / 2);
 
     // Draw the window and contents
     box(boxWin, 0, 0);
@@ -365,27 +461,29 @@ void Screen::OkMessageBox(const std::string& message, const std::string& title,
 
     wrefresh(boxWin);
 
-    keypad(boxWin, 1);
-
     std::optional<chtype> key;
     while (!key.has_value() || !(key.value() == KEY_ENTER || key.value() == 10 || key.value() == 27))
     {
         key = InputHandler::ReadKeypress({ KEY_ENTER, 10, 27 }, boxWin);
     }
 
-    wclear(boxWin);
-    wrefresh(boxWin);
-
-    delwin(boxWin);
+    windowWidget->Close();
 }
 
-BattleScreen& Screen::OpenBattleScreen(Battle::Battle& battle)
+void Screen::OpenBattleScreen(Battle::Battle& battle)
 {
+    if (IsHeadless())
+    {
+        battle.SetPlayerDecision(&m_HeadlessDecision);
+        return;
+    }
+
+    InputLatency::Classify(InputLatency::Category::BattleStart);
     BattleScreen* battleScreen = new BattleScreen(battle, *this, m_InputHandler);
     m_Subscreen.reset(battleScreen);
-    battle.SetBattleScreen(battleScreen);
+    battle.SetObserver(battleScreen);
+    battle.SetPlayerDecision(battleScreen);
     // m_View = View::Battle;
-    return *battleScreen;
 }
 
 void Screen::CloseSubscreen()
@@ -409,6 +507,9 @@ void Screen::GameOver(const std::string& epitaph)
 
 void Screen::DisplayLevelUp(const Entities::Stats& prev, const Entities::Stats& next)
 {
+    if (IsHeadless())
+        return;
+
     // Assemble diff
     struct DiffEntry
     {
@@ -445,7 +546,8 @@ void Screen::DisplayLevelUp(const Entities::Stats& prev, const Entities::Stats&
     constexpr int width = 44;
     const int height    = 7 + diff.size();
 
-    WINDOW* window = newwin(height, width, (ScreenHeight - height) / 2, (ScreenWidth - width) / 2);
+    auto windowWidget = m_WindowCache.Acquire();
+    WINDOW* window    = windowWidget->Open(height, width, (ScreenHeight - height) / 2, (ScreenWidth - width) / 2);
     box(window, 0, 0);
     wattron(window, A_REVERSE);
     PrintCenter(window, " Level Up ", 0);
@@ -482,31 +584,35 @@ void Screen::DisplayLevelUp(const Entities::Stats& prev, const Entities::Stats&
     PrintCenter(window, "            ", height - 2);
 
     // Animation
+    Animation::Sequence animation;
     for (int offset = 0; offset < 6; offset++)
     {
-        diffLine = 0;
-        for (const auto& diffEntry : diff)
-        {
-            mvwhline(window, 4 + diffLine, 22 + offset, ' ', 4);
-            wattron(window, A_BOLD | COLOR_PAIR(diffEntry.color));
-            
-            if (offset < 5)
+        animation.Do([&, offset] {
+            int diffLine = 0;
+            for (const auto& diffEntry : diff)
             {
-                mvwprintw(window, 4 + diffLine, 23 + offset, "%4d", diffEntry.prev);
-            }
-            else
-            {
-                mvwprintw(window, 4 + diffLine, 23 + offset + 2, "%d", diffEntry.next);
-            }
+                mvwhline(window, 4 + diffLine, 22 + offset, ' ', 4);
+                wattron(window, A_BOLD | COLOR_PAIR(diffEntry.color));
 
-            wrefresh(window);
-            
-            wattroff(window, A_BOLD | A_COLOR);
-            diffLine++;
-        }
+                if (offset < 5)
+                {
+                    mvwprintw(window, 4 + diffLine, 23 + offset, "%4d", diffEntry.prev);
+                }
+                else
+                {
+                    mvwprintw(window, 4 + diffLine, 23 + offset + 2, "%d", diffEntry.next);
+                }
+
+                wrefresh(window);
+
+                wattroff(window, A_BOLD | A_COLOR);
+                diffLine++;
+            }
+        });
         if (offset < 5)
-            Sleep(100);
+            animation.Wait(100);
     }
+    PlayAnimation(animation);
 
     // Second screen
     diffLine = 0;
@@ -531,34 +637,24 @@ void Screen::DisplayLevelUp(const Entities::Stats& prev, const Entities::Stats&
         key = InputHandler::ReadKeypress({ KEY_ENTER, 10, 27 }, window);
     }
 
-    werase(window);
-    wrefresh(window);
-    delwin(window);
+    windowWidget->Close();
 }
 
-void Screen::Init()
+void Screen::Init(Render::BackendType backendType)
 {
-    initscr();
-    start_color();
-    use_default_colors();
-    raw();
-    keypad(stdscr, true);
-    noecho();
-    curs_set(0);
-    ESCDELAY = 0;
-
-    ColorPairs::InitPairs();
+    m_RenderBackend = Render::CreateBackend(backendType, ScreenHeight, ScreenWidth);
+    m_Timeline      = std::make_unique<Animation::Timeline>(*m_RenderBackend);
 }
 
 void Screen::Terminate()
 {
-    if (m_GameWorldWindow != nullptr)
-        delwin(m_GameWorldWindow);
-    if (m_GameHUDWindow != nullptr)
-        delwin(m_GameHUDWindow);
-    if (m_GameMessageWindow != nullptr)
-        delwin(m_GameMessageWindow);
-    endwin();
+    m_GameWorldWindow.reset();
+    m_GameHUDWindow.reset();
+    m_GameMessageWindow.reset();
+    m_MenuCache.Clear();
+    m_WindowCache.Clear();
+    m_Timeline.reset();
+    m_RenderBackend.reset();
 }
 
 void Screen::PrintCenter(const std::string& str, int yPos)
@@ -598,7 +694,7 @@ void Screen::DrawLogo(int xPos, int yPos)
     attroff(A_BOLD);
 }
 
-int Screen::SelectViaMenu(std::map<int, std::string> options,
+int Screen::SelectViaMenu(const std::map<int, std::string>& options,
                           int xPos,
                           int yPos,
                           int width,
@@ -609,7 +705,8 @@ int Screen::SelectViaMenu(std::map<int, std::string> options,
                           const std::string& title,
                           bool spaceOptions,
                           bool scroll,
-                          std::function<void(std::map<int, std::string>::iterator)> hoverAction)
+                          std::function<void(std::map<int, std::string>::const_iterator)> hoverAction,
+                          std::function<void(int)> pageAction)
 {
     if (options.empty())
     {
@@ -626,24 +723,23 @@ int Screen::SelectViaMenu(std::map<int, std::string> options,
     const size_t numColumns  = scroll ? 1 : ceil(static_cast<double>(options.size()) / numRows);
     const size_t columnWidth = subWidth / numColumns;
 
-    std::vector<ITEM*> items;
-    for (auto& pair : options)
+    auto menuWidget = m_MenuCache.Acquire();
+    menuWidget->ClearItems();
+    for (const auto& pair : options)
     {
+        // Labels are centered in their columns
+        std::string& label = m_MenuLabelBuffer;
         if (pair.second.size() > columnWidth)
-        {
-            ShortenString(pair.second, columnWidth);
-        }
-        size_t totalPad = columnWidth - pair.second.size();
-        pair.second     = std::string(totalPad / 2, ' ') + pair.second + std::string(totalPad / 2 + totalPad % 2, ' ');
-        items.push_back(new_item(pair.second.c_str(), pair.second.c_str()));
+            label = ShortenString(pair.second, columnWidth);
+        else
+            label = pair.second;
+        size_t totalPad = columnWidth - label.size();
+        label.insert(0, totalPad / 2, ' ');
+        label.append(totalPad / 2 + totalPad % 2, ' ');
+        menuWidget->AddItem(label);
     }
-    items.push_back(nullptr);
-    MENU* menu         = new_menu(items.data());
-    WINDOW* menuWindow = newwin(height, width, yPos, xPos);
-    WINDOW* menuSub    = derwin(menuWindow, subHeight, subWidth, 1 + padY, 1 + padX);
-    set_menu_win(menu, menuWindow);
-    set_menu_sub(menu, menuSub);
-    keypad(menuWindow, 1);
+    MENU* menu         = menuWidget->Open(height, width, yPos, xPos, subHeight, subWidth, 1 + padY, 1 + padX);
+    WINDOW* menuWindow = menuWidget->Window();
 
     menu_opts_off(menu, O_SHOWDESC);
     set_menu_mark(menu, "");
@@ -664,8 +760,9 @@ int Screen::SelectViaMenu(std::map<int, std::string> options,
         hoverAction(it);
     while (!selected)
     {
-        key = InputHandler::ReadKeypress({ KEY_DOWN, 's', KEY_UP, 'w', KEY_RIGHT, 'd', KEY_LEFT, 'a', KEY_ENTER, 10 },
-                                         menuWindow);
+        key = InputHandler::ReadKeypress(
+            { KEY_DOWN, 's', KEY_UP, 'w', KEY_RIGHT, 'd', KEY_LEFT, 'a', KEY_ENTER, 10, KEY_PPAGE, KEY_NPAGE },
+            menuWindow);
         if (!key)
             continue;
 
@@ -720,18 +817,19 @@ int Screen::SelectViaMenu(std::map<int, std::string> options,
         case 10:
             selected = true;
             break;
+        case KEY_PPAGE:
+            if (pageAction)
+                pageAction(-1);
+            break;
+        case KEY_NPAGE:
+            if (pageAction)
+                pageAction(1);
+            break;
         }
         wrefresh(menuWindow);
     }
 
-    unpost_menu(menu);
-    werase(menuWindow);
-    wrefresh(menuWindow);
-    delwin(menuSub);
-    delwin(menuWindow);
-    free_menu(menu);
-    for (auto& item : items)
-        free_item(item);
+    menuWidget->Close();
 
     return it->first;
 }
@@ -739,17 +837,18 @@ int Screen::SelectViaMenu(std::map<int, std::string> options,
 void Screen::StartGame()
 {
     m_View            = View::InGame;
-    m_GameWorldWindow = newwin(1, 1, 0, 0);
+    m_GameWorldWindow = m_RenderBackend->CreateTarget(1, 1, 0, 0);
     ResizeWorldWindow();
-    m_GameHUDWindow     = newwin(ScreenHeight, HUDPanelWidth, 0, WorldPanelWidth);
-    m_GameMessageWindow = newwin(ScreenHeight - WorldPanelHeight, WorldPanelWidth + 1, WorldPanelHeight, 0);
+    m_GameHUDWindow     = m_RenderBackend->CreateTarget(ScreenHeight, HUDPanelWidth, 0, WorldPanelWidth);
+    m_GameMessageWindow = m_RenderBackend->CreateTarget(
+        ScreenHeight - WorldPanelHeight, WorldPanelWidth + 1, WorldPanelHeight, 0);
     m_Message           = "Welcome to the Dun-geon.";
 }
 
 void Screen::ResizeWorldWindow()
 {
-    werase(m_GameWorldWindow);
-    wrefresh(m_GameWorldWindow);
+    m_GameWorldWindow->Erase();
+    m_GameWorldWindow->Present();
     const Worlds::Room& currentRoom = m_WorldManager.CurrentRoom();
 
     Coords::Scalar windowLines   = currentRoom.GetHeight() + 2;
@@ -763,16 +862,18 @@ void Screen::ResizeWorldWindow()
 
     int windowXPos = (WorldPanelWidth - windowColumns) / 2 - 1;
     int windowYPos = (WorldPanelHeight - windowLines) / 2;
-    wresize(m_GameWorldWindow, windowLines, windowColumns);
-    mvwin(m_GameWorldWindow, windowYPos, windowXPos);
+    m_GameWorldWindow->Resize(windowLines, windowColumns);
+    m_GameWorldWindow->MoveTo(windowYPos, windowXPos);
 }
 
 void Screen::DrawWorld()
 {
-    werase(m_GameWorldWindow);
+    PROFILE_SCOPE("Screen::DrawWorld");
+    m_GameWorldWindow->Erase();
     if (m_CurrentRoom != &m_WorldManager.CurrentRoom())
     {
         m_CurrentRoom = &m_WorldManager.CurrentRoom();
+        InputLatency::Classify(InputLatency::Category::RoomTransition);
         ResizeWorldWindow();
 
         // Zero out room discovery if no record exists yet
@@ -783,9 +884,10 @@ void Screen::DrawWorld()
                 m_RoomDiscovery[m_CurrentRoom][poiCoords] = false;
             }
         }
+        m_IsMapCacheDirty = true;
     }
-    int worldY, worldX;
-    getmaxyx(m_GameWorldWindow, worldY, worldX);
+    int worldY = m_GameWorldWindow->Height();
+    int worldX = m_GameWorldWindow->Width();
     // How far can we draw vertically or horizontally
     Coords::Scalar rangeX = worldX / 2 - (worldX % 2 ? 0 : 1) - 1;
     Coords::Scalar rangeY = worldY / 2 - (worldY % 2 ? 0 : 1) - 1;
@@ -811,7 +913,7 @@ void Screen::DrawWorld()
             if (desiredFieldXPos < 0 || desiredFieldXPos >= m_CurrentRoom->GetWidth() || desiredFieldYPos < 0
                 || desiredFieldYPos >= m_CurrentRoom->GetHeight())
             {
-                mvwaddch(m_GameWorldWindow, j, i, DefaultFieldIcon);
+                m_GameWorldWindow->AddChar(j, i, DefaultFieldIcon);
             }
             else
             {
@@ -820,100 +922,104 @@ void Screen::DrawWorld()
                 auto distance = playerCoords.Distance(targetCoords);
                 if (radius > 0 && distance > (playerCoords.SharesAxis(targetCoords) ? radius - 1 : radius))
                 {
-                    mvwaddch(m_GameWorldWindow, j, i, DefaultFieldIcon);
+                    m_GameWorldWindow->AddChar(j, i, DefaultFieldIcon);
                 }
                 else
                 {
                     // Field is visible
                     // Check if we should add a discovery entry
-                    if (m_RoomDiscovery.at(m_CurrentRoom).count(targetCoords) > 0
+                    auto discoveryEntry = m_RoomDiscovery.at(m_CurrentRoom).find(targetCoords);
+                    if (discoveryEntry != m_RoomDiscovery.at(m_CurrentRoom).end() && !discoveryEntry->second
                         && (radius == 0 || distance < (playerCoords.SharesAxis(targetCoords) ? radius - 1 : radius)))
                     {
-                        m_RoomDiscovery.at(m_CurrentRoom).at(targetCoords) = true;
+                        discoveryEntry->second = true;
+                        m_IsMapCacheDirty      = true;
                     }
                     
-                    mvwaddch(m_GameWorldWindow, j, i, FieldIcon(targetCoords));
+                    m_GameWorldWindow->AddChar(j, i, FieldIcon(targetCoords));
                 }
             }
         }
     }
     if (m_CurrentRoom->GetCameraStyle() != CameraStyle::Fixed)
     {
-        box(m_GameWorldWindow, 0, 0);
+        m_GameWorldWindow->Box();
     }
-    wrefresh(m_GameWorldWindow);
+    m_GameWorldWindow->Present();
 }
 
 void Screen::DrawHUD()
 {
-    werase(m_GameHUDWindow);
+    PROFILE_SCOPE("Screen::DrawHUD");
+    m_GameHUDWindow->Erase();
     const auto& stats = m_Player.GetStats();
-    mvwprintw(m_GameHUDWindow, 2, 4, "World %d", m_WorldManager.CurrentWorld().GetWorldNumber());
-    mvwprintw(m_GameHUDWindow, 2, HUDPanelWidth - 10, "Room %d", m_WorldManager.CurrentRoom().GetRoomNumber());
+    m_GameHUDWindow->Print(2, 4, "World %d", m_WorldManager.CurrentWorld().GetWorldNumber());
+    m_GameHUDWindow->Print(2, HUDPanelWidth - 10, "Room %d", m_WorldManager.CurrentRoom().GetRoomNumber());
 
-    PrintCenter(m_GameHUDWindow, m_Player.GetName(), 4);
+    m_GameHUDWindow->PrintCenter(4, m_Player.GetName());
 
-    mvwprintw(m_GameHUDWindow, 6, 4, "Level %d", stats.Level);
+    m_GameHUDWindow->Print(6, 4, "Level %d", stats.Level);
     Components::FillBar xpBar {
-        m_GameHUDWindow, 14, 13, 6, m_Player.GetXP(), m_Player.GetXPToLevelUp(), ColorPairs::WhiteOnYellow
+        *m_GameHUDWindow, 14, 13, 6, m_Player.GetXP(), m_Player.GetXPToLevelUp(), ColorPairs::WhiteOnYellow
     };
     if (stats.Level != Entities::LevelCap)
     {
         xpBar.Draw();
     }
 
-    mvwprintw(m_GameHUDWindow, 8, 4, "HP:  %d/%d", stats.Health, stats.MaxHealth);
-    mvwprintw(m_GameHUDWindow, 8, HUDPanelWidth - 11, "(%3d%%)", PLAYER_HEALTH_PC);
+    m_GameHUDWindow->Print(8, 4, "HP:  %d/%d", stats.Health, stats.MaxHealth);
+    m_GameHUDWindow->Print(8, HUDPanelWidth - 11, "(%3ld%%)", PLAYER_HEALTH_PC);
 
-    mvwprintw(m_GameHUDWindow, 9, 4, "MP:  %d/%d", stats.Mana, stats.MaxMana);
-    mvwprintw(m_GameHUDWindow, 9, HUDPanelWidth - 11, "(%3d%%)", PLAYER_MANA_PC);
+    m_GameHUDWindow->Print(9, 4, "MP:  %d/%d", stats.Mana, stats.MaxMana);
+    m_GameHUDWindow->Print(9, HUDPanelWidth - 11, "(%3ld%%)", PLAYER_MANA_PC);
 
-    wattron(m_GameHUDWindow, A_BOLD | COLOR_PAIR(ColorPairs::RedOnDefault));
-    mvwprintw(m_GameHUDWindow, 11, 4, "Str: %3d", stats.Strength);
-    wattron(m_GameHUDWindow, A_BOLD | COLOR_PAIR(ColorPairs::MagentaOnDefault));
-    mvwprintw(m_GameHUDWindow, 11, HUDPanelWidth - 11, "Sor: %3d", stats.Sorcery);
+    m_GameHUDWindow->AttrOn(A_BOLD | COLOR_PAIR(ColorPairs::RedOnDefault));
+    m_GameHUDWindow->Print(11, 4, "Str: %3d", stats.Strength);
+    m_GameHUDWindow->AttrOn(A_BOLD | COLOR_PAIR(ColorPairs::MagentaOnDefault));
+    m_GameHUDWindow->Print(11, HUDPanelWidth - 11, "Sor: %3d", stats.Sorcery);
 
-    wattron(m_GameHUDWindow, A_BOLD | COLOR_PAIR(ColorPairs::GreenOnDefault));
-    mvwprintw(m_GameHUDWindow, 12, 4, "Dex: %3d", stats.Dexterity);
-    wattron(m_GameHUDWindow, A_BOLD | COLOR_PAIR(ColorPairs::BlueOnDefault));
-    mvwprintw(m_GameHUDWindow, 12, HUDPanelWidth - 11, "Wis: %3d", stats.Wisdom);
-    wattroff(m_GameHUDWindow, A_COLOR | A_BOLD);
+    m_GameHUDWindow->AttrOn(A_BOLD | COLOR_PAIR(ColorPairs::GreenOnDefault));
+    m_GameHUDWindow->Print(12, 4, "Dex: %3d", stats.Dexterity);
+    m_GameHUDWindow->AttrOn(A_BOLD | COLOR_PAIR(ColorPairs::BlueOnDefault));
+    m_GameHUDWindow->Print(12, HUDPanelWidth - 11, "Wis: %3d", stats.Wisdom);
+    m_GameHUDWindow->AttrOff(A_COLOR | A_BOLD);
 
     std::string wealthAmountStr = std::to_string(m_Player.GetDun());
     int xPos                    = (HUDPanelWidth - wealthAmountStr.size() - 12) / 2;
     xPos += xPos % 2;
-    mvwaddstr(m_GameHUDWindow, 14, xPos, "Wealth: ");
-    wattron(m_GameHUDWindow, COLOR_PAIR(ColorPairs::YellowOnDefault) | A_BOLD);
-    wprintw(m_GameHUDWindow, "%d", m_Player.GetDun());
-    wattroff(m_GameHUDWindow, A_COLOR | A_BOLD);
-    waddstr(m_GameHUDWindow, " dun");
+    m_GameHUDWindow->AddString(14, xPos, "Wealth: ");
+    m_GameHUDWindow->AttrOn(COLOR_PAIR(ColorPairs::YellowOnDefault) | A_BOLD);
+    m_GameHUDWindow->Print("%d", m_Player.GetDun());
+    m_GameHUDWindow->AttrOff(A_COLOR | A_BOLD);
+    m_GameHUDWindow->AddString(" dun");
 
-    mvwaddstr(m_GameHUDWindow, 16, 5, "[i]tems");
-    mvwaddstr(m_GameHUDWindow, 16, HUDPanelWidth - 12, "[s]kills");
+    m_GameHUDWindow->AddString(16, 5, "[i]tems");
+    m_GameHUDWindow->AddString(16, HUDPanelWidth - 12, "[s]kills");
 
-    mvwaddstr(m_GameHUDWindow, 17, 5, "[m]ap");
-    mvwaddstr(m_GameHUDWindow, 17, HUDPanelWidth - 12, "[h]elp");
+    m_GameHUDWindow->AddString(17, 5, "[m]ap");
+    m_GameHUDWindow->AddString(17, HUDPanelWidth - 12, "[h]elp");
 
-    PrintCenter(m_GameHUDWindow, "[q]uit", 18);
+    m_GameHUDWindow->PrintCenter(18, "[q]uit");
 
     auto approachedEntity = m_EntityManager.Approaching(m_Player, m_Player.FacingDirection);
 
     if (approachedEntity != nullptr)
     {
-        PrintCenter(m_GameHUDWindow, approachedEntity->GetName(), WorldPanelHeight + 1);
-        PrintCenter(m_GameHUDWindow, approachedEntity->GetDescription(), WorldPanelHeight + 2);
+        m_GameHUDWindow->PrintCenter(WorldPanelHeight + 1, approachedEntity->GetName());
+        m_GameHUDWindow->PrintCenter(WorldPanelHeight + 2, approachedEntity->GetDescription());
     }
 
-    box(m_GameHUDWindow, 0, 0);
-    mvwhline(m_GameHUDWindow, WorldPanelHeight, 1, 0, HUDPanelWidth - 2);
-    mvwaddch(m_GameHUDWindow, WorldPanelHeight, HUDPanelWidth - 1, ACS_RTEE);
-    wrefresh(m_GameHUDWindow);
+    m_GameHUDWindow->Box();
+    m_GameHUDWindow->HLine(WorldPanelHeight, 1, 0, HUDPanelWidth - 2);
+    m_GameHUDWindow->AddChar(WorldPanelHeight, HUDPanelWidth - 1, ACS_RTEE);
+    m_GameHUDWindow->Present();
 }
 
 void Screen::DrawMessageWindow(bool shouldPostMessage)
 {
-    werase(m_GameMessageWindow);
-    wborder(m_GameMessageWindow, 0, 0, 0, 0, 0, ACS_PLUS, 0, ACS_BTEE);
+    PROFILE_SCOPE("Screen::DrawMessageWindow");
+    m_GameMessageWindow->Erase();
+    m_GameMessageWindow->Border(0, 0, 0, 0, 0, ACS_PLUS, 0, ACS_BTEE);
     if (shouldPostMessage)
     {
         if (m_Message.size() > WorldPanelWidth - 4)
@@ -923,20 +1029,57 @@ void Screen::DrawMessageWindow(bool shouldPostMessage)
                 pos--;
             std::string secondLine = m_Message.substr(pos > 0 ? pos + 1 : WorldPanelWidth - 4);
             m_Message              = m_Message.substr(0, pos > 0 ? pos : WorldPanelWidth - 4);
-            mvwaddstr(m_GameMessageWindow, 1, 2, m_Message.c_str());
-            mvwaddstr(m_GameMessageWindow, 2, 2, secondLine.c_str());
+            m_GameMessageWindow->AddString(1, 2, m_Message);
+            m_GameMessageWindow->AddString(2, 2, secondLine);
         }
         else
         {
-            mvwaddstr(m_GameMessageWindow, 1, 2, m_Message.c_str());
+            m_GameMessageWindow->AddString(1, 2, m_Message);
         }
         m_Message.clear();
     }
-    wrefresh(m_GameMessageWindow);
+    m_GameMessageWindow->Present();
+}
+
+void Screen::DrawLatencyOverlay()
+{
+    auto toMilliseconds = [](uint64_t ns) { return ns / 1e6; };
+
+    m_LatencyOverlayWindow->Erase();
+    m_LatencyOverlayWindow->Box();
+    m_LatencyOverlayWindow->AddString(0, 2, " Latency (ms) ");
+    if (!InputLatency::IsEnabled())
+    {
+        m_LatencyOverlayWindow->AddString(1, 2, "Start the game with --latency to measure");
+        m_LatencyOverlayWindow->Present();
+        return;
+    }
+    m_LatencyOverlayWindow->AttrOn(A_BOLD);
+    m_LatencyOverlayWindow->Print(1, 2, "%-15s %5s %6s %6s %6s", "command", "count", "p50", "p99", "max");
+    m_LatencyOverlayWindow->AttrOff(A_BOLD);
+    for (int i = 0; i < InputLatency::CategoryCount; i++)
+    {
+        auto category         = static_cast<InputLatency::Category>(i);
+        const auto& latencies = InputLatency::GetLatencies(category);
+        m_LatencyOverlayWindow->Print(2 + i,
+                                      2,
+                                      "%-15s %5llu %6.2f %6.2f %6.2f",
+                                      InputLatency::CategoryName(category),
+                                      static_cast<unsigned long long>(std::min<uint64_t>(latencies.Count(), 99999)),
+                                      toMilliseconds(latencies.Percentile(0.5)),
+                                      toMilliseconds(latencies.Percentile(0.99)),
+                                      toMilliseconds(latencies.Max()));
+    }
+    m_LatencyOverlayWindow->Present();
 }
 
 void Screen::DrawMap(WINDOW* mapWindow, Coords cursor)
 {
+    if (m_IsMapCacheDirty)
+    {
+        RebuildMapCache();
+    }
+
     werase(mapWindow);
     wattron(mapWindow, COLOR_PAIR(ColorPairs::BlackOnYellow));
     box(mapWindow, 0, 0);
@@ -946,58 +1089,105 @@ void Screen::DrawMap(WINDOW* mapWindow, Coords cursor)
     PrintCenter(mapWindow, " World Map ", 0);
     wattroff(mapWindow, A_COLOR | A_BOLD);
 
+    for (Coords::Scalar j = 0; j < Worlds::World::MaximumSpan; j++)
+    {
+        for (size_t k = 0; k < m_MapConnectors.size(); k++)
+        {
+            if (m_MapConnectors[k][j] != 0)
+            {
+                mvwaddch(mapWindow, j + 1, k * 2, m_MapConnectors[k][j]);
+            }
+        }
+        for (Coords::Scalar i = 0; i < Worlds::World::MaximumSpan; i++)
+        {
+            PaintMapCell(mapWindow, { i, j }, cursor);
+        }
+    }
+    wrefresh(mapWindow);
+}
+
+void Screen::PaintMapCell(WINDOW* mapWindow, Coords coords, Coords cursor)
+{
+    chtype icon = m_MapCells[coords.X][coords.Y].Icon;
+
+    // Apply highlighting
+    bool isCurrentRoom = m_WorldManager.CurrentRoom().GetCoords() == coords;
+    if (m_IsWorldMapCursorEnabled && cursor == coords)
+    {
+        icon |= COLOR_PAIR(ColorPairs::BlackOnYellow);
+        icon &= ~A_REVERSE;
+    }
+    else if (isCurrentRoom)
+    {
+        icon |= (COLOR_PAIR(ColorPairs::RedOnDefault) | A_BOLD);
+    }
+    mvwaddch(mapWindow, coords.Y + 1, coords.X * 2 + 1, icon);
+}
+
+void Screen::RestoreMapUnderlay(WINDOW* mapWindow)
+{
+    // Windows are pushed back to the virtual screen in their stacking order,
+    // and only the cells which actually differ get sent to the terminal
+    for (Render::RenderTarget* target :
+         { &m_RenderBackend->RootTarget(), m_GameWorldWindow.get(), m_GameHUDWindow.get(), m_GameMessageWindow.get() })
+    {
+        target->Invalidate();
+        target->Stage();
+    }
+    touchwin(mapWindow);
+    wnoutrefresh(mapWindow);
+    m_RenderBackend->Flush();
+}
+
+void Screen::RebuildMapCache()
+{
     const auto& world = m_WorldManager.CurrentWorld();
+    for (auto& column : m_MapConnectors)
+    {
+        column.fill(0);
+    }
+
     for (Coords::Scalar i = 0; i < Worlds::World::MaximumSpan; i++)
     {
         for (Coords::Scalar j = 0; j < Worlds::World::MaximumSpan; j++)
         {
             Coords current(i, j);
-            WorldMapObjectType type = MapObjectType(current);
+            MapCell& cell          = m_MapCells[i][j];
+            cell.Type              = MapObjectType(current);
+            cell.IsFullyDiscovered = false;
 
             // Select the icon based on the object type
-            chtype icon;
-            switch (type)
+            switch (cell.Type)
             {
             default:
             case WorldMapObjectType::Empty:
-                icon = ' ';
+                cell.Icon = ' ';
                 break;
             case WorldMapObjectType::Room:
             {
-                const auto& room = world.RoomAt(current);
-                icon             = IsRoomFullyDiscovered(room) ? RoomMapIcon(room) : ('?' | A_REVERSE);
+                const auto& room       = world.RoomAt(current);
+                cell.IsFullyDiscovered = IsRoomFullyDiscovered(room);
+                cell.Icon              = cell.IsFullyDiscovered ? RoomMapIcon(room) : ('?' | A_REVERSE);
                 if (room.Entrance(Direction::Left) != nullptr
                     && m_RoomDiscovery.at(&room).at(room.Entrance(Direction::Left)->GetCoords()) == true)
                 {
-                    mvwaddch(mapWindow, j + 1, i * 2, ACS_HLINE);
+                    m_MapConnectors[i][j] = ACS_HLINE;
                 }
                 if (room.Entrance(Direction::Right) != nullptr
                     && m_RoomDiscovery.at(&room).at(room.Entrance(Direction::Right)->GetCoords()) == true)
                 {
-                    mvwaddch(mapWindow, j + 1, i * 2 + 2, ACS_HLINE);
+                    m_MapConnectors[i + 1][j] = ACS_HLINE;
                 }
                 break;
             }
             case WorldMapObjectType::UndiscoveredRoom:
-                icon = '?' | A_BOLD | COLOR_PAIR(ColorPairs::BlackOnDefault);
+                cell.Icon = '?' | A_BOLD | COLOR_PAIR(ColorPairs::BlackOnDefault);
                 break;
             }
-
-            // Apply highlighting
-            bool isCurrentRoom = m_WorldManager.CurrentRoom().GetCoords() == current;
-            if (m_IsWorldMapCursorEnabled && cursor == current)
-            {
-                icon |= COLOR_PAIR(ColorPairs::BlackOnYellow);
-                icon &= ~A_REVERSE;
-            }
-            else if (isCurrentRoom)
-            {
-                icon |= (COLOR_PAIR(ColorPairs::RedOnDefault) | A_BOLD);
-            }
-            mvwaddch(mapWindow, j + 1, i * 2 + 1, icon);
         }
     }
-    wrefresh(mapWindow);
+
+    m_IsMapCacheDirty = false;
 }
 
 void Screen::DrawMapTooltip(Coords cursor, WorldMapObjectType objectType)
@@ -1017,7 +1207,7 @@ void Screen::DrawMapTooltip(Coords cursor, WorldMapObjectType objectType)
         lines.push_back("Room " + std::to_string(room.GetRoomNumber()));
         if (m_WorldManager.IsCurrentRoom(room))
             lines.push_back("* You are here *");
-        if (!IsRoomFullyDiscovered(room))
+        if (!m_MapCells[cursor.X][cursor.Y].IsFullyDiscovered)
             lines.push_back("Partially discovered");
         if (room.GetVisionRadius() > 0)
             lines.push_back("It's dark in " + locPronoun + ".");
@@ -1042,13 +1232,15 @@ void Screen::DrawMapTooltip(Coords cursor, WorldMapObjectType objectType)
     // Calculate the real coord on the screen first
     int cursorActualX = cursor.X * 2 + 1 + WorldMapXPos;
     int cursorActualY = cursor.Y + 1 + WorldMapYPos;
+    auto windowWidget = m_WindowCache.Acquire();
     WINDOW* tooltipWindow
-        = newwin(tooltipHeight,
-                 tooltipWidth,
-                 // Flip the tooltip to the other side of the cursor
-                 // if it cannot fit on either axis
-                 cursorActualY > tooltipHeight ? cursorActualY - tooltipHeight : cursorActualY + 1,
-                 cursorActualX < ScreenWidth - tooltipWidth - 1 ? cursorActualX + 1 : cursorActualX - tooltipWidth);
+        = windowWidget->Open(tooltipHeight,
+                             tooltipWidth,
+                             // Flip the tooltip to the other side of the cursor
+                             // if it cannot fit on either axis
+                             cursorActualY > tooltipHeight ? cursorActualY - tooltipHeight : cursorActualY + 1,
+                             cursorActualX < ScreenWidth - tooltipWidth - 1 ? cursorActualX + 1
+                                                                            : cursorActualX - tooltipWidth);
     // Draw the window
     wattron(tooltipWindow, COLOR_PAIR(ColorPairs::YellowOnDefault) | A_BOLD);
     box(tooltipWindow, 0, 0);
@@ -1059,9 +1251,6 @@ void Screen::DrawMapTooltip(Coords cursor, WorldMapObjectType objectType)
     }
     wattroff(tooltipWindow, A_COLOR);
     wrefresh(tooltipWindow);
-
-    // Cleanup
-    delwin(tooltipWindow);
 }
 
 chtype Screen::FieldIcon(const Worlds::Field& field) const
@@ -1,14 +1,25 @@
 #pragma once
 
+#include "Animation/Animation.h"
+#include "Animation/PresentationSpeed.h"
+#include "Animation/Timeline.h"
 #include "Battle/Battle.h"
+#include "Battle/RandomPlayerDecision.h"
+#include "Components/MenuWidget.h"
+#include "Components/WidgetCache.h"
+#include "Components/WindowWidget.h"
 #include "Entities/EntityManager.h"
 #include "Entities/Player.h"
 #include "InputHandler.h"
 #include "Misc/Coords.h"
+#include "Render/RenderBackend.h"
+#include "Render/RenderTarget.h"
 #include "Subscreen.h"
 #include "WorldMapObjectType.h"
 #include "Worlds/Field.h"
 #include "Worlds/Room.h"
+#include "Worlds/World.h"
+#include <array>
 #include <functional>
 #include <iostream>
 #include <map>
@@ -22,6 +33,8 @@ class BattleScreen;
 
 /**
  * @brief Manager for text display and UI
+ * With the headless render backend nothing is drawn and every prompt is answered by a fixed policy:
+ * message boxes pick their left option and battles are fought with random skills.
  */
 class Screen
 {
@@ -85,11 +98,13 @@ public:
      * @param worldManager world manager
      * @param entityManager entity manager
      * @param player player entity
+     * @param backendType render backend to draw the panels with (default: ncurses)
      */
     Screen(InputHandler& inputHandler,
            const Worlds::WorldManager& worldManager,
            const Entities::EntityManager& entityManager,
-           const Entities::Player& player);
+           const Entities::Player& player,
+           Render::BackendType backendType = Render::BackendType::Ncurses);
 
     /**
      * @brief Destructor
@@ -97,7 +112,7 @@ public:
     ~Screen();
 
     /**
-     * @brief Display the main menu
+     * @brief Display the main menu, or start the game right away if headless
      */
     void MainMenu();
 
@@ -111,6 +126,62 @@ public:
      */
     void Clear();
 
+    /**
+     * @brief Get the render backend
+     * 
+     * @return Render::RenderBackend& render backend
+     */
+    Render::RenderBackend& GetRenderBackend();
+
+    /**
+     * @brief Check whether the screen runs without a display and auto-resolves prompts
+     * 
+     * @return true if headless
+     */
+    bool IsHeadless() const;
+
+    /**
+     * @brief Play an animation, any keypress skips it to the end
+     * 
+     * @param animation animation
+     */
+    void PlayAnimation(Animation::Animation& animation);
+
+    /**
+     * @brief Get the animation presentation speed
+     * 
+     * @return Animation::PresentationSpeed speed
+     */
+    Animation::PresentationSpeed GetPresentationSpeed() const;
+
+    /**
+     * @brief Set the animation presentation speed
+     * 
+     * @param speed speed
+     */
+    void SetPresentationSpeed(Animation::PresentationSpeed speed);
+
+    /**
+     * @brief Set the animation presentation speed and ignore all later changes, e.g. for fast replays
+     * 
+     * @param speed speed
+     */
+    void PinPresentationSpeed(Animation::PresentationSpeed speed);
+
+    /**
+     * @brief Show or hide the keypress-to-frame latency overlay
+     * 
+     * @param isShown true to show it
+     */
+    void SetLatencyOverlay(bool isShown);
+
+    /**
+     * @brief Check whether the latency overlay is shown
+     * 
+     * @return true if shown
+     */
+    bool IsLatencyOverlayShown() const;
+
     /**
      * @brief Get the view
      * 
@@ -150,12 +221,12 @@ public:
     void OkMessageBox(const std::string& message, const std::string& title = "", const std::string& buttonLabel = "OK");
 
     /**
-     * @brief Create a battle screen
+     * @brief Create a battle screen and let it decide the player's turns
+     * If headless, the player's turns are decided by a random policy instead.
      * 
      * @param battle battle
-     * @return BattleScreen& battle screen
      */
-    BattleScreen& OpenBattleScreen(Battle::Battle& battle);
+    void OpenBattleScreen(Battle::Battle& battle);
 
     /**
      * @brief Close the subscreen
@@ -209,20 +280,22 @@ public:
      * @param spaceOptions whether or not to insert a blank line between each two options (default: false)
      * @param scroll whether the menu should scroll or have multiple columns if options won't fit (default: scroll)
      * @param hoverAction action called with the highlighted item whenever moving the menu cursor (default: none)
+     * @param pageAction action called with -1 on Page Up and 1 on Page Down (default: none)
      * @return int id of the selected option
      */
-    static int SelectViaMenu(std::map<int, std::string> options,
-                             int xPos,
-                             int yPos,
-                             int width,
-                             int height,
-                             bool drawBorder                                                       = true,
-                             int padX                                                              = 0,
-                             int padY                                                              = 0,
-                             const std::string& title                                              = "",
-                             bool spaceOptions                                                     = false,
-                             bool scroll                                                           = true,
-                             std::function<void(std::map<int, std::string>::iterator)> hoverAction = {});
+    int SelectViaMenu(const std::map<int, std::string>& options,
+                      int xPos,
+                      int yPos,
+                      int width,
+                      int height,
+                      bool drawBorder                                                             = true,
+                      int padX                                                                    = 0,
+                      int padY                                                                    = 0,
+                      const std::string& title                                                    = "",
+                      bool spaceOptions                                                           = false,
+                      bool scroll                                                                 = true,
+                      std::function<void(std::map<int, std::string>::const_iterator)> hoverAction = {},
+                      std::function<void(int)> pageAction                                         = {});
 
 private:
     /**
@@ -235,24 +308,69 @@ private:
     constexpr static const int WorldMapXPos = (ScreenWidth - WorldMapWidth) / 2;
     constexpr static const int WorldMapYPos = (ScreenHeight - WorldMapHeight) / 2;
 
+    /**
+     * @brief Cached contents of a single room cell on the world map
+     */
+    struct MapCell
+    {
+        /**
+         * @brief Object type
+         */
+        WorldMapObjectType Type;
+
+        /**
+         * @brief Icon without any highlighting applied
+         */
+        chtype Icon;
+
+        /**
+         * @brief Whether the room is fully discovered (only valid for rooms)
+         */
+        bool IsFullyDiscovered;
+    };
+
+    /**
+     * @brief Grid of world map cells, indexed [X][Y] like the world grid
+     */
+    using MapCellGrid = std::array<std::array<MapCell, Worlds::World::MaximumSpan>, Worlds::World::MaximumSpan>;
+
+    /**
+     * @brief Grid of hallway connectors between map cells, indexed [K][Y] where column K is drawn at X = 2K
+     * A value of 0 means no connector is drawn.
+     */
+    using MapConnectorGrid = std::array<std::array<chtype, Worlds::World::MaximumSpan>, Worlds::World::MaximumSpan + 1>;
+
     InputHandler& m_InputHandler;
     const Worlds::WorldManager& m_WorldManager;
     const Entities::EntityManager& m_EntityManager;
     const Entities::Player& m_Player;
     View m_View;
-    WINDOW* m_GameWorldWindow;
-    WINDOW* m_GameHUDWindow;
-    WINDOW* m_GameMessageWindow;
+    std::unique_ptr<Render::RenderBackend> m_RenderBackend;
+    std::unique_ptr<Animation::Timeline> m_Timeline;
+    std::unique_ptr<Render::RenderTarget> m_GameWorldWindow;
+    std::unique_ptr<Render::RenderTarget> m_GameHUDWindow;
+    std::unique_ptr<Render::RenderTarget> m_GameMessageWindow;
+    std::unique_ptr<Render::RenderTarget> m_LatencyOverlayWindow;
     const Worlds::Room* m_CurrentRoom;
     std::string m_Message;
     bool m_IsWorldMapCursorEnabled;
     std::unique_ptr<Subscreen> m_Subscreen;
     std::map<const Worlds::Room*, std::unordered_map<Coords, bool>> m_RoomDiscovery;
+    MapCellGrid m_MapCells;
+    MapConnectorGrid m_MapConnectors;
+    bool m_IsMapCacheDirty;
+    bool m_IsPresentationSpeedPinned;
+    Components::WidgetCache<Components::MenuWidget> m_MenuCache;
+    Components::WidgetCache<Components::WindowWidget> m_WindowCache;
+    std::string m_MenuLabelBuffer;
+    Battle::RandomPlayerDecision m_HeadlessDecision;
 
     /**
      * @brief Initialize the screen
+     * 
+     * @param backendType render backend type
      */
-    void Init();
+    void Init(Render::BackendType backendType);
 
     /**
      * @brief Terminate the screen
@@ -294,6 +412,11 @@ private:
      */
     void DrawMessageWindow(bool shouldPostMessage = true);
 
+    /**
+     * @brief Draw the latency overlay on top of the world panel
+     */
+    void DrawLatencyOverlay();
+
     /**
      * @brief Draw the map in the map window
      * If cursor coords are set to a non-default value, will draw the cursor
@@ -304,6 +427,29 @@ private:
      */
     void DrawMap(WINDOW* mapWindow, Coords cursor = { -1, -1 });
 
+    /**
+     * @brief Paint a single room cell of the map from the map cache
+     * Does not refresh the window.
+     * 
+     * @param mapWindow map window
+     * @param coords world grid coords of the cell
+     * @param cursor cursor position on world grid
+     */
+    void PaintMapCell(WINDOW* mapWindow, Coords coords, Coords cursor);
+
+    /**
+     * @brief Restore the windows underneath the map window and the map window itself on the terminal
+     * This gets rid of leftover tooltips without redrawing any window contents.
+     * 
+     * @param mapWindow map window
+     */
+    void RestoreMapUnderlay(WINDOW* mapWindow);
+
+    /**
+     * @brief Rebuild the map cache from the current discovery state
+     */
+    void RebuildMapCache();
+
     /**
      * @brief Draw the tooltip for the object under the cursor
      * 
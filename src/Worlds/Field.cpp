@@ -16,21 +16,6 @@ Field::Field(Coords coords)
 {
 }
 
-Coords Field::GetCoords() const
-{
-    return m_Coords;
-}
-
-const Entities::Entity* Field::ForegroundEntity() const
-{
-    return m_ForegroundEntity;
-}
-
-const Entities::Entity* Field::BackgroundEntity() const
-{
-    return m_BackgroundEntity;
-}
-
 void Field::PlaceEntity(Entities::Entity& entity)
 {
     if (entity.IsBlocking() && m_ForegroundEntity == nullptr)
@@ -64,14 +49,4 @@ Entities::Entity* Field::VacateBackground()
     return tmp;
 }
 
-bool Field::IsAccessible() const
-{
-    return m_Accessible;
-}
-
-void Field::MakeAccessible()
-{
-    m_Accessible = true;
-}
-
 } /* namespace Worlds */
\ No newline at end of file
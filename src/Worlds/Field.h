@@ -23,21 +23,21 @@ public:
      * 
      * @return Coords coordinates
      */
-    Coords GetCoords() const;
+    inline Coords GetCoords() const { return m_Coords; }
 
     /**
      * @brief Get the foreground entity
      * 
      * @return const Entities::Entity* foreground entity
      */
-    const Entities::Entity* ForegroundEntity() const;
+    inline const Entities::Entity* ForegroundEntity() const { return m_ForegroundEntity; }
 
     /**
      * @brief Get the background entity
      * 
      * @return const Entities::Entity* background entity
      */
-    const Entities::Entity* BackgroundEntity() const;
+    inline const Entities::Entity* BackgroundEntity() const { return m_BackgroundEntity; }
 
     /**
      * @brief Place the given entity onto this field
@@ -66,12 +66,12 @@ public:
      * 
      * @return true if accessible
      */
-    bool IsAccessible() const;
+    inline bool IsAccessible() const { return m_Accessible; }
 
     /**
      * @brief Permanently make this field accessible
      */
-    void MakeAccessible();
+    inline void MakeAccessible() { m_Accessible = true; }
 
 private:
     Coords m_Coords;
@@ -1,7 +1,6 @@
 #include "BoxRoomLayout.h"
 #include "Misc/Coords.h"
 #include "Misc/Direction.h"
-#include "Misc/RNG.h"
 #include "Misc/Utils.h"
 #include "RoomGenerationParameters.h"
 #include "UI/CameraStyle.h"
@@ -11,8 +10,8 @@
 namespace Worlds::Generation
 {
 
-BoxRoomLayout::BoxRoomLayout(const RoomGenerationParameters& parameters)
-    : RoomLayout(parameters), m_Subtype(Subtype::Default)
+BoxRoomLayout::BoxRoomLayout(const RoomGenerationParameters& parameters, const RNG::KeyedStream& random)
+    : RoomLayout(parameters, random), m_Subtype(Subtype::Default)
 {
     BoxRoomLayout::Generate();
 }
@@ -21,11 +20,7 @@ void BoxRoomLayout::Generate()
 {
     GenerateAttributes();
 
-    m_Map.resize(m_Width);
-    for (auto& col : m_Map)
-    {
-        col.resize(m_Height);
-    }
+    AllocateFields();
 
     // Generate entrance positions
     std::vector<Coords> entranceCoords;
@@ -42,30 +37,29 @@ void BoxRoomLayout::Generate()
     {
         for (Coords::Scalar row = 0; row < m_Height; row++)
         {
-            m_Map[col][row] = FieldType::Accessible;
+            FieldType value = FieldType::Wall;
             if ((col > 0 && row > 0 && col < m_Width - 1 && row < m_Height - 1))
             {
-                continue;
+                value = FieldType::Accessible;
             }
-
-            if (row == 0 && m_Entrances.count(Direction::Up) > 0 && Abs(col - m_Entrances[Direction::Up].X) <= EntranceRadius)
+            else if (row == 0 && m_Entrances.count(Direction::Up) > 0 && Abs(col - m_Entrances[Direction::Up].X) <= EntranceRadius)
             {
-                continue;
+                value = FieldType::Accessible;
             }
-            if (col == m_Width - 1 && m_Entrances.count(Direction::Right) > 0 && Abs(row - m_Entrances[Direction::Right].Y) <= EntranceRadius)
+            else if (col == m_Width - 1 && m_Entrances.count(Direction::Right) > 0 && Abs(row - m_Entrances[Direction::Right].Y) <= EntranceRadius)
             {
-                continue;
+                value = FieldType::Accessible;
             }
-            if (row == m_Height - 1 && m_Entrances.count(Direction::Down) > 0 && Abs(col - m_Entrances[Direction::Down].X) <= EntranceRadius)
+            else if (row == m_Height - 1 && m_Entrances.count(Direction::Down) > 0 && Abs(col - m_Entrances[Direction::Down].X) <= EntranceRadius)
             {
-                continue;
+                value = FieldType::Accessible;
             }
-            if (col == 0 && m_Entrances.count(Direction::Left) > 0 && Abs(row - m_Entrances[Direction::Left].Y) <= EntranceRadius)
+            else if (col == 0 && m_Entrances.count(Direction::Left) > 0 && Abs(row - m_Entrances[Direction::Left].Y) <= EntranceRadius)
             {
-                continue;
+                value = FieldType::Accessible;
             }
 
-            m_Map[col][row] = FieldType::Wall;
+            SetField(Coords(col, row), value);
         }
     }
 
@@ -85,20 +79,20 @@ void BoxRoomLayout::GenerateAttributes()
     RoomLayout::GenerateAttributes();
 
     // Randomize dimensions, make sure they're an even number
-    m_Width = RNG::RandomInt(MinimumWidth, MaximumWidth);
+    m_Width = m_Random.RandomInt(MinimumWidth, MaximumWidth);
     m_Width += m_Width % 2;
-    m_Height = RNG::RandomInt(MinimumHeight, MaximumHeight);
+    m_Height = m_Random.RandomInt(MinimumHeight, MaximumHeight);
     m_Height += m_Height % 2;
 
     m_CameraStyle = UI::CameraStyle::Fixed;
     // Generate lighting
-    if (RNG::Chance(m_Parameters.DarknessChance))
+    if (m_Random.Chance(m_Parameters.DarknessChance))
     {
         m_VisionRadius = DarknessVisionRadius;
     }
 
     // Randomize room subtype
-    double subtypeRoll = RNG::RandomDouble();
+    double subtypeRoll = m_Random.RandomDouble();
     if (subtypeRoll > 0.75)
     {
         m_Subtype = Subtype::ColumnsOnly;
@@ -109,18 +103,18 @@ void BoxRoomLayout::GenerateAttributes()
 
 void BoxRoomLayout::GenerateColumns()
 {
-    double pattern = RNG::RandomDouble();
+    double pattern = m_Random.RandomDouble();
 
-    Coords::Scalar hOffset = RNG::RandomInt(2, 5);
+    Coords::Scalar hOffset = m_Random.RandomInt(2, 5);
     Coords::Scalar vOffset = 2;
 
     // Corner columns
     if (pattern > 0.4)
     {
-        m_Map[hOffset][vOffset]                              = FieldType::Column;
-        m_Map[m_Width - hOffset - 1][vOffset]                = FieldType::Column;
-        m_Map[hOffset][m_Height - vOffset - 1]               = FieldType::Column;
-        m_Map[m_Width - hOffset - 1][m_Height - vOffset - 1] = FieldType::Column;
+        SetField(Coords(hOffset, vOffset), FieldType::Column);
+        SetField(Coords(m_Width - hOffset - 1, vOffset), FieldType::Column);
+        SetField(Coords(hOffset, m_Height - vOffset - 1), FieldType::Column);
+        SetField(Coords(m_Width - hOffset - 1, m_Height - vOffset - 1), FieldType::Column);
     }
 
     // Center columns
@@ -129,12 +123,12 @@ void BoxRoomLayout::GenerateColumns()
         Coords::Scalar hCenter = m_Width / 2;
         Coords::Scalar vCenter = m_Height / 2;
 
-        if (RNG::Chance(0.5)) vOffset--;
+        if (m_Random.Chance(0.5)) vOffset--;
 
-        m_Map[hCenter - hOffset - 1][vCenter - vOffset - 1] = FieldType::Column;
-        m_Map[hCenter + hOffset][vCenter - vOffset - 1]     = FieldType::Column;
-        m_Map[hCenter - hOffset - 1][vCenter + vOffset]     = FieldType::Column;
-        m_Map[hCenter + hOffset][vCenter + vOffset]         = FieldType::Column;
+        SetField(Coords(hCenter - hOffset - 1, vCenter - vOffset - 1), FieldType::Column);
+        SetField(Coords(hCenter + hOffset, vCenter - vOffset - 1), FieldType::Column);
+        SetField(Coords(hCenter - hOffset - 1, vCenter + vOffset), FieldType::Column);
+        SetField(Coords(hCenter + hOffset, vCenter + vOffset), FieldType::Column);
     }
 }
 
@@ -16,8 +16,9 @@ public:
      * @brief Constructor
      * 
      * @param parameters parameters
+     * @param random stream to draw from
      */
-    BoxRoomLayout(const RoomGenerationParameters& parameters);
+    BoxRoomLayout(const RoomGenerationParameters& parameters, const RNG::KeyedStream& random);
 
 private:
     /**
@@ -1,7 +1,6 @@
 #include "HallwayRoomLayout.h"
 #include "Misc/Coords.h"
 #include "Misc/Direction.h"
-#include "Misc/RNG.h"
 #include "Misc/Utils.h"
 #include "RoomGenerationParameters.h"
 #include "UI/CameraStyle.h"
@@ -11,8 +10,8 @@
 namespace Worlds::Generation
 {
 
-HallwayRoomLayout::HallwayRoomLayout(const RoomGenerationParameters& parameters)
-    : RoomLayout(parameters)
+HallwayRoomLayout::HallwayRoomLayout(const RoomGenerationParameters& parameters, const RNG::KeyedStream& random)
+    : RoomLayout(parameters, random)
 {
     HallwayRoomLayout::Generate();
 }
@@ -21,11 +20,7 @@ void HallwayRoomLayout::Generate()
 {
     GenerateAttributes();
 
-    m_Map.resize(m_Width);
-    for (auto& col : m_Map)
-    {
-        col.resize(m_Height);
-    }
+    AllocateFields();
 
     // Generate entrance positions
     std::map<Direction, Coords> allEntrances;
@@ -43,7 +38,7 @@ void HallwayRoomLayout::Generate()
 
     // Wall positioning algorithm
     // Hallways may branch, but they must be perfectly straight either horizontally or vertically.
-    bool vertical = RNG::Chance(0.5);
+    bool vertical = m_Random.Chance(0.5);
 
     // The two entrance positions on the straight axis must thus share a coordinate.
     if (vertical)
@@ -196,14 +191,14 @@ void HallwayRoomLayout::GenerateAttributes()
     RoomLayout::GenerateAttributes();
 
     // Randomize dimensions, make sure they're an even number
-    m_Width = RNG::RandomInt(MinimumWidth, MaximumWidth);
+    m_Width = m_Random.RandomInt(MinimumWidth, MaximumWidth);
     m_Width += m_Width % 2;
-    m_Height = RNG::RandomInt(MinimumHeight, MaximumHeight);
+    m_Height = m_Random.RandomInt(MinimumHeight, MaximumHeight);
     m_Height += m_Height % 2;
 
     m_CameraStyle = UI::CameraStyle::PlayerCentered;
     // Generate lighting
-    if (RNG::Chance(m_Parameters.DarknessChance))
+    if (m_Random.Chance(m_Parameters.DarknessChance))
     {
         m_VisionRadius = DarknessVisionRadius;
     }
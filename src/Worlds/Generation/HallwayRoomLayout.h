@@ -17,8 +17,9 @@ public:
      * @brief Constructor
      * 
      * @param parameters parameters
+     * @param random stream to draw from
      */
-    HallwayRoomLayout(const RoomGenerationParameters& parameters);
+    HallwayRoomLayout(const RoomGenerationParameters& parameters, const RNG::KeyedStream& random);
 
 private:
     constexpr static const Coords::Scalar MaximumWidth = 30;
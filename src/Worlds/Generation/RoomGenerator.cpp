@@ -4,7 +4,7 @@
 #include "BoxRoomLayout.h"
 #include "HallwayRoomLayout.h"
 #include "Misc/Coords.h"
-#include "Misc/RNG.h"
+#include "Misc/KeyedStream.h"
 #include "RoomGenerationParameters.h"
 #include "RoomLayout.h"
 #include <memory>
@@ -22,11 +22,19 @@ RoomGenerator::RoomGenerator(World& world)
 
 std::unique_ptr<RoomLayout> RoomGenerator::CreateLayout(Coords coords)
 {
-    int layoutNumber = RNG::RandomInt(RoomLayout::NumberOfTypes);
-    return CreateLayout(static_cast<RoomLayout::Type>(layoutNumber), coords);
+    RNG::KeyedStream random = RoomStream(coords);
+    int layoutNumber        = random.RandomInt(RoomLayout::NumberOfTypes);
+    return CreateLayout(static_cast<RoomLayout::Type>(layoutNumber), coords, random);
 }
 
 std::unique_ptr<RoomLayout> RoomGenerator::CreateLayout(RoomLayout::Type layoutType, Coords coords)
+{
+    return CreateLayout(layoutType, coords, RoomStream(coords));
+}
+
+std::unique_ptr<RoomLayout> RoomGenerator::CreateLayout(RoomLayout::Type layoutType,
+                                                        Coords coords,
+                                                        const RNG::KeyedStream& random)
 {
     std::unique_ptr<RoomLayout> layout;
     m_Parameters.EntranceInfo = EntranceInfo(coords);
@@ -34,10 +42,10 @@ std::unique_ptr<RoomLayout> RoomGenerator::CreateLayout(RoomLayout::Type layoutT
     switch (layoutType)
     {
     case RoomLayout::Type::Box:
-        layout = std::make_unique<BoxRoomLayout>(m_Parameters);
+        layout = std::make_unique<BoxRoomLayout>(m_Parameters, random);
         break;
     case RoomLayout::Type::Hallway:
-        layout = std::make_unique<HallwayRoomLayout>(m_Parameters);
+        layout = std::make_unique<HallwayRoomLayout>(m_Parameters, random);
         break;
     }
 
@@ -51,6 +59,14 @@ std::unique_ptr<RoomLayout> RoomGenerator::CreateLayout(RoomLayout::Type layoutT
     return layout;
 }
 
+RNG::KeyedStream RoomGenerator::RoomStream(Coords coords) const
+{
+    RNG::StreamKey key;
+    key.World = m_World.GetWorldNumber();
+    key.Room  = coords;
+    return RNG::KeyedStream(m_World.GetSeed(), key);
+}
+
 void RoomGenerator::InitializeParameters()
 {
     // These are relevant for the starting room
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Misc/Coords.h"
+#include "Misc/KeyedStream.h"
 #include "RoomGenerationParameters.h"
 #include "RoomLayout.h"
 #include <memory>
@@ -17,6 +18,8 @@ namespace Worlds::Generation
 
 /**
  * @brief Manages procedural generation of rooms in a single world
+ * Every room draws from its own stream keyed by the world and room coordinates, so a room's layout only depends
+ * on the game seed and the generation parameters at the time it is created.
  */
 class RoomGenerator
 {
@@ -51,6 +54,26 @@ private:
     int m_GeneratedRoomCount;
     int m_UndiscoveredRoomCount;
 
+    /**
+     * @brief Create a layout of specific type for the given coords
+     * 
+     * @param layoutType layout type
+     * @param roomCoords room coords
+     * @param random stream to generate the layout from
+     * @return std::unique_ptr<RoomLayout> new layout
+     */
+    std::unique_ptr<RoomLayout> CreateLayout(RoomLayout::Type layoutType,
+                                             Coords roomCoords,
+                                             const RNG::KeyedStream& random);
+
+    /**
+     * @brief Get the random stream of the room at the given coords
+     * 
+     * @param roomCoords room coords
+     * @return RNG::KeyedStream stream
+     */
+    RNG::KeyedStream RoomStream(Coords roomCoords) const;
+
     /**
      * @brief Initialize the generation parameters struct
      */
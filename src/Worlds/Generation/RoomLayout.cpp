@@ -3,55 +3,46 @@
 #include "Misc/Coords.h"
 #include "Misc/Direction.h"
 #include "Misc/Exceptions.h"
-#include "Misc/RNG.h"
 #include "RoomGenerationParameters.h"
 #include "UI/CameraStyle.h"
 #include <algorithm>
 #include <map>
+#include <utility>
 #include <vector>
 
 namespace Worlds::Generation
 {
 
-RoomLayout::RoomLayout(const RoomGenerationParameters& parameters)
+RoomLayout::RoomLayout(const RoomGenerationParameters& parameters, const RNG::KeyedStream& random)
     : m_Width(0),
       m_Height(0),
+      m_AccessibleFieldCount(0),
       m_Parameters(parameters),
       m_CameraStyle(UI::CameraStyle::Fixed),
       m_VisionRadius(0),
-      m_NPCSpawnChance(0)
+      m_NPCSpawnChance(0),
+      m_Random(random)
 {
 }
 
-int RoomLayout::WriteToFields(std::vector<std::vector<Field>>& fields) const
+std::vector<Field> RoomLayout::TakeFields()
 {
-    int accessibleFieldCount = 0;
-    fields.clear();
-    fields.resize(m_Width);
-    for (Coords::Scalar i = 0; i < m_Width; i++)
-    {
-        for (Coords::Scalar j = 0; j < m_Height; j++)
-        {
-            fields[i].emplace_back(Coords(i, j));
-            switch (m_Map[i][j])
-            {
-            case FieldType::Accessible:
-                fields[i][j].MakeAccessible();
-                accessibleFieldCount++;
-                break;
-            case FieldType::Wall:
-                fields[i][j].PlaceEntity(Entities::Wall);
-                break;
-            case FieldType::Column:
-                fields[i][j].PlaceEntity(Entities::Column);
-                break;
-            default:
-                break;
-            }
-        }
-    }
+    return std::move(m_Fields);
+}
 
-    return accessibleFieldCount;
+Coords::Scalar RoomLayout::GetWidth() const
+{
+    return m_Width;
+}
+
+Coords::Scalar RoomLayout::GetHeight() const
+{
+    return m_Height;
+}
+
+int RoomLayout::GetAccessibleFieldCount() const
+{
+    return m_AccessibleFieldCount;
 }
 
 const std::map<Direction, Coords>& RoomLayout::GetEntrances() const
@@ -93,7 +84,7 @@ std::vector<Direction> RoomLayout::GenerateEntranceDirections() const
     for (const auto& dir : viable)
     {
         if ((m_Parameters.EntranceInfo.count(dir) > 0 && m_Parameters.EntranceInfo.at(dir) == true) ||
-            (m_Parameters.EntranceInfo.count(dir) == 0 && RNG::Chance(m_Parameters.OptionalEntranceChance)))
+            (m_Parameters.EntranceInfo.count(dir) == 0 && m_Random.Chance(m_Parameters.OptionalEntranceChance)))
         {
             directions.push_back(dir);
         }
@@ -107,7 +98,7 @@ std::vector<Direction> RoomLayout::GenerateEntranceDirections() const
             auto whereWeCameFrom = std::find(viable.begin(), viable.end(), directions.front());
             viable.erase(whereWeCameFrom);
         }
-        auto randomDir = viable[RNG::RandomInt(viable.size())];
+        auto randomDir = viable[m_Random.RandomInt(viable.size())];
         directions.push_back(randomDir);
     }
     return directions;
@@ -119,46 +110,86 @@ Coords RoomLayout::GenerateEntranceCoords(Direction dir) const
     switch (dir())
     {
     case Direction::Value::Up:
-        return Coords(RNG::RandomInt(MinimumCornerDistance, m_Width - MinimumCornerDistance), 0);
+        return Coords(m_Random.RandomInt(MinimumCornerDistance, m_Width - MinimumCornerDistance), 0);
     case Direction::Value::Right:
-        return Coords(m_Width - 1, RNG::RandomInt(MinimumCornerDistance, m_Height - MinimumCornerDistance));
+        return Coords(m_Width - 1, m_Random.RandomInt(MinimumCornerDistance, m_Height - MinimumCornerDistance));
     case Direction::Value::Down:
-        return Coords(RNG::RandomInt(MinimumCornerDistance, m_Width - MinimumCornerDistance), m_Height - 1);
+        return Coords(m_Random.RandomInt(MinimumCornerDistance, m_Width - MinimumCornerDistance), m_Height - 1);
     case Direction::Value::Left:
-        return Coords(0, RNG::RandomInt(MinimumCornerDistance, m_Height - MinimumCornerDistance));
+        return Coords(0, m_Random.RandomInt(MinimumCornerDistance, m_Height - MinimumCornerDistance));
     default:
         throw InvalidPositionException("Attempted to generate entrance coords for direction None");
     }
 }
 
+void RoomLayout::AllocateFields()
+{
+    m_Fields.clear();
+    m_Fields.reserve(static_cast<size_t>(m_Width) * m_Height);
+    for (Coords::Scalar i = 0; i < m_Width; i++)
+    {
+        for (Coords::Scalar j = 0; j < m_Height; j++)
+        {
+            m_Fields.emplace_back(Coords(i, j));
+        }
+    }
+    m_AccessibleFieldCount = 0;
+}
+
+void RoomLayout::SetField(Coords coords, FieldType value)
+{
+    Field& field = m_Fields[coords.X * m_Height + coords.Y];
+    const Entities::Entity* foreground = field.ForegroundEntity();
+    if (field.IsAccessible())
+    {
+        if (value == FieldType::Accessible) return;
+        m_AccessibleFieldCount--;
+        field = Field(coords);
+    }
+    else if (foreground != nullptr)
+    {
+        // Overlapping strokes mostly redraw fields with what they already hold
+        if (value == FieldType::Wall && foreground == &Entities::Wall) return;
+        if (value == FieldType::Column && foreground == &Entities::Column) return;
+        field = Field(coords);
+    }
+
+    switch (value)
+    {
+    case FieldType::Accessible:
+        field.MakeAccessible();
+        m_AccessibleFieldCount++;
+        break;
+    case FieldType::Wall:
+        field.PlaceEntity(Entities::Wall);
+        break;
+    case FieldType::Column:
+        field.PlaceEntity(Entities::Column);
+        break;
+    default:
+        break;
+    }
+}
+
 void RoomLayout::DrawMapLine(Coords from, Coords to, FieldType value)
 {
     for (const auto& pos : from.StraightPath(to))
     {
-        m_Map[pos.X][pos.Y] = value;
+        SetField(pos, value);
     }
 }
 
 void RoomLayout::DrawMapBox(Coords center, Coords::Scalar radius, FieldType value)
 {
-    for (Coords::Scalar i = 0; i <= radius; i++)
+    Coords::Scalar left   = std::max<Coords::Scalar>(center.X - radius, 0);
+    Coords::Scalar right  = std::min<Coords::Scalar>(center.X + radius, m_Width - 1);
+    Coords::Scalar top    = std::max<Coords::Scalar>(center.Y - radius, 0);
+    Coords::Scalar bottom = std::min<Coords::Scalar>(center.Y + radius, m_Height - 1);
+    for (Coords::Scalar i = left; i <= right; i++)
     {
-        for (Coords::Scalar j = 0; j <= radius; j++)
+        for (Coords::Scalar j = top; j <= bottom; j++)
         {
-            Coords::Scalar left = center.X - i;
-            Coords::Scalar right = center.X + i;
-            Coords::Scalar up = center.Y - j;
-            Coords::Scalar down = center.Y + j;
-            if (left < m_Width && left >= 0)
-            {
-                if (up < m_Height && up >= 0) m_Map[left][up] = value;
-                if (down < m_Height && down >= 0) m_Map[left][down] = value;
-            }
-            if (right < m_Width && right >= 0)
-            {
-                if (up < m_Height && up >= 0) m_Map[right][up] = value;
-                if (down < m_Height && down >= 0) m_Map[right][down] = value;
-            }
+            SetField(Coords(i, j), value);
         }
     }
 }
@@ -3,6 +3,7 @@
 #include "Field.h"
 #include "Misc/Coords.h"
 #include "Misc/Direction.h"
+#include "Misc/KeyedStream.h"
 #include "RoomGenerationParameters.h"
 #include "UI/CameraStyle.h"
 #include <cstdint>
@@ -50,12 +51,33 @@ public:
     virtual ~RoomLayout() = default;
 
     /**
-     * @brief Write the layout to a 2D vector of fields
+     * @brief Hand the generated fields over to the room, leaving the layout without any
+     * Fields are stored column by column, the field at (X, Y) is at index X * height + Y.
+     * 
+     * @return std::vector<Field> fields
+     */
+    std::vector<Field> TakeFields();
+
+    /**
+     * @brief Get the width
+     * 
+     * @return Coords::Scalar width
+     */
+    Coords::Scalar GetWidth() const;
+
+    /**
+     * @brief Get the height
+     * 
+     * @return Coords::Scalar height
+     */
+    Coords::Scalar GetHeight() const;
+
+    /**
+     * @brief Get the number of accessible fields
      * 
-     * @param fields fields
      * @return int number of accessible fields in the room
      */
-    int WriteToFields(std::vector<std::vector<Field>>& fields) const;
+    int GetAccessibleFieldCount() const;
 
     /**
      * @brief Get a map of entrance coords per direction
@@ -114,19 +136,26 @@ protected:
 
     Coords::Scalar m_Width;
     Coords::Scalar m_Height;
-    std::vector<std::vector<FieldType>> m_Map;
+    std::vector<Field> m_Fields;
+    int m_AccessibleFieldCount;
     const RoomGenerationParameters& m_Parameters;
     std::map<Direction, Coords> m_Entrances;
     UI::CameraStyle m_CameraStyle;
     int m_VisionRadius;
     double m_NPCSpawnChance;
 
+    /**
+     * @brief Stream all random decisions are drawn from, also by the const generation helpers
+     */
+    mutable RNG::KeyedStream m_Random;
+
     /**
      * @brief Constructor
      * 
      * @param parameters parameters
+     * @param random stream to draw from
      */
-    RoomLayout(const RoomGenerationParameters& parameters);
+    RoomLayout(const RoomGenerationParameters& parameters, const RNG::KeyedStream& random);
 
     /**
      * @brief Generate the layout
@@ -154,6 +183,19 @@ protected:
      */
     virtual Coords GenerateEntranceCoords(Direction dir) const;
 
+    /**
+     * @brief Allocate the fields for the current dimensions, all of them empty and inaccessible
+     */
+    void AllocateFields();
+
+    /**
+     * @brief Set the type of a field, replacing whatever it was before
+     * 
+     * @param coords field coords
+     * @param value type to apply
+     */
+    void SetField(Coords coords, FieldType value);
+
     /**
      * @brief Draw a line of fields at and between the two given positions in the same line
      * 
@@ -17,20 +17,21 @@ namespace Worlds
 
 Room::Room(WorldManager& worldManager,
            World& world,
-           const Generation::RoomLayout& layout,
+           Generation::RoomLayout& layout,
            int roomNumber,
            Coords coords)
     : m_WorldManager(worldManager),
       m_World(world),
       m_RoomNumber(roomNumber),
       m_Coords(coords),
+      m_Width(layout.GetWidth()),
+      m_Height(layout.GetHeight()),
+      m_Fields(layout.TakeFields()),
       m_CameraStyle(layout.GetCameraStyle()),
       m_VisionRadius(layout.GetVisionRadius()),
+      m_AccessibleFieldCount(layout.GetAccessibleFieldCount()),
       m_NPCSpawnChance(layout.GetNPCSpawnChance())
 {
-    m_AccessibleFieldCount = layout.WriteToFields(m_Fields);
-    m_Width = m_Fields.size();
-    m_Height = m_Fields[0].size();
     const auto& entrances = layout.GetEntrances();
     for (const auto& dir : Direction::All)
     {
@@ -153,7 +154,7 @@ Field& Room::FieldAt(Coords coords)
     }
     else
     {
-        return m_Fields[coords.X][coords.Y];
+        return m_Fields[coords.X * m_Height + coords.Y];
     }
 }
 
@@ -169,7 +170,7 @@ const Field& Room::FieldAt(Coords coords) const
     }
     else
     {
-        return m_Fields[coords.X][coords.Y];
+        return m_Fields[coords.X * m_Height + coords.Y];
     }
 }
 
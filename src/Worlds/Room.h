@@ -25,13 +25,13 @@ public:
      * 
      * @param worldManager world manager
      * @param world world
-     * @param layout layout
+     * @param layout layout, its fields are moved into the room
      * @param roomNumber room number
      * @param coords coordinates
      */
     Room(WorldManager& worldManager,
          World& world,
-         const Generation::RoomLayout& layout,
+         Generation::RoomLayout& layout,
          int roomNumber,
          Coords coords);
 
@@ -164,7 +164,7 @@ protected:
     Coords::Scalar m_Width;
     Coords::Scalar m_Height;
     std::array<Field*, 4> m_Entrances;
-    std::vector<std::vector<Field>> m_Fields;
+    std::vector<Field> m_Fields;
     UI::CameraStyle m_CameraStyle;
     int m_VisionRadius;
     int m_AccessibleFieldCount;
@@ -31,6 +31,11 @@ int World::GetWorldNumber() const
     return m_WorldNumber;
 }
 
+uint64_t World::GetSeed() const
+{
+    return m_WorldManager.GetSeed();
+}
+
 Room& World::RoomAt(Coords coords)
 {
     if (coords.X >= MaximumSpan || coords.Y >= MaximumSpan ||
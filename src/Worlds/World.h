@@ -42,6 +42,13 @@ public:
      */
     int GetWorldNumber() const;
 
+    /**
+     * @brief Get the game seed
+     * 
+     * @return uint64_t seed
+     */
+    uint64_t GetSeed() const;
+
     /**
      * @brief Get the room at the specified position of the world grid
      * 
@@ -1,6 +1,8 @@
 #include "WorldManager.h"
 #include "Misc/Coords.h"
 #include "Misc/Direction.h"
+#include "Misc/Profiler.h"
+#include "Misc/RNG.h"
 #include "Room.h"
 #include "World.h"
 #include <memory>
@@ -8,8 +10,13 @@
 namespace Worlds
 {
 
-WorldManager::WorldManager()
-    : m_NextWorldNumber(1),
+WorldManager::WorldManager() : WorldManager(RNG::ThreadEngine()())
+{
+}
+
+WorldManager::WorldManager(uint64_t seed)
+    : m_Seed(seed),
+      m_NextWorldNumber(1),
       m_CurrentWorld(nullptr),
       m_CurrentRoomCoords(World::CenterPos, World::CenterPos)
 {
@@ -39,6 +46,7 @@ bool WorldManager::IsCurrentRoom(const Room& room) const
 
 Room& WorldManager::SwitchRoom(Direction dir)
 {
+    PROFILE_SCOPE("WorldManager::SwitchRoom");
     Coords newCoords = m_CurrentRoomCoords.Adjacent(dir);
     if (!m_CurrentWorld->RoomExists(newCoords))
     {
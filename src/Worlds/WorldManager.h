@@ -2,6 +2,7 @@
 
 #include "Misc/Coords.h"
 #include "Misc/Direction.h"
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -18,10 +19,24 @@ class WorldManager
 {
 public:
     /**
-     * @brief Constructor
+     * @brief Constructor, with a seed drawn from the thread's generator
      */
     WorldManager();
 
+    /**
+     * @brief Constructor
+     *
+     * @param seed game seed, which determines every generated room
+     */
+    explicit WorldManager(uint64_t seed);
+
+    /**
+     * @brief Get the game seed
+     *
+     * @return uint64_t seed
+     */
+    inline uint64_t GetSeed() const { return m_Seed; }
+
     /**
      * @brief Get the world where the player is present
      * 
@@ -67,6 +82,7 @@ public:
     Room& SwitchRoom(Direction dir);
 
 private:
+    uint64_t m_Seed;
     std::vector<std::unique_ptr<World>> m_Worlds;
     int m_NextWorldNumber;
     World* m_CurrentWorld;
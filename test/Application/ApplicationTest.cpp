@@ -0,0 +1,109 @@
+#define BOOST_TEST_MODULE Application.Application
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+#include "Application/Application.h"
+#include "Application/Options.h"
+#include "Battle/Battle.h"
+#include "Battle/BattleRecord.h"
+#include "Battle/RandomPlayerDecision.h"
+#include "Entities/NPC/NPCCollection.h"
+#include "Entities/Player.h"
+#include "Misc/Exceptions.h"
+#include "Misc/RNG.h"
+#include <cstdio>
+#include <fstream>
+
+/**
+ * @brief Run a script headless and return the summary without the timing line
+ */
+static std::string RunScript(const std::string& commands, uint64_t seed)
+{
+    static const std::string ScriptFile = "data/test-script.txt";
+    std::ofstream(ScriptFile) << commands;
+
+    Application::Options options;
+    options.IsHeadless = true;
+    options.ScriptFile = ScriptFile;
+    options.Seed       = seed;
+
+    std::string report;
+    {
+        Application::Application application(options);
+        BOOST_CHECK_EQUAL(application.Run(), 0);
+        report = application.GetReport();
+    }
+    std::remove(ScriptFile.c_str());
+    return report.substr(report.find('\n') + 1);
+}
+
+BOOST_AUTO_TEST_CASE(ScriptRuns)
+{
+    std::string report = RunScript("# comment\n\ngo right 3 and fight left\nxyzzy\ninventory\n", 1);
+    BOOST_CHECK(report.find("ended by end of script") != std::string::npos);
+
+    report = RunScript("turn up\nquit\ngo down\n", 1);
+    BOOST_CHECK(report.find("ended by quit") != std::string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(ScriptRepeats)
+{
+    std::string commands;
+    const char* directions[] = { "up", "right", "down", "left" };
+    for (int i = 0; i < 400; i++)
+    {
+        commands += std::string("go ") + directions[i * 7 % 4] + " " + std::to_string(i % 5 + 1) + " and fight "
+                    + directions[i * 3 % 4] + "\n";
+    }
+    for (uint64_t seed = 0; seed < 5; seed++)
+    {
+        BOOST_CHECK_EQUAL(RunScript(commands, seed), RunScript(commands, seed));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(MissingScript)
+{
+    Application::Options options;
+    options.IsHeadless = true;
+    options.ScriptFile = "data/no-such-script.txt";
+    BOOST_CHECK_THROW(Application::Application application(options), InvalidArgumentException);
+}
+
+BOOST_AUTO_TEST_CASE(BattleReplays)
+{
+    static const std::string RecordFile = "data/test-battle.bin";
+    RNG::Seed(3);
+    Battle::RandomPlayerDecision decision;
+    Battle::BattleRecord record;
+    Entities::Player player("Test");
+    Entities::NPCCollection::Rat rat(2);
+    Battle::Battle battle(player, rat);
+    battle.SetPlayerDecision(&decision);
+    battle.SetRecord(&record);
+    battle.DoBattle();
+    BOOST_REQUIRE(record.SaveToFile(RecordFile));
+
+    Application::Options options;
+    options.BattleReplayFile = RecordFile;
+
+    std::string report;
+    int exitCode;
+    {
+        Application::Application application(options);
+        exitCode = application.Run();
+        report   = application.GetReport();
+    }
+    std::remove(RecordFile.c_str());
+
+    BOOST_CHECK_EQUAL(exitCode, 0);
+    BOOST_CHECK(report.find("Replayed battle of Test against Rat (level 2)") != std::string::npos);
+    BOOST_CHECK(report.find("diverged") == std::string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(MissingBattleRecord)
+{
+    Application::Options options;
+    options.BattleReplayFile = "data/no-such-battle.bin";
+    Application::Application application(options);
+    BOOST_CHECK_EQUAL(application.Run(), 1);
+    BOOST_CHECK(application.GetReport().find("Could not read battle record") != std::string::npos);
+}
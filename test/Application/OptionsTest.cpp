@@ -0,0 +1,115 @@
+#define BOOST_TEST_MODULE Application.Options
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+#include "Application/Options.h"
+#include "Misc/Exceptions.h"
+
+using UI::Animation::PresentationSpeed;
+
+BOOST_AUTO_TEST_CASE(Defaults)
+{
+    const char* argv[] = { "dun-geon" };
+    auto options       = Application::ParseOptions(1, argv);
+    BOOST_CHECK(options.Speed == PresentationSpeed::Normal);
+    BOOST_CHECK(!options.ShowUsage);
+    BOOST_CHECK(!options.IsLatencyTracked);
+}
+
+BOOST_AUTO_TEST_CASE(Speed)
+{
+    const char* separate[] = { "dun-geon", "--speed", "instant" };
+    BOOST_CHECK(Application::ParseOptions(3, separate).Speed == PresentationSpeed::Instant);
+
+    const char* joined[] = { "dun-geon", "--speed=fast" };
+    BOOST_CHECK(Application::ParseOptions(2, joined).Speed == PresentationSpeed::Fast);
+}
+
+BOOST_AUTO_TEST_CASE(Invalid)
+{
+    const char* missing[] = { "dun-geon", "--speed" };
+    BOOST_CHECK_THROW(Application::ParseOptions(2, missing), InvalidArgumentException);
+
+    const char* badValue[] = { "dun-geon", "--speed=ludicrous" };
+    BOOST_CHECK_THROW(Application::ParseOptions(2, badValue), InvalidArgumentException);
+
+    const char* unknown[] = { "dun-geon", "--turbo" };
+    BOOST_CHECK_THROW(Application::ParseOptions(2, unknown), InvalidArgumentException);
+}
+
+BOOST_AUTO_TEST_CASE(Session)
+{
+    const char* defaults[] = { "dun-geon" };
+    auto options           = Application::ParseOptions(1, defaults);
+    BOOST_CHECK_EQUAL(options.RecordFile, Application::SessionRecord::LastSessionFilename);
+    BOOST_CHECK(options.ReplayFile.empty());
+    BOOST_CHECK(!options.IsRealTime);
+
+    const char* replay[] = { "dun-geon", "--replay", "a.bin", "--realtime", "--record=b.bin" };
+    options              = Application::ParseOptions(5, replay);
+    BOOST_CHECK_EQUAL(options.ReplayFile, "a.bin");
+    BOOST_CHECK_EQUAL(options.RecordFile, "b.bin");
+    BOOST_CHECK(options.IsRealTime);
+
+    const char* realTimeOnly[] = { "dun-geon", "--realtime" };
+    BOOST_CHECK_THROW(Application::ParseOptions(2, realTimeOnly), InvalidArgumentException);
+
+    const char* emptyFile[] = { "dun-geon", "--replay=" };
+    BOOST_CHECK_THROW(Application::ParseOptions(2, emptyFile), InvalidArgumentException);
+}
+
+BOOST_AUTO_TEST_CASE(Headless)
+{
+    const char* script[] = { "dun-geon", "--script", "soak.txt", "--seed=0x2a" };
+    auto options         = Application::ParseOptions(4, script);
+    BOOST_CHECK(options.IsHeadless);
+    BOOST_CHECK_EQUAL(options.ScriptFile, "soak.txt");
+    BOOST_REQUIRE(options.Seed);
+    BOOST_CHECK_EQUAL(*options.Seed, 42);
+
+    const char* standardInput[] = { "dun-geon", "--headless" };
+    options                     = Application::ParseOptions(2, standardInput);
+    BOOST_CHECK(options.IsHeadless);
+    BOOST_CHECK(options.ScriptFile.empty());
+    BOOST_CHECK(!options.Seed);
+
+    const char* badSeed[] = { "dun-geon", "--seed", "12ab" };
+    BOOST_CHECK_THROW(Application::ParseOptions(3, badSeed), InvalidArgumentException);
+
+    const char* negativeSeed[] = { "dun-geon", "--seed=-1" };
+    BOOST_CHECK_THROW(Application::ParseOptions(2, negativeSeed), InvalidArgumentException);
+
+    const char* withReplay[] = { "dun-geon", "--headless", "--replay", "a.bin" };
+    BOOST_CHECK_THROW(Application::ParseOptions(4, withReplay), InvalidArgumentException);
+}
+
+BOOST_AUTO_TEST_CASE(ReplayBattle)
+{
+    const char* fullSpeed[] = { "dun-geon", "--replay-battle", "data/last-battle.bin" };
+    auto options            = Application::ParseOptions(3, fullSpeed);
+    BOOST_CHECK_EQUAL(options.BattleReplayFile, "data/last-battle.bin");
+    BOOST_CHECK(!options.IsRealTime);
+
+    const char* realTime[] = { "dun-geon", "--replay-battle=a.bin", "--realtime" };
+    BOOST_CHECK(Application::ParseOptions(3, realTime).IsRealTime);
+
+    const char* withReplay[] = { "dun-geon", "--replay-battle=a.bin", "--replay=b.bin" };
+    BOOST_CHECK_THROW(Application::ParseOptions(3, withReplay), InvalidArgumentException);
+
+    const char* withSeed[] = { "dun-geon", "--replay-battle=a.bin", "--seed=1" };
+    BOOST_CHECK_THROW(Application::ParseOptions(3, withSeed), InvalidArgumentException);
+
+    const char* withLatency[] = { "dun-geon", "--replay-battle=a.bin", "--latency" };
+    BOOST_CHECK_THROW(Application::ParseOptions(3, withLatency), InvalidArgumentException);
+}
+
+BOOST_AUTO_TEST_CASE(Latency)
+{
+    const char* interactive[] = { "dun-geon", "--latency", "--seed=7" };
+    BOOST_CHECK(Application::ParseOptions(3, interactive).IsLatencyTracked);
+
+    const char* script[] = { "dun-geon", "--latency", "--script", "soak.txt" };
+    BOOST_CHECK_THROW(Application::ParseOptions(4, script), InvalidArgumentException);
+
+    const char* replay[] = { "dun-geon", "--replay", "a.bin", "--latency" };
+    BOOST_CHECK_THROW(Application::ParseOptions(4, replay), InvalidArgumentException);
+}
@@ -0,0 +1,69 @@
+#define BOOST_TEST_MODULE Application.SessionRecord
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+#include "Application/SessionRecord.h"
+#include "Misc/Exceptions.h"
+#include <ncurses.h>
+
+using Application::SessionRecord;
+using Application::SessionReplayer;
+
+static SessionRecord MakeRecord()
+{
+    SessionRecord record(0x0123456789abcdefULL);
+    record.Append({ 0, false, 'w' });
+    record.Append({ 1500, true, KEY_UP });
+    record.Append({ 70000, false, -1 });
+    record.Append({ 3, false, '\n' });
+    return record;
+}
+
+BOOST_AUTO_TEST_CASE(RoundTrip)
+{
+    SessionRecord record = MakeRecord();
+    auto loaded          = SessionRecord::Deserialize(record.Serialize());
+    BOOST_REQUIRE(loaded);
+    BOOST_CHECK_EQUAL(loaded->GetSeed(), record.GetSeed());
+    BOOST_REQUIRE_EQUAL(loaded->GetKeys().size(), record.GetKeys().size());
+    for (size_t i = 0; i < record.GetKeys().size(); i++)
+    {
+        BOOST_CHECK_EQUAL(loaded->GetKeys()[i].DelayMs, record.GetKeys()[i].DelayMs);
+        BOOST_CHECK_EQUAL(loaded->GetKeys()[i].IsPoll, record.GetKeys()[i].IsPoll);
+        BOOST_CHECK_EQUAL(loaded->GetKeys()[i].Code, record.GetKeys()[i].Code);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TruncatedTail)
+{
+    auto data = MakeRecord().Serialize();
+    data.pop_back();
+    auto loaded = SessionRecord::Deserialize(data);
+    BOOST_REQUIRE(loaded);
+    BOOST_CHECK_EQUAL(loaded->GetKeys().size(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(BadHeader)
+{
+    auto data = MakeRecord().Serialize();
+    data[0]   = 'X';
+    BOOST_CHECK(!SessionRecord::Deserialize(data));
+    BOOST_CHECK(!SessionRecord::Deserialize({}));
+}
+
+BOOST_AUTO_TEST_CASE(ReplayOrder)
+{
+    SessionRecord record = MakeRecord();
+    SessionReplayer replayer(record, false);
+
+    // A poll only consumes recorded poll keys
+    BOOST_CHECK_EQUAL(*replayer.ReplayKey(true), ERR);
+    BOOST_CHECK_EQUAL(*replayer.ReplayKey(false), 'w');
+    BOOST_CHECK_EQUAL(*replayer.ReplayKey(true), KEY_UP);
+
+    // A blocking read skips polls the game no longer makes
+    record.Append({ 0, true, 'x' });
+    BOOST_CHECK_EQUAL(*replayer.ReplayKey(false), -1);
+    BOOST_CHECK_EQUAL(*replayer.ReplayKey(false), '\n');
+    BOOST_CHECK_EQUAL(replayer.GetPosition(), 4);
+    BOOST_CHECK_THROW(replayer.ReplayKey(false), ReplayFinishedException);
+}
@@ -0,0 +1,121 @@
+#define BOOST_TEST_MODULE Battle.AttackKernel
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+#include "Battle/AttackKernel.h"
+#include "Battle/SkillCollection.h"
+#include "Misc/Exceptions.h"
+#include "Misc/RNG.h"
+#include <memory>
+#include <random>
+#include <vector>
+
+using Battle::AttackKernel::InstructionSet;
+
+/**
+ * @brief Random profiles, including extreme level gaps and resistances beyond 100 %
+ */
+static std::vector<Battle::BattleProfile> RandomProfiles(size_t count, unsigned seed)
+{
+    std::mt19937 engine(seed);
+    std::uniform_int_distribution<int> level(1, 120), stat(0, 250), resistance(-100, 150);
+    std::vector<Battle::BattleProfile> profiles;
+    for (size_t i = 0; i < count; i++)
+    {
+        Battle::BattleProfile profile({ level(engine), 1, 1, 0, 0, stat(engine), stat(engine), stat(engine), 0 });
+        for (auto& value : profile.Resistances)
+            value = resistance(engine);
+        profiles.push_back(profile);
+    }
+    return profiles;
+}
+
+static Battle::ProfileBatch ToBatch(const std::vector<Battle::BattleProfile>& profiles)
+{
+    Battle::ProfileBatch batch;
+    batch.Resize(profiles.size());
+    for (size_t i = 0; i < profiles.size(); i++)
+        batch.Set(i, profiles[i]);
+    return batch;
+}
+
+static std::vector<InstructionSet> InstructionSets()
+{
+    std::vector<InstructionSet> sets { InstructionSet::Scalar };
+    if (Battle::AttackKernel::SupportedInstructionSet() >= InstructionSet::SSE41)
+        sets.push_back(InstructionSet::SSE41);
+    if (Battle::AttackKernel::SupportedInstructionSet() >= InstructionSet::AVX2)
+        sets.push_back(InstructionSet::AVX2);
+    return sets;
+}
+
+static std::vector<std::unique_ptr<Battle::AttackSkill>> Skills()
+{
+    std::vector<std::unique_ptr<Battle::AttackSkill>> skills;
+    skills.emplace_back(new Battle::SkillCollection::Swing());
+    skills.emplace_back(new Battle::SkillCollection::Wail());
+    skills.emplace_back(new Battle::SkillCollection::Nibble());
+    return skills;
+}
+
+BOOST_AUTO_TEST_CASE(ProjectionMatchesAttackSkill)
+{
+    // Odd size to exercise the scalar tail after the vector loop
+    auto users   = RandomProfiles(1027, 1);
+    auto targets = RandomProfiles(1027, 2);
+    auto userBatch   = ToBatch(users);
+    auto targetBatch = ToBatch(targets);
+
+    for (const auto& skill : Skills())
+    {
+        for (auto instructionSet : InstructionSets())
+        {
+            Battle::AttackKernel::BatchResult result;
+            Battle::AttackKernel::Project(*skill, userBatch, targetBatch, result, instructionSet);
+            for (size_t i = 0; i < users.size(); i++)
+            {
+                auto range = skill->CalculateEffectiveDamageRange(users[i], targets[i]);
+                BOOST_REQUIRE_EQUAL(result.HitChance[i], skill->CalculateHitChance(users[i], targets[i]));
+                BOOST_REQUIRE_EQUAL(result.CritChance[i], skill->CalculateCritChance(users[i], targets[i]));
+                BOOST_REQUIRE_EQUAL(result.MinDamage[i], range.first);
+                BOOST_REQUIRE_EQUAL(result.MaxDamage[i], range.second);
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(SamplingMatchesApplySkill)
+{
+    auto users   = RandomProfiles(515, 3);
+    auto targets = RandomProfiles(515, 4);
+    auto userBatch   = ToBatch(users);
+    auto targetBatch = ToBatch(targets);
+
+    for (const auto& skill : Skills())
+    {
+        for (auto instructionSet : InstructionSets())
+        {
+            Battle::AttackKernel::BatchResult result;
+            RNG::Seed(42);
+            Battle::AttackKernel::Resolve(*skill, userBatch, targetBatch, result, instructionSet);
+
+            RNG::Seed(42);
+            for (size_t i = 0; i < users.size(); i++)
+            {
+                auto target   = targets[i];
+                auto expected = std::get<Battle::AttackSkillResult>(skill->ApplySkill(users[i], target));
+                BOOST_REQUIRE_EQUAL(result.IsHit[i], expected.IsHit);
+                BOOST_REQUIRE_EQUAL(result.IsCrit[i], expected.IsCrit);
+                BOOST_REQUIRE_EQUAL(result.Damage[i], expected.Damage.GetValue());
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(RejectsMismatchedBatches)
+{
+    Battle::SkillCollection::Swing swing;
+    auto users   = ToBatch(RandomProfiles(4, 5));
+    auto targets = ToBatch(RandomProfiles(3, 6));
+    Battle::AttackKernel::BatchResult result;
+    BOOST_CHECK_THROW(Battle::AttackKernel::Project(swing, users, targets, result), InvalidArgumentException);
+}
@@ -0,0 +1,119 @@
+#define BOOST_TEST_MODULE Battle.BattleRecord
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+#include "Battle/Battle.h"
+#include "Battle/BattleRecord.h"
+#include "Battle/BattleReplayer.h"
+#include "Battle/RandomPlayerDecision.h"
+#include "Entities/NPC/NPCCollection.h"
+#include "Entities/Player.h"
+#include "Misc/Exceptions.h"
+#include "Misc/RNG.h"
+#include "Misc/Varint.h"
+#include <cstdio>
+
+BOOST_AUTO_TEST_CASE(VarintRoundTrip)
+{
+    const std::vector<int64_t> values { 0, 1, -1, 63, -64, 64, 300, -300, INT64_MAX, INT64_MIN };
+    std::vector<uint8_t> data;
+    for (auto value : values)
+        Varint::WriteSigned(data, value);
+    Varint::Write(data, UINT64_MAX);
+
+    Varint::Reader reader(data.data(), data.size());
+    for (auto value : values)
+        BOOST_CHECK_EQUAL(reader.ReadSigned(), value);
+    BOOST_CHECK_EQUAL(reader.Read(), UINT64_MAX);
+    BOOST_CHECK(reader.AtEnd());
+    BOOST_CHECK_THROW(reader.ReadByte(), InvalidArgumentException);
+
+    std::vector<uint8_t> small;
+    Varint::WriteSigned(small, -5);
+    BOOST_CHECK_EQUAL(small.size(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(ReplayReproducesBattle)
+{
+    Battle::RandomPlayerDecision decision;
+    for (unsigned seed = 1; seed <= 20; seed++)
+    {
+        RNG::Seed(seed);
+        Battle::BattleRecord record;
+        Entities::Player player("Test");
+        Entities::NPCCollection::Rat rat(3);
+        Battle::Battle battle(player, rat);
+        battle.SetPlayerDecision(&decision);
+        battle.SetRecord(&record);
+        auto result = battle.DoBattle();
+
+        // Replay with fresh combatants and a differently seeded generator
+        RNG::Seed(seed + 1000);
+        Entities::Player replayPlayer("Test");
+        Entities::NPCCollection::Rat replayRat(3);
+        Battle::BattleRecord replayRecord;
+        Battle::BattleReplayer replayer(record);
+        BOOST_CHECK(replayer.Replay(replayPlayer, replayRat, nullptr, &replayRecord) == result);
+        BOOST_CHECK(!replayer.HasDiverged());
+        BOOST_CHECK(replayRecord.GetEventBytes() == record.GetEventBytes());
+        BOOST_CHECK_EQUAL(replayPlayer.GetStats().Health, player.GetStats().Health);
+        BOOST_CHECK(RNG::GetTape() == nullptr);
+
+        auto events = record.Events();
+        BOOST_REQUIRE(!events.empty());
+        BOOST_CHECK(events.front().Type == Battle::BattleRecord::EventType::TurnStart);
+        BOOST_CHECK(events.back().Type == Battle::BattleRecord::EventType::Result);
+        BOOST_CHECK_EQUAL(events.back().Value, static_cast<int64_t>(result));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(ReplayRejectsOtherCombatants)
+{
+    Battle::RandomPlayerDecision decision;
+    Battle::BattleRecord record;
+    Entities::Player player("Test");
+    Entities::NPCCollection::Rat rat(3);
+    Battle::Battle battle(player, rat);
+    battle.SetPlayerDecision(&decision);
+    battle.SetRecord(&record);
+    battle.DoBattle();
+
+    Entities::Player replayPlayer("Test");
+    Entities::NPCCollection::Rat otherRat(7);
+    Battle::BattleReplayer replayer(record);
+    BOOST_CHECK_THROW(replayer.Replay(replayPlayer, otherRat), InvalidArgumentException);
+}
+
+BOOST_AUTO_TEST_CASE(SerializeRoundTrip)
+{
+    RNG::Seed(7);
+    Battle::RandomPlayerDecision decision;
+    Battle::BattleRecord record;
+    Entities::Player player("Test");
+    Entities::NPCCollection::Rat rat(2);
+    Battle::Battle battle(player, rat);
+    battle.SetPlayerDecision(&decision);
+    battle.SetRecord(&record);
+    battle.DoBattle();
+
+    auto data    = record.Serialize();
+    auto decoded = Battle::BattleRecord::Deserialize(data);
+    BOOST_REQUIRE(decoded.has_value());
+    BOOST_CHECK(decoded->GetEventBytes() == record.GetEventBytes());
+    BOOST_CHECK_EQUAL(decoded->GetEnemy().Name, "Rat");
+    BOOST_CHECK_EQUAL(decoded->GetEnemy().Stats.Level, 2);
+    BOOST_CHECK_EQUAL(decoded->GetPlayer().Name, "Test");
+    BOOST_CHECK_EQUAL(decoded->GetPlayer().Stats.MaxHealth, record.GetPlayer().Stats.MaxHealth);
+    BOOST_CHECK(decoded->GetPlayer().Skills == std::vector<std::string>({ "Swing", "Brace" }));
+
+    const std::string filename = "test_battle_record.bin";
+    BOOST_REQUIRE(record.SaveToFile(filename));
+    auto loaded = Battle::BattleRecord::LoadFromFile(filename);
+    std::remove(filename.c_str());
+    BOOST_REQUIRE(loaded.has_value());
+    BOOST_CHECK(loaded->Serialize() == data);
+
+    BOOST_CHECK(!Battle::BattleRecord::Deserialize({ 1, 2, 3 }).has_value());
+    data.pop_back();
+    BOOST_CHECK(!Battle::BattleRecord::Deserialize(data).has_value());
+    BOOST_CHECK(!Battle::BattleRecord::LoadFromFile("nonexistent.bin").has_value());
+}
@@ -0,0 +1,228 @@
+#define BOOST_TEST_MODULE Battle.Battle
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+#include "Battle/Battle.h"
+#include "Battle/BattleObserver.h"
+#include "Battle/RandomPlayerDecision.h"
+#include "Battle/SkillCollection.h"
+#include "Entities/NPC/NPCCollection.h"
+#include "Entities/Player.h"
+#include "Misc/Exceptions.h"
+#include "Misc/RNG.h"
+#include <map>
+
+struct CountingObserver : public Battle::BattleObserver
+{
+    void OnSkillChosen(const Battle::Skill& skill, size_t user) override
+    {
+        Chosen++;
+        ChosenBy[user]++;
+        LastUser = user;
+    }
+    void OnSkillApplied(const Battle::Skill& skill,
+                        const Battle::SkillResult& result,
+                        size_t user,
+                        size_t target) override
+    {
+        Applied++;
+        Misattributed += user != LastUser;
+        if (Observed && target != user)
+            Misattributed += Observed->GetCombatant(target).IsPlayerSide == Observed->GetCombatant(user).IsPlayerSide;
+    }
+    void OnBattleEnd(Battle::Battle::Result result) override
+    {
+        Ended++;
+        LastResult = result;
+    }
+
+    int Chosen                     = 0;
+    int Applied                    = 0;
+    int Ended                      = 0;
+    int Misattributed              = 0;
+    size_t LastUser                = 0;
+    const Battle::Battle* Observed = nullptr;
+    std::map<size_t, int> ChosenBy;
+    Battle::Battle::Result LastResult = Battle::Battle::Result::Ongoing;
+};
+
+struct EscapeDecision : public Battle::PlayerDecision
+{
+    Battle::Skill* ChooseSkill(const Battle::Battle& battle) override { return nullptr; }
+};
+
+struct NamedSkillDecision : public Battle::PlayerDecision
+{
+    explicit NamedSkillDecision(const std::string& name) : Name(name) {}
+    Battle::Skill* ChooseSkill(const Battle::Battle& battle) override
+    {
+        for (const auto& skill : battle.GetPlayer().GetSkills())
+        {
+            if (skill->GetName() == Name)
+                return skill.get();
+        }
+        return nullptr;
+    }
+
+    std::string Name;
+};
+
+BOOST_AUTO_TEST_CASE(RequiresPlayerDecision)
+{
+    Entities::Player player("Test");
+    Entities::NPCCollection::Rat rat(1);
+    Battle::Battle battle(player, rat);
+    BOOST_CHECK_THROW(battle.DoBattle(), CustomException);
+}
+
+BOOST_AUTO_TEST_CASE(Escape)
+{
+    Entities::Player player("Test");
+    Entities::NPCCollection::Rat rat(1);
+    EscapeDecision decision;
+    CountingObserver observer;
+    Battle::Battle battle(player, rat);
+    battle.SetPlayerDecision(&decision);
+    battle.SetObserver(&observer);
+
+    BOOST_CHECK(battle.DoBattle() == Battle::Battle::Result::Escape);
+    BOOST_CHECK_EQUAL(observer.Chosen, 0);
+    BOOST_CHECK_EQUAL(observer.Ended, 1);
+}
+
+BOOST_AUTO_TEST_CASE(HeadlessBattlesFinish)
+{
+    Battle::RandomPlayerDecision decision;
+    for (int i = 0; i < 200; i++)
+    {
+        Entities::Player player("Test");
+        Entities::NPCCollection::Rat rat(1);
+        CountingObserver observer;
+        Battle::Battle battle(player, rat);
+        battle.SetPlayerDecision(&decision);
+        battle.SetObserver(&observer);
+
+        auto result = battle.DoBattle();
+        BOOST_REQUIRE(result == Battle::Battle::Result::Victory || result == Battle::Battle::Result::GameOver);
+        BOOST_CHECK(observer.LastResult == result);
+        BOOST_CHECK_EQUAL(observer.Ended, 1);
+        BOOST_CHECK_EQUAL(observer.Chosen, observer.Applied);
+        BOOST_CHECK_EQUAL(player.GetStats().Health, battle.GetPlayerProfile().Stats.Health);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(RequiresEnemies)
+{
+    Entities::Player player("Test");
+    BOOST_CHECK_THROW(Battle::Battle(player, std::vector<Entities::Character*> {}), InvalidArgumentException);
+}
+
+BOOST_AUTO_TEST_CASE(GroupBattlesFinish)
+{
+    Battle::RandomPlayerDecision decision;
+    for (int i = 0; i < 50; i++)
+    {
+        Entities::Player player("Test");
+        player.SetLevel(10);
+        Entities::NPCCollection::Rat rat1(1), rat2(1), rat3(1);
+        Entities::NPCCollection::FadingSpirit ally(10);
+        CountingObserver observer;
+        Battle::Battle battle(player, { &rat1, &rat2, &rat3 }, { &ally });
+        battle.SetPlayerDecision(&decision);
+        battle.SetObserver(&observer);
+        observer.Observed = &battle;
+        BOOST_REQUIRE_EQUAL(battle.GetCombatantCount(), 5);
+        BOOST_CHECK(&battle.GetEnemy() == &rat1);
+
+        auto result = battle.DoBattle();
+        BOOST_REQUIRE(result == Battle::Battle::Result::Victory || result == Battle::Battle::Result::GameOver);
+        BOOST_CHECK_EQUAL(observer.Chosen, observer.Applied);
+        BOOST_CHECK_EQUAL(observer.Misattributed, 0);
+        BOOST_CHECK_GT(observer.ChosenBy[1], 0);
+        for (size_t index = 2; index < battle.GetCombatantCount() && result == Battle::Battle::Result::Victory;
+             index++)
+        {
+            BOOST_CHECK(battle.GetCombatant(index).IsDefeated);
+            BOOST_CHECK(battle.GetCombatant(index).Profile.Stats.Health <= 0);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(CheaperSkillsEarnMoreTurns)
+{
+    auto turnsPerEnemyTurn = [](const std::string& skillName) {
+        RNG::Seed(1);
+        Entities::Player player("Test");
+        player.SetLevel(5);
+        Entities::NPCCollection::Rat rat(5);
+        NamedSkillDecision decision(skillName);
+        CountingObserver observer;
+        Battle::Battle battle(player, rat);
+        battle.SetPlayerDecision(&decision);
+        battle.SetObserver(&observer);
+        battle.DoBattle();
+        BOOST_REQUIRE_GT(observer.ChosenBy[1], 0);
+        return static_cast<double>(observer.ChosenBy[Battle::Battle::PlayerIndex]) / observer.ChosenBy[1];
+    };
+
+    BOOST_REQUIRE_LT(Battle::SkillCollection::Brace().GetActionCost(), Battle::SkillCollection::Swing().GetActionCost());
+    double swinging = turnsPerEnemyTurn("Swing");
+    double bracing  = turnsPerEnemyTurn("Brace");
+    BOOST_CHECK_GT(bracing, swinging * 1.5);
+}
+
+BOOST_AUTO_TEST_CASE(SuggestsWeakestTarget)
+{
+    Entities::Player player("Test");
+    Entities::NPCCollection::Rat strong(5), weak(1), alsoWeak(1);
+    Battle::Battle battle(player, { &strong, &weak, &alsoWeak });
+    BOOST_CHECK_EQUAL(battle.SuggestTarget(true), 2);
+    BOOST_CHECK_EQUAL(battle.SuggestTarget(false), Battle::Battle::PlayerIndex);
+}
+
+BOOST_AUTO_TEST_CASE(SeededBattlesRepeat)
+{
+    auto runBattle = [](unsigned int seed) {
+        RNG::Seed(seed);
+        Entities::Player player("Test");
+        player.SetLevel(5);
+        Entities::NPCCollection::FadingSpirit spirit(5);
+        Battle::RandomPlayerDecision decision;
+        Battle::Battle battle(player, spirit);
+        battle.SetPlayerDecision(&decision);
+        auto result = battle.DoBattle();
+        return std::make_pair(result, player.GetStats().Health);
+    };
+
+    for (unsigned int seed = 0; seed < 20; seed++)
+    {
+        BOOST_CHECK(runBattle(seed) == runBattle(seed));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(PlayerSetLevel)
+{
+    Entities::Player player("Test");
+    player.SetLevel(42);
+    BOOST_CHECK_EQUAL(player.GetStats().Level, 42);
+    BOOST_CHECK_EQUAL(player.GetStats().Health, player.CalculateBaseStatsForLevel(42).MaxHealth);
+    BOOST_CHECK_EQUAL(player.GetXP(), 0);
+    BOOST_CHECK_THROW(player.SetLevel(0), InvalidArgumentException);
+    BOOST_CHECK_THROW(player.SetLevel(Entities::LevelCap + 1), InvalidArgumentException);
+}
+
+BOOST_AUTO_TEST_CASE(ReappliedEffectRefreshes)
+{
+    Entities::Stats stats { 1, 30, 30, 10, 10, 19, 14, 7, 10 };
+    Battle::BattleProfile profile(stats);
+    Battle::SkillCollection::Brace brace;
+    int physical = Battle::DamageType::Physical.ToInt();
+
+    brace.ApplySkill(profile, profile);
+    brace.ApplySkill(profile, profile);
+    BOOST_CHECK_EQUAL(profile.ActiveEffects.Size(), 1);
+    BOOST_CHECK_EQUAL(profile.Resistances[physical], 50);
+
+    profile.UpdateActiveEffects();
+    BOOST_CHECK(profile.ActiveEffects.Empty());
+    BOOST_CHECK_EQUAL(profile.Resistances[physical], 0);
+}
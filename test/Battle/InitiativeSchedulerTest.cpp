@@ -0,0 +1,72 @@
+#define BOOST_TEST_MODULE Battle.InitiativeScheduler
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+#include "Battle/InitiativeScheduler.h"
+#include "Misc/Exceptions.h"
+#include <vector>
+
+using Battle::InitiativeScheduler;
+
+BOOST_AUTO_TEST_CASE(TiesKeepScheduleOrder)
+{
+    InitiativeScheduler scheduler;
+    for (size_t combatant = 0; combatant < 5; combatant++)
+    {
+        scheduler.Schedule(combatant, 0);
+    }
+
+    for (size_t combatant = 0; combatant < 5; combatant++)
+    {
+        BOOST_CHECK_EQUAL(scheduler.Next(), combatant);
+    }
+    BOOST_CHECK(scheduler.Empty());
+    BOOST_CHECK_THROW(scheduler.Next(), CustomException);
+}
+
+BOOST_AUTO_TEST_CASE(FasterActsMoreOften)
+{
+    std::vector<int> initiatives { InitiativeScheduler::BaseInitiative, 2 * InitiativeScheduler::BaseInitiative };
+    std::vector<int> turns(initiatives.size());
+
+    InitiativeScheduler scheduler;
+    for (size_t combatant = 0; combatant < initiatives.size(); combatant++)
+    {
+        scheduler.Schedule(combatant, 0);
+    }
+    for (int i = 0; i < 300; i++)
+    {
+        size_t combatant = scheduler.Next();
+        turns[combatant]++;
+        scheduler.Schedule(combatant, InitiativeScheduler::Delay(100, initiatives[combatant]));
+    }
+
+    BOOST_CHECK_EQUAL(turns[0], 100);
+    BOOST_CHECK_EQUAL(turns[1], 200);
+}
+
+BOOST_AUTO_TEST_CASE(DroppedTurnsLeaveTheQueue)
+{
+    InitiativeScheduler scheduler;
+    scheduler.Schedule(0, 10);
+    scheduler.Schedule(1, 20);
+    scheduler.Schedule(2, 30);
+
+    // Combatant 0 is taken out and not queued again
+    BOOST_CHECK_EQUAL(scheduler.Next(), 0);
+    BOOST_CHECK_EQUAL(scheduler.Next(), 1);
+    BOOST_CHECK_EQUAL(scheduler.Now(), 20);
+    scheduler.Schedule(1, 5);
+    BOOST_CHECK_EQUAL(scheduler.Next(), 1);
+    BOOST_CHECK_EQUAL(scheduler.Now(), 25);
+    BOOST_CHECK_EQUAL(scheduler.Next(), 2);
+    BOOST_CHECK(scheduler.Empty());
+}
+
+BOOST_AUTO_TEST_CASE(InitiativeGrowsWithDexterity)
+{
+    Entities::Stats slow { 1, 10, 10, 0, 0, 10, 5, 0, 0 };
+    Entities::Stats fast { 1, 10, 10, 0, 0, 10, 25, 0, 0 };
+    BOOST_CHECK_LT(InitiativeScheduler::Initiative(slow), InitiativeScheduler::Initiative(fast));
+    BOOST_CHECK_GT(InitiativeScheduler::Delay(100, InitiativeScheduler::Initiative(slow)),
+                   InitiativeScheduler::Delay(100, InitiativeScheduler::Initiative(fast)));
+}
@@ -0,0 +1,69 @@
+#define BOOST_TEST_MODULE Battle.OutcomeCache
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+#include "Battle/BattleProfile.h"
+#include "Battle/OutcomeCache.h"
+#include "Battle/SkillCollection.h"
+
+BOOST_AUTO_TEST_CASE(RepeatedLookupHits)
+{
+    Entities::Stats stats { 1, 30, 30, 10, 10, 19, 14, 7, 10 };
+    Battle::SkillCollection::Swing swing;
+    Battle::BattleProfile user(stats);
+    Battle::BattleProfile target(stats);
+    Battle::OutcomeCache cache;
+
+    auto first = cache.Get(swing, user, target);
+    BOOST_CHECK_EQUAL(cache.GetMissCount(), 1);
+    BOOST_CHECK_EQUAL(cache.GetHitCount(), 0);
+
+    // Current health is not part of the key
+    target.Stats.Health = 5;
+    auto second = cache.Get(swing, user, target);
+    BOOST_CHECK_EQUAL(cache.GetMissCount(), 1);
+    BOOST_CHECK_EQUAL(cache.GetHitCount(), 1);
+    BOOST_CHECK_EQUAL(second.GetExpectedDamage(), first.GetExpectedDamage());
+}
+
+BOOST_AUTO_TEST_CASE(KeyedOnSkillAndStats)
+{
+    Entities::Stats stats { 1, 30, 30, 10, 10, 19, 14, 7, 10 };
+    Battle::SkillCollection::Swing swing;
+    Battle::SkillCollection::Nibble nibble;
+    Battle::BattleProfile user(stats);
+    Battle::BattleProfile target(stats);
+    Battle::OutcomeCache cache;
+
+    cache.Get(swing, user, target);
+    auto nibbleOutcome = cache.Get(nibble, user, target);
+    BOOST_CHECK_EQUAL(cache.GetMissCount(), 2);
+    BOOST_CHECK_EQUAL(nibbleOutcome.GetMaxDamage(),
+                      nibble.CalculateOutcomeDistribution(user, target).GetMaxDamage());
+
+    target.Stats.Dexterity += 70;
+    auto evaded = cache.Get(swing, user, target);
+    BOOST_CHECK_EQUAL(cache.GetMissCount(), 3);
+    BOOST_CHECK_EQUAL(evaded.GetHitChance(), swing.CalculateHitChance(user, target));
+}
+
+BOOST_AUTO_TEST_CASE(ClearedWhenFull)
+{
+    Entities::Stats stats { 1, 30, 30, 10, 10, 19, 14, 7, 10 };
+    Battle::SkillCollection::Swing swing;
+    Battle::BattleProfile user(stats);
+    Battle::BattleProfile target(stats);
+    Battle::OutcomeCache cache;
+
+    auto first = cache.Get(swing, user, target);
+    for (size_t i = 1; i <= Battle::OutcomeCache::Capacity; i++)
+    {
+        target.Stats.Wisdom = stats.Wisdom + static_cast<int>(i);
+        cache.Get(swing, user, target);
+    }
+
+    // The first entry went with the clear, while the copy held by the caller stays valid
+    target.Stats.Wisdom = stats.Wisdom;
+    auto again = cache.Get(swing, user, target);
+    BOOST_CHECK_EQUAL(cache.GetHitCount(), 0);
+    BOOST_CHECK_EQUAL(again.GetExpectedDamage(), first.GetExpectedDamage());
+}
\ No newline at end of file
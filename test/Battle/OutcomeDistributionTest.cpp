@@ -0,0 +1,77 @@
+#define BOOST_TEST_MODULE Battle.OutcomeDistribution
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+#include "Battle/BattleProfile.h"
+#include "Battle/OutcomeDistribution.h"
+#include "Battle/SkillCollection.h"
+#include "Misc/RNG.h"
+#include <map>
+
+BOOST_AUTO_TEST_CASE(ExactDistribution)
+{
+    // 50 % hit, no crits, base damage 2-4, no resistance
+    Battle::OutcomeDistribution plain(50, 0, { 2, 4 }, 0);
+    BOOST_CHECK_CLOSE(plain.Probability(0), 0.5, 1e-9);
+    BOOST_CHECK_EQUAL(plain.Probability(1), 0);
+    BOOST_CHECK_CLOSE(plain.Probability(3), 1. / 6, 1e-9);
+    BOOST_CHECK_CLOSE(plain.GetExpectedDamage(), 1.5, 1e-9);
+    BOOST_CHECK_CLOSE(plain.KillProbability(4), 1. / 6, 1e-9);
+    BOOST_CHECK_EQUAL(plain.KillProbability(5), 0);
+    BOOST_CHECK_EQUAL(plain.KillProbability(-3), 1);
+
+    // Always hit and crit with 50 % resistance: 10 -> 14 -> 7, 11 -> 15 -> 7
+    Battle::OutcomeDistribution crit(100, 100, { 10, 11 }, 50);
+    BOOST_CHECK_EQUAL(crit.GetMinDamage(), 7);
+    BOOST_CHECK_EQUAL(crit.GetMaxDamage(), 7);
+    BOOST_CHECK_CLOSE(crit.Probability(7), 1., 1e-9);
+}
+
+BOOST_AUTO_TEST_CASE(MatchesBruteForce)
+{
+    Entities::Stats userStats { 5, 40, 40, 10, 10, 25, 16, 12, 10 };
+    Entities::Stats targetStats { 3, 60, 60, 0, 0, 6, 20, 0, 0 };
+    Battle::SkillCollection::Swing swing;
+    Battle::BattleProfile user(userStats);
+
+    for (int resistance : { 0, 50 })
+    {
+        Battle::BattleProfile target(targetStats);
+        target.Resistances[swing.GetDamageType().ToInt()] = resistance;
+        const auto& outcome = swing.CalculateOutcomeDistribution(user, target);
+
+        // Sample the actual skill application
+        constexpr int samples = 200000;
+        std::map<int, int> counts;
+        RNG::Seed(resistance);
+        for (int i = 0; i < samples; i++)
+        {
+            target.Stats.Health = targetStats.Health;
+            swing.ApplySkill(user, target);
+            counts[targetStats.Health - target.Stats.Health]++;
+        }
+
+        double total = 0;
+        for (int damage = outcome.GetMinDamage(); damage <= outcome.GetMaxDamage(); damage++)
+        {
+            BOOST_CHECK_SMALL(static_cast<double>(counts[damage]) / samples - outcome.Probability(damage), 0.005);
+            total += outcome.Probability(damage);
+        }
+        BOOST_CHECK_CLOSE(total, 1., 1e-9);
+        BOOST_CHECK_EQUAL(counts.begin()->first, outcome.GetMinDamage());
+        BOOST_CHECK_EQUAL(counts.rbegin()->first, outcome.GetMaxDamage());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(FollowsStats)
+{
+    Entities::Stats stats { 1, 30, 30, 10, 10, 19, 14, 7, 10 };
+    Battle::SkillCollection::Swing swing;
+    Battle::BattleProfile user(stats);
+    Battle::BattleProfile target(stats);
+
+    auto first = swing.CalculateOutcomeDistribution(user, target);
+    target.Stats.Dexterity += 70;
+    auto second = swing.CalculateOutcomeDistribution(user, target);
+    BOOST_CHECK_LT(second.GetHitChance(), first.GetHitChance());
+    BOOST_CHECK_EQUAL(first.GetHitChance(), swing.CalculateHitChance(user, Battle::BattleProfile(stats)));
+}
@@ -0,0 +1,137 @@
+#define BOOST_TEST_MODULE Entities.BattleBehavior
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+#include "Battle/Battle.h"
+#include "Battle/BattleObserver.h"
+#include "Battle/RandomPlayerDecision.h"
+#include "Battle/SkillCollection.h"
+#include "Entities/NPC/Behavior/ExpectedValueBattleBehavior.h"
+#include "Entities/NPC/NPCCollection.h"
+#include "Entities/Player.h"
+#include <memory>
+
+/**
+ * @brief Character with a physical attack, a magic attack and Brace
+ */
+class Duelist : public Entities::Character
+{
+public:
+    Duelist() : Character("Duelist")
+    {
+        m_Stats          = CalculateBaseStatsForLevel(1);
+        m_BattleBehavior = std::make_unique<Entities::NPC::Behavior::ExpectedValueBattleBehavior>();
+        GrantSkill<Battle::SkillCollection::Swing>();
+        GrantSkill<Battle::SkillCollection::Wail>();
+        GrantSkill<Battle::SkillCollection::Brace>();
+    }
+
+    Entities::Stats CalculateBaseStatsForLevel(int level) const override
+    {
+        return { level, 100, 100, 0, 0, 40, 10, 30, 0 };
+    }
+};
+
+static Battle::BattleProfile WithHealth(Battle::BattleProfile profile, int health)
+{
+    profile.Stats.Health = profile.Stats.MaxHealth = health;
+    return profile;
+}
+
+BOOST_AUTO_TEST_CASE(PrefersStrongestAttack)
+{
+    Duelist duelist;
+    Entities::Player player("Test");
+    Battle::BattleProfile duelistProfile(duelist.GetStats());
+    Battle::BattleProfile playerProfile = WithHealth(Battle::BattleProfile(player.GetStats()), 100);
+
+    const auto& skill = duelist.ChooseBattleSkill(duelistProfile, player, playerProfile);
+    BOOST_CHECK_EQUAL(skill.GetName(), "Swing");
+}
+
+BOOST_AUTO_TEST_CASE(AvoidsAttackingIntoBrace)
+{
+    Duelist duelist;
+    Entities::Player player("Test");
+    Battle::BattleProfile duelistProfile(duelist.GetStats());
+    Battle::BattleProfile playerProfile = WithHealth(Battle::BattleProfile(player.GetStats()), 100);
+    playerProfile.ApplyEffect(Battle::EffectCollection::Brace(playerProfile, 1));
+
+    const auto& skill = duelist.ChooseBattleSkill(duelistProfile, player, playerProfile);
+    BOOST_CHECK_EQUAL(skill.GetName(), "Wail");
+}
+
+BOOST_AUTO_TEST_CASE(BracesAgainstStrongAttacker)
+{
+    Duelist duelist;
+    Entities::Player player("Test");
+    Battle::BattleProfile duelistProfile(duelist.GetStats());
+    duelistProfile.Stats.Strength = duelistProfile.Stats.Sorcery = 0;
+    Battle::BattleProfile playerProfile = WithHealth(Battle::BattleProfile(player.GetStats()), 100);
+    playerProfile.Stats.Strength        = 100;
+
+    BOOST_CHECK_EQUAL(duelist.ChooseBattleSkill(duelistProfile, player, playerProfile).GetName(), "Brace");
+    // Cached choice for the same state
+    BOOST_CHECK_EQUAL(duelist.ChooseBattleSkill(duelistProfile, player, playerProfile).GetName(), "Brace");
+
+    // Bracing again while braced is worth nothing
+    duelistProfile.ApplyEffect(Battle::EffectCollection::Brace(duelistProfile, 1));
+    BOOST_CHECK_NE(duelist.ChooseBattleSkill(duelistProfile, player, playerProfile).GetName(), "Brace");
+}
+
+BOOST_AUTO_TEST_CASE(GoesForTheKill)
+{
+    Duelist duelist;
+    Entities::Player player("Test");
+    Battle::BattleProfile duelistProfile(duelist.GetStats());
+    duelistProfile.Stats.Strength = duelistProfile.Stats.Sorcery = 0;
+    Battle::BattleProfile playerProfile = WithHealth(Battle::BattleProfile(player.GetStats()), 100);
+    playerProfile.Stats.Strength        = 100;
+
+    // An almost dead target is not worth bracing against
+    BOOST_CHECK_EQUAL(duelist.ChooseBattleSkill(duelistProfile, player, playerProfile).GetName(), "Brace");
+    playerProfile.Stats.Health = 2;
+    BOOST_CHECK_NE(duelist.ChooseBattleSkill(duelistProfile, player, playerProfile).GetName(), "Brace");
+}
+
+BOOST_AUTO_TEST_CASE(FadingSpiritWeighsWailAgainstBrace)
+{
+    Entities::NPCCollection::FadingSpirit spirit(3);
+    Entities::Player player("Test");
+    Battle::BattleProfile spiritProfile(spirit.GetStats());
+    Battle::BattleProfile playerProfile = WithHealth(Battle::BattleProfile(player.GetStats()), 100);
+
+    playerProfile.Stats.Strength = 0;
+    BOOST_CHECK_EQUAL(spirit.ChooseBattleSkill(spiritProfile, player, playerProfile).GetName(), "Wail");
+
+    // A blow which would take most of its health is worth bracing against
+    playerProfile.Stats.Strength = 100;
+    BOOST_CHECK_EQUAL(spirit.ChooseBattleSkill(spiritProfile, player, playerProfile).GetName(), "Brace");
+}
+
+BOOST_AUTO_TEST_CASE(BattlesUseBehavior)
+{
+    struct EnemySkillCounter : public Battle::BattleObserver
+    {
+        void OnSkillChosen(const Battle::Skill& skill, size_t user) override
+        {
+            if (user != Battle::Battle::PlayerIndex)
+            {
+                Turns++;
+                Known += skill.GetName() == "Wail" || skill.GetName() == "Brace";
+            }
+        }
+        int Turns = 0;
+        int Known = 0;
+    };
+
+    Battle::RandomPlayerDecision decision;
+    Entities::Player player("Test");
+    Entities::NPCCollection::FadingSpirit spirit(3);
+    EnemySkillCounter observer;
+    Battle::Battle battle(player, spirit);
+    battle.SetPlayerDecision(&decision);
+    battle.SetObserver(&observer);
+    battle.DoBattle();
+    BOOST_CHECK_GT(observer.Turns, 0);
+    BOOST_CHECK_EQUAL(observer.Known, observer.Turns);
+}
@@ -0,0 +1,62 @@
+#define BOOST_TEST_MODULE Entities.Character
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+#include "Battle/SkillCollection.h"
+#include "Entities/Character.h"
+
+using Category = Battle::Skill::Category;
+
+/**
+ * @brief Character granted skills of several categories, interleaved
+ */
+class Adept : public Entities::Character
+{
+public:
+    Adept() : Character("Adept")
+    {
+        GrantSkill<Battle::SkillCollection::Swing>();
+        GrantSkill<Battle::SkillCollection::Wail>();
+        GrantSkill<Battle::SkillCollection::Brace>();
+        GrantSkill<Battle::SkillCollection::Nibble>();
+    }
+
+    Entities::Stats CalculateBaseStatsForLevel(int level) const override { return { level, 1, 1, 1, 1, 1, 1, 1, 1 }; }
+};
+
+BOOST_AUTO_TEST_CASE(SkillCategoryMask)
+{
+    Adept adept;
+    BOOST_TEST(adept.HasSkillCategory(Category::Melee));
+    BOOST_TEST(adept.HasSkillCategory(Category::Spell));
+    BOOST_TEST(adept.HasSkillCategory(Category::Special));
+    BOOST_TEST(!adept.HasSkillCategory(Category::Ranged));
+    BOOST_TEST(!adept.HasSkillCategory(Category::Passive));
+    BOOST_TEST(adept.GetSkillCategoryMask() == (1u << 1 | 1u << 3 | 1u << 4));
+}
+
+BOOST_AUTO_TEST_CASE(SkillsOfCategoryKeepGrantOrder)
+{
+    Adept adept;
+    auto melee = adept.GetSkillsOfCategory(Category::Melee);
+    BOOST_TEST_REQUIRE(melee.Size() == 2);
+    BOOST_TEST(melee[0].GetName() == "Swing");
+    BOOST_TEST(melee[1].GetName() == "Nibble");
+
+    auto spells = adept.GetSkillsOfCategory(Category::Spell);
+    BOOST_TEST_REQUIRE(spells.Size() == 1);
+    BOOST_TEST(spells[0].GetName() == "Wail");
+
+    BOOST_TEST(adept.GetSkillsOfCategory(Category::Special).Size() == 1);
+    BOOST_TEST(adept.GetSkillsOfCategory(Category::Ranged).Size() == 0);
+
+    size_t total = 0;
+    for (int category = 0; category < Battle::Skill::CategoryCount; category++)
+    {
+        for (const auto* skill : adept.GetSkillsOfCategory(static_cast<Category>(category)))
+        {
+            BOOST_TEST(static_cast<int>(skill->GetCategory()) == category);
+            total++;
+        }
+    }
+    BOOST_TEST(total == adept.GetSkills().size());
+}
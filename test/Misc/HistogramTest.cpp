@@ -0,0 +1,54 @@
+#define BOOST_TEST_MODULE Misc.Histogram
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+#include "Misc/Histogram.h"
+#include <cstdint>
+
+BOOST_AUTO_TEST_CASE(Empty)
+{
+    Histogram hist;
+    BOOST_CHECK_EQUAL(hist.Count(), 0);
+    BOOST_CHECK_EQUAL(hist.Min(), 0);
+    BOOST_CHECK_EQUAL(hist.Max(), 0);
+    BOOST_CHECK_EQUAL(hist.Percentile(0.5), 0);
+}
+
+BOOST_AUTO_TEST_CASE(SmallValuesAreExact)
+{
+    Histogram hist;
+    for (uint64_t i = 1; i <= 10; i++)
+        hist.Record(i);
+
+    BOOST_CHECK_EQUAL(hist.Count(), 10);
+    BOOST_CHECK_EQUAL(hist.Sum(), 55);
+    BOOST_CHECK_EQUAL(hist.Min(), 1);
+    BOOST_CHECK_EQUAL(hist.Max(), 10);
+    BOOST_CHECK_EQUAL(hist.Percentile(0.5), 5);
+    BOOST_CHECK_EQUAL(hist.Percentile(1.0), 10);
+}
+
+BOOST_AUTO_TEST_CASE(LargeValuesWithinPrecision)
+{
+    Histogram hist;
+    for (uint64_t i = 1; i <= 100000; i++)
+        hist.Record(i * 1000);
+
+    // Every bucket spans at most 1/16 of its lower bound
+    uint64_t p50 = hist.Percentile(0.5);
+    uint64_t p99 = hist.Percentile(0.99);
+    BOOST_CHECK_GE(p50, 50000000);
+    BOOST_CHECK_LE(p50, 50000000 + 50000000 / 16);
+    BOOST_CHECK_GE(p99, 99000000);
+    BOOST_CHECK_LE(p99, hist.Max());
+    BOOST_CHECK_EQUAL(hist.Max(), 100000000);
+}
+
+BOOST_AUTO_TEST_CASE(Reset)
+{
+    Histogram hist;
+    hist.Record(UINT64_MAX);
+    BOOST_CHECK_EQUAL(hist.Percentile(0.99), UINT64_MAX);
+    hist.Reset();
+    BOOST_CHECK_EQUAL(hist.Count(), 0);
+    BOOST_CHECK_EQUAL(hist.Max(), 0);
+}
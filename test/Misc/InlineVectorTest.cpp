@@ -0,0 +1,68 @@
+#define BOOST_TEST_MODULE Misc.InlineVector
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+#include "Misc/InlineVector.h"
+#include <memory>
+#include <string>
+#include <type_traits>
+
+BOOST_AUTO_TEST_CASE(EmplaceUpToCapacity)
+{
+    InlineVector<std::string, 3> vector;
+    BOOST_CHECK(vector.Empty());
+    vector.EmplaceBack("a");
+    vector.EmplaceBack(2, 'b');
+    vector.EmplaceBack("c");
+    BOOST_CHECK_EQUAL(vector.Size(), 3);
+    BOOST_CHECK_EQUAL(vector[1], "bb");
+    BOOST_CHECK_THROW(vector.EmplaceBack("d"), CustomException);
+}
+
+BOOST_AUTO_TEST_CASE(RemoveIfKeepsOrder)
+{
+    InlineVector<int, 8> vector;
+    for (int i = 0; i < 8; i++)
+        vector.EmplaceBack(i);
+    vector.RemoveIf([](int value) { return value % 3 == 0; });
+
+    std::string remaining;
+    for (int value : vector)
+        remaining += std::to_string(value);
+    BOOST_CHECK_EQUAL(remaining, "12457");
+}
+
+BOOST_AUTO_TEST_CASE(DestroysElements)
+{
+    auto counter = std::make_shared<int>(0);
+    {
+        InlineVector<std::shared_ptr<int>, 4> vector;
+        vector.EmplaceBack(counter);
+        vector.EmplaceBack(counter);
+        auto copy = vector;
+        BOOST_CHECK_EQUAL(counter.use_count(), 5);
+        copy.RemoveIf([](const auto&) { return true; });
+        BOOST_CHECK_EQUAL(counter.use_count(), 3);
+    }
+    BOOST_CHECK_EQUAL(counter.use_count(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(MovesElements)
+{
+    // Move-only elements only compile if the vector moves them
+    InlineVector<std::unique_ptr<int>, 4> vector;
+    vector.EmplaceBack(std::make_unique<int>(1));
+    vector.EmplaceBack(std::make_unique<int>(2));
+
+    InlineVector<std::unique_ptr<int>, 4> moved(std::move(vector));
+    BOOST_REQUIRE_EQUAL(moved.Size(), 2);
+    BOOST_CHECK_EQUAL(*moved[1], 2);
+
+    InlineVector<std::unique_ptr<int>, 4> assigned;
+    assigned.EmplaceBack(std::make_unique<int>(3));
+    assigned = std::move(moved);
+    BOOST_REQUIRE_EQUAL(assigned.Size(), 2);
+    BOOST_CHECK_EQUAL(*assigned[0], 1);
+
+    BOOST_CHECK((std::is_nothrow_move_constructible_v<InlineVector<std::string, 2>>));
+    BOOST_CHECK((std::is_nothrow_move_assignable_v<InlineVector<std::string, 2>>));
+}
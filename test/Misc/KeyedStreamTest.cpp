@@ -0,0 +1,86 @@
+#define BOOST_TEST_MODULE Misc.KeyedStream
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+#include "Misc/KeyedStream.h"
+#include "Misc/Philox.h"
+#include <thread>
+#include <vector>
+
+BOOST_AUTO_TEST_CASE(PhiloxKnownAnswers)
+{
+    // Known-answer vectors of the Random123 reference implementation
+    auto zero = RNG::Philox4x32::Block({ 0, 0, 0, 0 }, { 0, 0 });
+    BOOST_CHECK(zero == (RNG::Philox4x32::Counter { 0x6627E8D5, 0xE169C58D, 0xBC57AC4C, 0x9B00DBD8 }));
+
+    auto ones = RNG::Philox4x32::Block({ 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF }, { 0xFFFFFFFF, 0xFFFFFFFF });
+    BOOST_CHECK(ones == (RNG::Philox4x32::Counter { 0x408F276D, 0x41C83B0E, 0xA20BC7C6, 0x6D5451FD }));
+
+    auto pi = RNG::Philox4x32::Block({ 0x243F6A88, 0x85A308D3, 0x13198A2E, 0x03707344 }, { 0xA4093822, 0x299F31D0 });
+    BOOST_CHECK(pi == (RNG::Philox4x32::Counter { 0xD16CFE09, 0x94FDCCEB, 0x5001E420, 0x24126EA1 }));
+}
+
+/**
+ * @brief Draw a run of values from a stream
+ */
+static std::vector<int> Draw(uint64_t seed, const RNG::StreamKey& key, int count)
+{
+    RNG::KeyedStream stream(seed, key);
+    std::vector<int> values;
+    for (int i = 0; i < count; i++)
+        values.push_back(stream.RandomInt(1000000));
+    return values;
+}
+
+BOOST_AUTO_TEST_CASE(StreamsArePureFunctionsOfSeedAndKey)
+{
+    RNG::StreamKey key;
+    key.World = 2;
+    key.Room  = Coords(10, 11);
+
+    BOOST_CHECK(Draw(7, key, 50) == Draw(7, key, 50));
+    BOOST_CHECK(Draw(7, key, 50) != Draw(8, key, 50));
+
+    for (auto change : { &RNG::StreamKey::Entity, &RNG::StreamKey::Tick })
+    {
+        RNG::StreamKey other = key;
+        other.*change        = 1;
+        BOOST_CHECK(Draw(7, key, 50) != Draw(7, other, 50));
+    }
+    RNG::StreamKey otherRoom = key;
+    otherRoom.Room           = Coords(11, 10);
+    BOOST_CHECK(Draw(7, key, 50) != Draw(7, otherRoom, 50));
+    RNG::StreamKey otherWorld = key;
+    otherWorld.World          = 3;
+    BOOST_CHECK(Draw(7, key, 50) != Draw(7, otherWorld, 50));
+}
+
+BOOST_AUTO_TEST_CASE(ThreadsReproduceSequentialDraws)
+{
+    constexpr int Rooms = 8;
+    std::vector<std::vector<int>> sequential, parallel(Rooms);
+    for (int room = 0; room < Rooms; room++)
+        sequential.push_back(Draw(99, { 1, Coords(room, 0) }, 200));
+
+    std::vector<std::thread> threads;
+    for (int room = Rooms - 1; room >= 0; room--)
+        threads.emplace_back([room, &parallel]() { parallel[room] = Draw(99, { 1, Coords(room, 0) }, 200); });
+    for (auto& thread : threads)
+        thread.join();
+
+    BOOST_CHECK(sequential == parallel);
+}
+
+BOOST_AUTO_TEST_CASE(DrawsStayInRange)
+{
+    RNG::KeyedStream stream(1, {});
+    for (int i = 0; i < 10000; i++)
+    {
+        int value = stream.RandomInt(-1, 2);
+        BOOST_REQUIRE(-1 <= value && value < 2);
+        double real = stream.RandomDouble();
+        BOOST_REQUIRE(0. <= real && real < 1.);
+    }
+    BOOST_CHECK_EQUAL(stream.RandomInt(4, 4), 4);
+    BOOST_CHECK(stream.Chance(1.));
+    BOOST_CHECK(!stream.Chance(0.));
+}
@@ -0,0 +1,164 @@
+#define BOOST_TEST_MODULE Misc.RNG
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+#include "Misc/Exceptions.h"
+#include "Misc/RNG.h"
+#include "Misc/Xoshiro256x4.h"
+#include <array>
+#include <climits>
+#include <vector>
+
+struct ConstantTape : public RNG::Tape
+{
+    int TapeInt(int value, int low, int high) override { return low; }
+    double TapeDouble(double value) override { return .5; }
+};
+
+BOOST_AUTO_TEST_CASE(IntsStayInRange)
+{
+    RNG::Seed(1);
+    for (int i = 0; i < 10000; i++)
+    {
+        int value = RNG::RandomInt(-1, 2);
+        BOOST_REQUIRE(-1 <= value && value < 2);
+        BOOST_REQUIRE_EQUAL(RNG::RandomInt(1), 0);
+    }
+    BOOST_CHECK_EQUAL(RNG::RandomInt(5, 5), 5);
+
+    int value = RNG::RandomInt(INT_MIN, INT_MAX);
+    BOOST_CHECK(value < INT_MAX);
+}
+
+BOOST_AUTO_TEST_CASE(DoublesStayInRange)
+{
+    RNG::Seed(2);
+    for (int i = 0; i < 10000; i++)
+    {
+        double value = RNG::RandomDouble();
+        BOOST_REQUIRE(0. <= value && value < 1.);
+        value = RNG::RandomDouble(-3., 5.);
+        BOOST_REQUIRE(-3. <= value && value < 5.);
+    }
+    BOOST_CHECK(RNG::Chance(1.));
+    BOOST_CHECK(!RNG::Chance(0.));
+}
+
+BOOST_AUTO_TEST_CASE(SeedRepeats)
+{
+    RNG::Seed(42);
+    std::array<int, 16> first;
+    for (auto& value : first)
+        value = RNG::RandomInt(1000);
+
+    RNG::Seed(42);
+    for (int value : first)
+        BOOST_CHECK_EQUAL(RNG::RandomInt(1000), value);
+}
+
+BOOST_AUTO_TEST_CASE(IntsAreUniform)
+{
+    RNG::Seed(3);
+    constexpr int Buckets = 6;
+    constexpr int Draws   = 60000;
+    std::array<int, Buckets> counts {};
+    for (int i = 0; i < Draws; i++)
+        counts[RNG::RandomInt(Buckets)]++;
+
+    // Each bucket expects 10000 draws with a standard deviation of about 91
+    for (int count : counts)
+        BOOST_CHECK(9500 < count && count < 10500);
+}
+
+BOOST_AUTO_TEST_CASE(EngineRepeats)
+{
+    RNG::Xoshiro256 engine(0);
+    uint64_t first = engine();
+    RNG::Xoshiro256 again(0);
+    BOOST_CHECK_EQUAL(again(), first);
+    BOOST_CHECK(engine() != first);
+}
+
+BOOST_AUTO_TEST_CASE(LanesAreJumpedStreams)
+{
+    RNG::Xoshiro256x4 bulk(9);
+    std::vector<uint64_t> bits(64);
+    bulk.Fill(bits.data(), bits.size(), false);
+
+    RNG::Xoshiro256 lane(9);
+    for (size_t i = 0; i < RNG::Xoshiro256x4::Lanes; i++)
+    {
+        RNG::Xoshiro256 copy = lane;
+        for (size_t k = 0; k < bits.size() / RNG::Xoshiro256x4::Lanes; k++)
+            BOOST_REQUIRE_EQUAL(bits[k * RNG::Xoshiro256x4::Lanes + i], copy());
+        lane.Jump();
+    }
+    BOOST_CHECK_THROW(bulk.Fill(bits.data(), 3, false), InvalidArgumentException);
+}
+
+BOOST_AUTO_TEST_CASE(AVX2MatchesPortable)
+{
+    if (!RNG::Xoshiro256x4::SupportsAVX2())
+        return;
+
+    RNG::Xoshiro256x4 portable(5), vector(5);
+    std::vector<uint64_t> expected(1000), actual(1000);
+    for (int round = 0; round < 3; round++)
+    {
+        portable.Fill(expected.data(), expected.size(), false);
+        vector.Fill(actual.data(), actual.size(), true);
+        BOOST_REQUIRE(expected == actual);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(BulkFillsStayInRange)
+{
+    RNG::Seed(4);
+    std::vector<int> ints(10007);
+    RNG::FillRandomInt(ints.data(), ints.size(), -1, 2);
+    std::array<int, 3> counts {};
+    for (int value : ints)
+    {
+        BOOST_REQUIRE(-1 <= value && value < 2);
+        counts[value + 1]++;
+    }
+    for (int count : counts)
+        BOOST_CHECK(3000 < count && count < 3700);
+
+    std::vector<double> doubles(1001);
+    RNG::FillRandomDouble(doubles.data(), doubles.size());
+    for (double value : doubles)
+        BOOST_REQUIRE(0. <= value && value < 1.);
+
+    std::vector<uint8_t> chances(20000);
+    RNG::FillChance(chances.data(), chances.size(), .25);
+    int satisfied = 0;
+    for (uint8_t value : chances)
+        satisfied += value;
+    BOOST_CHECK(4700 < satisfied && satisfied < 5300);
+}
+
+BOOST_AUTO_TEST_CASE(BulkSeedRepeats)
+{
+    std::vector<int> first(300), second(300);
+    RNG::Seed(8);
+    RNG::FillRandomInt(first.data(), first.size(), 0, 1000);
+    RNG::Seed(8);
+    RNG::FillRandomInt(second.data(), second.size(), 0, 1000);
+    BOOST_CHECK(first == second);
+}
+
+BOOST_AUTO_TEST_CASE(BulkFillsGoThroughTape)
+{
+    ConstantTape tape;
+    RNG::ScopedTape scope(&tape);
+
+    std::vector<int> ints(10);
+    RNG::FillRandomInt(ints.data(), ints.size(), 3, 9);
+    for (int value : ints)
+        BOOST_CHECK_EQUAL(value, 3);
+
+    std::vector<uint8_t> chances(10);
+    RNG::FillChance(chances.data(), chances.size(), .6);
+    for (uint8_t value : chances)
+        BOOST_CHECK_EQUAL(value, 1);
+}
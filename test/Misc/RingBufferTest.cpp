@@ -0,0 +1,33 @@
+#define BOOST_TEST_MODULE Misc.RingBuffer
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+#include "Misc/RingBuffer.h"
+
+BOOST_AUTO_TEST_CASE(FillsUpToCapacity)
+{
+    RingBuffer<int> buffer(3);
+    BOOST_CHECK_EQUAL(buffer.Size(), 0);
+    buffer.PushBack() = 1;
+    buffer.PushBack() = 2;
+    BOOST_CHECK_EQUAL(buffer.Size(), 2);
+    BOOST_CHECK_EQUAL(buffer[0], 1);
+    BOOST_CHECK_EQUAL(buffer[1], 2);
+}
+
+BOOST_AUTO_TEST_CASE(OverwritesOldest)
+{
+    RingBuffer<int> buffer(3);
+    for (int i = 1; i <= 5; i++)
+        buffer.PushBack() = i;
+
+    BOOST_CHECK_EQUAL(buffer.Size(), 3);
+    BOOST_CHECK_EQUAL(buffer.Capacity(), 3);
+    BOOST_CHECK_EQUAL(buffer[0], 3);
+    BOOST_CHECK_EQUAL(buffer[1], 4);
+    BOOST_CHECK_EQUAL(buffer[2], 5);
+
+    buffer.Clear();
+    BOOST_CHECK_EQUAL(buffer.Size(), 0);
+    buffer.PushBack() = 6;
+    BOOST_CHECK_EQUAL(buffer[0], 6);
+}
@@ -0,0 +1,75 @@
+#define BOOST_TEST_MODULE UI.Animation.Animation
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+#include "Animation/Animation.h"
+#include <string>
+#include <vector>
+
+using namespace UI::Animation;
+
+BOOST_AUTO_TEST_CASE(SequenceRunsFramesInOrder)
+{
+    std::string trace;
+    Sequence animation;
+    animation.Do([&] { trace += 'a'; }).Wait(100).Do([&] { trace += 'b'; }).Wait(50).Do([&] { trace += 'c'; });
+
+    BOOST_CHECK_EQUAL(animation.Length(), 150);
+
+    animation.Seek(0);
+    BOOST_CHECK_EQUAL(trace, "a");
+    animation.Seek(99);
+    BOOST_CHECK_EQUAL(trace, "a");
+    animation.Seek(100);
+    BOOST_CHECK_EQUAL(trace, "ab");
+    animation.Seek(120);
+    BOOST_CHECK_EQUAL(trace, "ab");
+    animation.Seek(1000);
+    BOOST_CHECK_EQUAL(trace, "abc");
+}
+
+BOOST_AUTO_TEST_CASE(FinishSkipsToEndState)
+{
+    std::string trace;
+    int value = 0;
+    Sequence animation;
+    animation.Do([&] { trace += 'a'; })
+        .Then(std::make_unique<Tween>(200, 0, 50, [&](int v) { value = v; }))
+        .Do([&] { trace += 'b'; });
+
+    animation.Finish();
+    BOOST_CHECK_EQUAL(trace, "ab");
+    BOOST_CHECK_EQUAL(value, 50);
+
+    // Frames never repeat
+    animation.Finish();
+    BOOST_CHECK_EQUAL(trace, "ab");
+}
+
+BOOST_AUTO_TEST_CASE(TweenIsMonotonic)
+{
+    std::vector<int> values;
+    Tween tween(100, 40, 10, [&](int v) { values.push_back(v); });
+
+    for (int t = 0; t <= 120; t += 7)
+        tween.Seek(t);
+
+    BOOST_REQUIRE(!values.empty());
+    BOOST_CHECK_EQUAL(values.front(), 40);
+    BOOST_CHECK_EQUAL(values.back(), 10);
+    for (size_t i = 1; i < values.size(); i++)
+        BOOST_CHECK_LT(values[i], values[i - 1]);
+}
+
+BOOST_AUTO_TEST_CASE(ParallelRunsTogether)
+{
+    int first = 0, second = 0;
+    Parallel animation;
+    animation.With(std::make_unique<Tween>(100, 0, 10, [&](int v) { first = v; }, Linear))
+        .With(std::make_unique<Tween>(200, 0, 10, [&](int v) { second = v; }, Linear));
+
+    BOOST_CHECK_EQUAL(animation.Length(), 200);
+
+    animation.Seek(100);
+    BOOST_CHECK_EQUAL(first, 10);
+    BOOST_CHECK_EQUAL(second, 5);
+}
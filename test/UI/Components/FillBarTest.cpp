@@ -4,11 +4,12 @@
 
 #include "Helpers.h"
 #include "UI/Components/FillBar.h"
+#include "UI/Render/MemoryRenderTarget.h"
 
 class FillBarTest : public UI::Components::FillBar
 {
 public:
-    FillBarTest() : UI::Components::FillBar(stdscr, 16, 0, 0, 5, 10) {}
+    FillBarTest(UI::Render::RenderTarget& parent) : UI::Components::FillBar(parent, 16, 0, 0, 5, 10) {}
 
     void SetSize(int value) { m_Size = value; }
     void SetValue(int value) { m_Value = value; }
@@ -20,10 +21,11 @@ public:
     std::string TextRepresentation() const { return FillBar::TextRepresentation(); }
 };
 
-struct TestFixture : public NcursesFixture
+struct TestFixture
 {
-    TestFixture() {}
+    TestFixture() : m_Target(1, 16), m_FillBar(m_Target) {}
 
+    UI::Render::MemoryRenderTarget m_Target;
     FillBarTest m_FillBar;
 };
 
@@ -115,4 +117,27 @@ BOOST_FIXTURE_TEST_CASE(TextRepresentation, TestFixture)
     // Assert
     expected = "100%";
     BOOST_CHECK_EQUAL(actual, expected);
-}
\ No newline at end of file
+}
+
+BOOST_FIXTURE_TEST_CASE(Draw, TestFixture)
+{
+    // Test a half-filled bar
+    // Act
+    m_FillBar.Draw();
+
+    // Assert
+    BOOST_CHECK_EQUAL(m_Target.RowText(0), "[     5/10     ]");
+    BOOST_CHECK(m_Target.CellAt(0, 0) & A_BOLD);
+    BOOST_CHECK(m_Target.CellAt(0, 7) & A_REVERSE);
+    BOOST_CHECK(!(m_Target.CellAt(0, 8) & A_REVERSE));
+
+    // Test a bar with no maximum
+    // Arrange
+    m_FillBar.SetMaxValue(0);
+
+    // Act
+    m_FillBar.Draw();
+
+    // Assert
+    BOOST_CHECK_EQUAL(m_Target.RowText(0), "[     N/A      ]");
+}
@@ -0,0 +1,65 @@
+#define BOOST_TEST_MODULE UI.Components.LogWindow
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+#include "Components/LogWindow.h"
+#include "Render/HeadlessRenderBackend.h"
+#include "Render/MemoryRenderTarget.h"
+#include <string>
+
+using namespace UI;
+
+struct LogFixture
+{
+    // 5 text rows, lines of up to 12 characters (2 + 10 of text)
+    LogFixture() : m_Backend(7, 16), m_Log(m_Backend, 0, 0, 16, 7) {}
+
+    std::string Row(int y) const { return m_Backend.Frame().RowText(y); }
+
+    Render::HeadlessRenderBackend m_Backend;
+    Components::LogWindow m_Log;
+};
+
+BOOST_FIXTURE_TEST_CASE(WrapsOnWordBoundaries, LogFixture)
+{
+    m_Log.Append("one two three four");
+    BOOST_REQUIRE_EQUAL(m_Log.LineCount(), 3);
+    BOOST_CHECK_EQUAL(m_Log.LineAt(0), "> one two");
+    BOOST_CHECK_EQUAL(m_Log.LineAt(1), "  three");
+    BOOST_CHECK_EQUAL(m_Log.LineAt(2), "  four");
+}
+
+BOOST_FIXTURE_TEST_CASE(BreaksLongWords, LogFixture)
+{
+    m_Log.Append("abcdefghijklmnopq");
+    BOOST_REQUIRE_EQUAL(m_Log.LineCount(), 2);
+    BOOST_CHECK_EQUAL(m_Log.LineAt(0), "> abcdefghi");
+    BOOST_CHECK_EQUAL(m_Log.LineAt(1), " jklmnopq");
+}
+
+BOOST_FIXTURE_TEST_CASE(ShowsNewestAndPagesBack, LogFixture)
+{
+    for (int i = 0; i < 12; i++)
+        m_Log.Append("msg " + std::to_string(i));
+    m_Log.Draw();
+    m_Backend.Flush();
+    BOOST_CHECK_EQUAL(Row(1), "| > msg 7      |");
+    BOOST_CHECK_EQUAL(Row(5), "| > msg 11     |");
+
+    m_Log.PageUp();
+    m_Log.RefreshContent();
+    m_Backend.Flush();
+    BOOST_CHECK_EQUAL(Row(1), "| > msg 3      |");
+    BOOST_CHECK_EQUAL(Row(5), "| > msg 7      |");
+
+    // New messages do not move the view while scrolled back
+    m_Log.Append("msg 12");
+    m_Log.RefreshContent();
+    m_Backend.Flush();
+    BOOST_CHECK_EQUAL(Row(5), "| > msg 7      |");
+
+    m_Log.PageDown();
+    m_Log.PageDown();
+    m_Log.RefreshContent();
+    m_Backend.Flush();
+    BOOST_CHECK_EQUAL(Row(5), "| > msg 12     |");
+}
@@ -0,0 +1,54 @@
+#define BOOST_TEST_MODULE UI.Components.MenuWidget
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+#include "Components/MenuWidget.h"
+#include "Render/NcursesRenderBackend.h"
+#include <string>
+
+using namespace UI;
+
+struct MenuFixture
+{
+    MenuFixture() : m_Backend(true) {}
+
+    MENU* Open(std::initializer_list<std::string> labels)
+    {
+        m_Menu.ClearItems();
+        for (const auto& label : labels)
+        {
+            m_Menu.AddItem(label);
+        }
+        return m_Menu.Open(6, 20, 0, 0, 4, 18, 1, 1);
+    }
+
+    Render::NcursesRenderBackend m_Backend;
+    Components::MenuWidget m_Menu;
+};
+
+BOOST_FIXTURE_TEST_CASE(KeepsDuplicateLabels, MenuFixture)
+{
+    MENU* menu = Open({ "Potion", "Potion", "Sword" });
+    BOOST_REQUIRE(menu != nullptr);
+    BOOST_REQUIRE_EQUAL(item_count(menu), 3);
+    BOOST_CHECK(menu_items(menu)[0] != menu_items(menu)[1]);
+    BOOST_CHECK_EQUAL(item_name(menu_items(menu)[1]), "Potion");
+    m_Menu.Close();
+
+    menu = Open({ "Potion", "Potion" });
+    BOOST_REQUIRE_EQUAL(item_count(menu), 2);
+    m_Menu.Close();
+}
+
+BOOST_FIXTURE_TEST_CASE(ReusesUnchangedItems, MenuFixture)
+{
+    MENU* menu  = Open({ "Yes", "No" });
+    ITEM* first = menu_items(menu)[0];
+    m_Menu.Close();
+
+    menu = Open({ "Yes", "Maybe", "No" });
+    BOOST_REQUIRE_EQUAL(item_count(menu), 3);
+    BOOST_CHECK(menu_items(menu)[0] == first);
+    BOOST_CHECK_EQUAL(item_name(menu_items(menu)[1]), "Maybe");
+    BOOST_CHECK_EQUAL(item_name(menu_items(menu)[2]), "No");
+    m_Menu.Close();
+}
@@ -0,0 +1,79 @@
+#define BOOST_TEST_MODULE UI.InputLatency
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+#include "UI/InputLatency.h"
+#include <sstream>
+
+using namespace UI::InputLatency;
+
+BOOST_AUTO_TEST_CASE(DisabledByDefault)
+{
+    BOOST_CHECK(!IsEnabled());
+    Begin(Category::Move);
+    End();
+    BOOST_CHECK(!HasSamples());
+}
+
+BOOST_AUTO_TEST_CASE(RecordsByCategory)
+{
+    SetEnabled(true);
+    Reset();
+    Begin();
+    End();
+    Begin(Category::Move);
+    End();
+    BOOST_CHECK_EQUAL(GetLatencies(Category::Other).Count(), 1);
+    BOOST_CHECK_EQUAL(GetLatencies(Category::Move).Count(), 1);
+    BOOST_CHECK(HasSamples());
+
+    // Nothing is measured between End and the next Begin
+    End();
+    Classify(Category::MapOpen);
+    End();
+    BOOST_CHECK_EQUAL(GetLatencies(Category::MapOpen).Count(), 0);
+
+    // Disabling drops the measurement in progress
+    Begin(Category::MapOpen);
+    SetEnabled(false);
+    SetEnabled(true);
+    End();
+    BOOST_CHECK_EQUAL(GetLatencies(Category::MapOpen).Count(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(ClassifyOnlyRaises)
+{
+    Reset();
+    Begin();
+    Classify(Category::Move);
+    Classify(Category::RoomTransition);
+    Classify(Category::BattleStart);
+    End();
+    BOOST_CHECK_EQUAL(GetLatencies(Category::RoomTransition).Count(), 1);
+    BOOST_CHECK_EQUAL(GetLatencies(Category::BattleStart).Count(), 0);
+    BOOST_CHECK_EQUAL(GetLatencies(Category::Move).Count(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(BeginDiscardsUnfinished)
+{
+    Reset();
+    BOOST_CHECK(!HasSamples());
+    Begin(Category::BattleStart);
+    Begin();
+    End();
+    BOOST_CHECK_EQUAL(GetLatencies(Category::BattleStart).Count(), 0);
+    BOOST_CHECK_EQUAL(GetLatencies(Category::Other).Count(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(DumpListsEveryCategory)
+{
+    Reset();
+    Begin(Category::RoomTransition);
+    End();
+
+    std::ostringstream report;
+    Dump(report);
+    for (int i = 0; i < CategoryCount; i++)
+    {
+        BOOST_CHECK(report.str().find(CategoryName(static_cast<Category>(i))) != std::string::npos);
+    }
+}
@@ -0,0 +1,85 @@
+#define BOOST_TEST_MODULE UI.KeywordTable
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+#include "UI/KeywordTable.h"
+
+using UI::Keyword;
+using UI::KeywordTable;
+
+static const Keyword Inventory { Keyword::Kind::UICommand, 1 };
+static const Keyword Battle { Keyword::Kind::Command, 4 };
+static const Keyword And { Keyword::Kind::And, 0 };
+static const Keyword Last { Keyword::Kind::Last, 0 };
+
+static KeywordTable MakeTable()
+{
+    KeywordTable table;
+    for (const char* word : { "i", "inv", "inventory", "bag", "backpack" })
+        table.Add(word, Inventory);
+    for (const char* word : { "battle", "fight" })
+        table.Add(word, Battle);
+    table.Add("&", And);
+    table.Add("and", And);
+    table.Add("a", Last);
+    return table;
+}
+
+BOOST_AUTO_TEST_CASE(ExactMatch)
+{
+    KeywordTable table = MakeTable();
+    BOOST_CHECK(table.Find("inventory") == Inventory);
+    BOOST_CHECK(table.Find("fight") == Battle);
+    BOOST_CHECK(table.Find("&") == And);
+    BOOST_CHECK(table.Find("a") == Last);
+    BOOST_CHECK(table.Find("and") == And);
+}
+
+BOOST_AUTO_TEST_CASE(UniquePrefix)
+{
+    KeywordTable table = MakeTable();
+    BOOST_CHECK(table.Find("inve") == Inventory);
+    BOOST_CHECK(table.Find("backp") == Inventory);
+    BOOST_CHECK(table.Find("bat") == Battle);
+    BOOST_CHECK(table.Find("f") == Battle);
+    BOOST_CHECK(table.Find("an") == And);
+
+    // "ba" could be "bag" or "battle"
+    BOOST_CHECK(table.Find("ba").Type == Keyword::Kind::None);
+    BOOST_CHECK(table.Find("b").Type == Keyword::Kind::None);
+}
+
+BOOST_AUTO_TEST_CASE(NoMatch)
+{
+    KeywordTable table = MakeTable();
+    BOOST_CHECK(table.Find("").Type == Keyword::Kind::None);
+    BOOST_CHECK(table.Find("inventoryx").Type == Keyword::Kind::None);
+    BOOST_CHECK(table.Find("Bag").Type == Keyword::Kind::None);
+    BOOST_CHECK(table.Find("12").Type == Keyword::Kind::None);
+    BOOST_CHECK(!table.Add("Bag", Inventory));
+    BOOST_CHECK(!table.Add("", Inventory));
+}
+
+BOOST_AUTO_TEST_CASE(Replace)
+{
+    KeywordTable table = MakeTable();
+    table.Add("bag", Battle);
+    BOOST_CHECK(table.Find("bag") == Battle);
+    BOOST_CHECK(table.Find("ba").Type == Keyword::Kind::None);
+
+    table.Add("backpack", Battle);
+    BOOST_CHECK(table.Find("ba") == Battle);
+
+    table.Clear();
+    BOOST_CHECK(table.Find("bag").Type == Keyword::Kind::None);
+}
+
+BOOST_AUTO_TEST_CASE(NextWord)
+{
+    std::string_view input = "  go\tup 3 &  ";
+    BOOST_CHECK_EQUAL(UI::NextWord(input), "go");
+    BOOST_CHECK_EQUAL(UI::NextWord(input), "up");
+    BOOST_CHECK_EQUAL(UI::NextWord(input), "3");
+    BOOST_CHECK_EQUAL(UI::NextWord(input), "&");
+    BOOST_CHECK(UI::NextWord(input).empty());
+    BOOST_CHECK(input.empty());
+}
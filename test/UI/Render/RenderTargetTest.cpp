@@ -0,0 +1,64 @@
+#define BOOST_TEST_MODULE UI.Render.RenderTarget
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include "UI/Render/HeadlessRenderBackend.h"
+#include "UI/Render/MemoryRenderTarget.h"
+
+BOOST_AUTO_TEST_CASE(AddString)
+{
+    UI::Render::MemoryRenderTarget target(2, 8);
+
+    target.AddString(0, 1, "foo");
+    target.AddString("bar");
+    // Clipped at the right edge
+    target.Print(1, 4, "%d", 123456);
+
+    BOOST_CHECK_EQUAL(target.RowText(0), " foobar ");
+    BOOST_CHECK_EQUAL(target.RowText(1), "    1234");
+}
+
+BOOST_AUTO_TEST_CASE(Attributes)
+{
+    UI::Render::MemoryRenderTarget target(1, 4);
+
+    target.AttrOn(A_BOLD | COLOR_PAIR(1));
+    target.AddChar(0, 0, 'a');
+    // The character's own color takes precedence
+    target.AddChar('b' | COLOR_PAIR(2));
+    target.AttrOff(A_BOLD | A_COLOR);
+    target.AddChar('c');
+
+    BOOST_CHECK_EQUAL(target.CellAt(0, 0), 'a' | A_BOLD | COLOR_PAIR(1));
+    BOOST_CHECK_EQUAL(target.CellAt(0, 1), 'b' | A_BOLD | COLOR_PAIR(2));
+    BOOST_CHECK_EQUAL(target.CellAt(0, 2), static_cast<chtype>('c'));
+}
+
+BOOST_AUTO_TEST_CASE(SubTarget)
+{
+    UI::Render::MemoryRenderTarget target(3, 6);
+    auto sub = target.CreateSubTarget(1, 3, 1, 2);
+
+    sub->AddString(0, 0, "abcdef");
+
+    BOOST_CHECK_EQUAL(sub->Width(), 3);
+    BOOST_CHECK_EQUAL(target.RowText(1), "  abc ");
+}
+
+BOOST_AUTO_TEST_CASE(HeadlessFrame)
+{
+    UI::Render::HeadlessRenderBackend backend(4, 10);
+    auto panel = backend.CreateTarget(3, 5, 1, 2);
+    panel->Box();
+    panel->AddString(1, 1, "hi");
+
+    // Nothing is visible until the panel is presented
+    BOOST_CHECK_EQUAL(backend.Frame().Snapshot(), "          \n          \n          \n          \n");
+
+    panel->Present();
+    BOOST_CHECK_EQUAL(backend.Frame().Snapshot(),
+                      "          \n"
+                      "  +---+   \n"
+                      "  |hi |   \n"
+                      "  +---+   \n");
+}
@@ -0,0 +1,58 @@
+#define BOOST_TEST_MODULE Worlds.World
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+#include "Worlds/Room.h"
+#include "Worlds/World.h"
+#include "Worlds/WorldManager.h"
+#include <tuple>
+#include <vector>
+
+/**
+ * @brief Walk through a seeded world, always taking the first entrance that leads on, and describe every room
+ */
+static std::vector<std::tuple<int, int, int, int>> Walk(uint64_t seed, int steps)
+{
+    Worlds::WorldManager worldManager(seed);
+    std::vector<std::tuple<int, int, int, int>> rooms;
+    Direction arrival = Direction::None;
+    for (int step = 0; step < steps; step++)
+    {
+        const auto& room = worldManager.CurrentRoom();
+        int entrances    = 0;
+        int bit          = 1;
+        Direction next   = Direction::None;
+        for (const auto& dir : Direction::All)
+        {
+            bit <<= 1;
+            if (room.Entrance(dir) == nullptr)
+                continue;
+            entrances |= bit;
+            if (next == Direction::None && dir != arrival)
+                next = dir;
+        }
+        rooms.emplace_back(room.GetWidth(), room.GetHeight(), room.AccessibleFieldCount(), entrances);
+        if (next == Direction::None)
+            break;
+        worldManager.SwitchRoom(next);
+        arrival = next.Opposite();
+    }
+    return rooms;
+}
+
+BOOST_AUTO_TEST_CASE(SeededWorldsRepeat)
+{
+    for (uint64_t seed = 0; seed < 10; seed++)
+    {
+        BOOST_CHECK_EQUAL(Worlds::WorldManager(seed).GetSeed(), seed);
+        BOOST_CHECK(Walk(seed, 12) == Walk(seed, 12));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(SeedsChangeWorlds)
+{
+    auto first = Walk(0, 12);
+    bool anyDifferent = false;
+    for (uint64_t seed = 1; seed < 10; seed++)
+        anyDifferent |= Walk(seed, 12) != first;
+    BOOST_CHECK(anyDifferent);
+}